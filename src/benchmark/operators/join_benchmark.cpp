@@ -2,6 +2,7 @@
 
 #include "benchmark/benchmark.h"
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/radix_partitioning_plan.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_mpsm.hpp"
 #include "operators/join_nested_loop.hpp"
@@ -120,4 +121,43 @@ BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinMPSM);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinMPSM);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinMPSM);
 
+/**
+ * Compares the radix partitioning plan that JoinHash derives from the caches and TLBs of the machine (radix_bits = -1)
+ * with fixed plans (radix_bits split across pass_count passes). A semi join is used, so that the build relation is
+ * the smaller right input and the output size does not dominate the runtime.
+ */
+void BM_JoinHash_RadixPartitioning(benchmark::State& state) {  // NOLINT 10,000,000 x 100,000
+  const auto radix_bits = state.range(0);
+  const auto pass_count = state.range(1);
+
+  auto table_wrapper_left = generate_table(TABLE_SIZE_BIG);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_MEDIUM);
+
+  auto radix_partitioning_plan = std::optional<RadixPartitioningPlan>{};
+  if (radix_bits >= 0) {
+    radix_partitioning_plan = RadixPartitioningPlan::with_fixed_bits(radix_bits, pass_count);
+  }
+
+  clear_cache();
+
+  while (state.KeepRunning()) {
+    auto join = std::make_shared<JoinHash>(table_wrapper_left, table_wrapper_right, JoinMode::Semi,
+                                           ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                           radix_partitioning_plan);
+    join->execute();
+  }
+
+  opossum::StorageManager::get().reset();
+}
+
+void radix_partitioning_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->Args({-1, 0});
+  for (const auto radix_bits : {0, 4, 8, 12, 16}) {
+    benchmark->Args({radix_bits, 1});
+    if (radix_bits >= 8) benchmark->Args({radix_bits, 2});
+  }
+}
+
+BENCHMARK(BM_JoinHash_RadixPartitioning)->Apply(radix_partitioning_arguments);
+
 }  // namespace opossum
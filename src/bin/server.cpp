@@ -1,37 +1,107 @@
 #include <boost/asio/io_service.hpp>
+#include <boost/program_options.hpp>
 
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <string>
 
+#include "logging/checkpoint_manager.hpp"
+#include "logging/logger.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group_manager.hpp"
 #include "scheduler/topology.hpp"
 #include "server/server.hpp"
+#include "storage/background_chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
+#include "tasks/chunk_compaction_task.hpp"
 #include "utils/load_table.hpp"
+#include "utils/pausable_loop_thread.hpp"
 
 int main(int argc, char* argv[]) {
   try {
-    uint16_t port = 5432;
-
-    if (argc >= 2) {
-      char* endptr{nullptr};
-      errno = 0;
-      auto port_long = std::strtol(argv[1], &endptr, 10);
-      Assert(errno == 0 && port_long != 0 && port_long <= 65535 && *endptr == 0, "invalid port number");
-      port = static_cast<uint16_t>(port_long);
+    namespace po = boost::program_options;
+
+    auto session_resource_group_config = opossum::SessionResourceGroupConfig{};
+    auto max_active_tasks = size_t{0};
+    auto max_queued_tasks = size_t{0};
+    auto max_memory_usage = size_t{0};
+
+    // The port and the durability folder may also be given as the first two positional arguments
+    auto options = po::options_description{"Hyrise server options (limits of 0 mean unlimited)"};
+    // clang-format off
+    options.add_options()
+      ("help", "print this help message")
+      ("port", po::value<uint16_t>()->default_value(5432), "port to listen on")
+      ("durability_folder", po::value<std::string>(), "folder for the redo log and the checkpoints")
+      ("session_weight", po::value(&session_resource_group_config.weight)->default_value(1),
+       "share of the Workers of each session relative to the other sessions")
+      ("session_max_concurrent_tasks",
+       po::value(&session_resource_group_config.max_concurrent_tasks)->default_value(0),
+       "number of tasks of a session that may run at the same time")
+      ("max_active_tasks", po::value(&max_active_tasks)->default_value(0),
+       "number of tasks of all sessions that may run at the same time")
+      ("max_queued_tasks", po::value(&max_queued_tasks)->default_value(0),
+       "number of queued tasks above which new queries wait")
+      ("max_memory_usage", po::value(&max_memory_usage)->default_value(0),
+       "memory usage in bytes above which new queries wait");
+    // clang-format on
+
+    auto positional_options = po::positional_options_description{};
+    positional_options.add("port", 1).add("durability_folder", 1);
+
+    auto variables = po::variables_map{};
+    po::store(po::command_line_parser(argc, argv).options(options).positional(positional_options).run(), variables);
+    po::notify(variables);
+
+    if (variables.count("help")) {
+      std::cout << options << std::endl;
+      return 0;
     }
 
+    const auto port = variables["port"].as<uint16_t>();
+    Assert(port != 0, "invalid port number");
+
+    auto& resource_group_manager = opossum::ResourceGroupManager::get();
+    resource_group_manager.set_max_active_tasks(max_active_tasks);
+    resource_group_manager.set_max_queued_tasks(max_queued_tasks);
+    resource_group_manager.set_max_memory_usage(max_memory_usage);
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
+    // Committed transactions are only durable if a folder for the redo log and the checkpoints is given. The database
+    // is restored from the latest checkpoint and the redo log in that folder.
+    auto checkpoint_manager = std::unique_ptr<opossum::CheckpointManager>{};
+    if (variables.count("durability_folder")) {
+      const auto durability_folder = variables["durability_folder"].as<std::string>();
+      checkpoint_manager = std::make_unique<opossum::CheckpointManager>(durability_folder + "/checkpoints");
+      checkpoint_manager->recover(durability_folder + "/" + opossum::Logger::LOG_FILE_NAME);
+      opossum::Logger::get().setup(durability_folder);
+      checkpoint_manager->start_periodic_checkpoints(std::chrono::minutes{5});
+    }
+
+    // Periodically garbage collect the rows that have been invalidated by Delete and Update. The tables are compacted
+    // one after another, never concurrently.
+    const auto compact_tables = [](size_t) {
+      for (const auto& table_name : opossum::StorageManager::get().table_names()) {
+        opossum::ChunkCompactionTask{table_name}.execute();
+      }
+    };
+    const auto chunk_compaction_thread = opossum::PausableLoopThread{std::chrono::seconds{10}, compact_tables};
+
+    // Encode chunks once they are completed, choosing the encoding of each column automatically
+    auto background_chunk_encoder = opossum::BackgroundChunkEncoder{};
+    background_chunk_encoder.start(std::chrono::seconds{1});
+
     boost::asio::io_service io_service;
 
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
     // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    opossum::Server server{io_service, port, session_resource_group_config};
 
     io_service.run();
   } catch (std::exception& e) {
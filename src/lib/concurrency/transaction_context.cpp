@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "commit_context.hpp"
+#include "logging/logger.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "transaction_manager.hpp"
 #include "utils/assert.hpp"
@@ -38,6 +39,10 @@ TransactionContext::~TransactionContext() {
                 return !has_registered_operators || committed_or_rolled_back;
               }()),
               "Has registered operators but has neither been committed nor rolled back.");
+
+  if (_snapshot_commit_id_is_registered) {
+    TransactionManager::get()._deregister_snapshot_commit_id(_snapshot_commit_id);
+  }
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
@@ -79,6 +84,16 @@ bool TransactionContext::commit_async(const std::function<void(TransactionID)>&
     op->commit_records(commit_id());
   }
 
+  // With the redo log enabled, the transaction may only become visible once its Commit record is durable. The
+  // Logger calls back from its writer thread after the group commit that contains the record.
+  auto& logger = Logger::get();
+  if (logger.is_enabled() && !_rw_operators.empty()) {
+    const auto context_ptr = shared_from_this();
+    logger.log_commit(_transaction_id, commit_id(),
+                      [context_ptr, callback]() { context_ptr->_mark_as_pending_and_try_commit(callback); });
+    return true;
+  }
+
   _mark_as_pending_and_try_commit(callback);
 
   return true;
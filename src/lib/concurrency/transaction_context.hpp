@@ -90,7 +90,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   bool rollback();
 
   /**
-   * Commits the transaction.
+   * Commits the transaction. If the Logger is enabled, the transaction is committed only after the redo records of
+   * its operators have been written to the log.
    *
    * @param callback called when transaction is actually committed
    * @return false if called a second time
@@ -112,6 +113,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
 
+  /**
+   * Returns true if read-write operators have been registered, i.e., if the transaction might have locked or inserted
+   * rows.
+   */
+  bool has_read_write_operators() const { return !_rw_operators.empty(); }
+
   /**
    * @defgroup Update the counter of active operators
    * @{
@@ -181,6 +188,10 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   std::atomic_size_t _num_active_operators;
 
+  // Set if the context has been created by TransactionManager::new_transaction_context(), which keeps track of the
+  // snapshot commit IDs of all existing contexts
+  bool _snapshot_commit_id_is_registered{false};
+
   mutable std::condition_variable _active_operators_cv;
   mutable std::mutex _active_operators_mutex;
 };
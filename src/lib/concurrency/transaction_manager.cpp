@@ -1,5 +1,6 @@
 #include "transaction_manager.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "commit_context.hpp"
@@ -18,6 +19,9 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  std::lock_guard<std::mutex> lock(manager._active_snapshot_commit_ids_mutex);
+  manager._active_snapshot_commit_ids.clear();
 }
 
 TransactionManager::TransactionManager()
@@ -25,10 +29,38 @@ TransactionManager::TransactionManager()
       _last_commit_id{INITIAL_COMMIT_ID},
       _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
 
+void TransactionManager::_reset_to(const CommitID last_commit_id, const TransactionID next_transaction_id) {
+  _next_transaction_id = std::max(next_transaction_id, INITIAL_TRANSACTION_ID);
+  _last_commit_id = std::max(last_commit_id, INITIAL_COMMIT_ID);
+  std::atomic_store(&_last_commit_context, std::make_shared<CommitContext>(_last_commit_id));
+}
+
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  // The snapshot is taken and registered atomically, so that oldest_active_snapshot_commit_id() cannot miss a
+  // snapshot that is older than the last commit ID it has seen.
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  auto context = std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  _active_snapshot_commit_ids.insert(context->snapshot_commit_id());
+  context->_snapshot_commit_id_is_registered = true;
+
+  return context;
+}
+
+CommitID TransactionManager::oldest_active_snapshot_commit_id() const {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  if (_active_snapshot_commit_ids.empty()) return _last_commit_id;
+  return *_active_snapshot_commit_ids.begin();
+}
+
+void TransactionManager::_deregister_snapshot_commit_id(const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  // The entry is missing if the TransactionManager has been reset in the meantime
+  const auto iter = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (iter != _active_snapshot_commit_ids.end()) _active_snapshot_commit_ids.erase(iter);
 }
 
 /**
@@ -3,6 +3,8 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 
 #include "types.hpp"
 
@@ -57,7 +59,15 @@ class TransactionManager : private Noncopyable {
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * Returns the smallest snapshot commit ID of all transaction contexts that still exist, or the last commit ID if
+   * there are none. Rows whose end_cid is not larger than this are invisible to every current and future
+   * transaction and can be garbage collected.
+   */
+  CommitID oldest_active_snapshot_commit_id() const;
+
  private:
+  friend class CheckpointManager;
   friend class TransactionContext;
 
   TransactionManager();
@@ -65,9 +75,15 @@ class TransactionManager : private Noncopyable {
   TransactionManager(TransactionManager&&) = delete;
   TransactionManager& operator=(TransactionManager&&) = delete;
 
+  // Used by the recovery to continue with the commit and transaction ids that have been restored
+  void _reset_to(const CommitID last_commit_id, const TransactionID next_transaction_id);
+
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Called when a transaction context created by new_transaction_context() is destroyed
+  void _deregister_snapshot_commit_id(const CommitID snapshot_commit_id);
+
  private:
   std::atomic<TransactionID> _next_transaction_id;
   // TransactionID = 0 means "not set" in the MVCC columns
@@ -79,5 +95,9 @@ class TransactionManager : private Noncopyable {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  // Snapshot commit IDs of all existing transaction contexts (one entry per context)
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_snapshot_commit_ids_mutex;
 };
 }  // namespace opossum
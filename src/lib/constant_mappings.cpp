@@ -82,6 +82,8 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::RunLength, "RunLength"},
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
+    {EncodingType::Delta, "Delta"},
+    {EncodingType::FrontCodedDictionary, "FrontCodedDictionary"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
@@ -1,9 +1,27 @@
 #pragma once
 
+#include "types.hpp"
+
 namespace opossum {
 
-enum class BinaryColumnType : uint8_t { value_column = 0, dictionary_column = 1 };
+enum class BinaryColumnType : uint8_t {
+  value_column = 0,
+  dictionary_column = 1,
+  front_coded_dictionary_column = 2
+};
 
 using BoolAsByteType = uint8_t;
 
+// Written instead of the width of a dictionary column's attribute vector if it is a SimdBp128Vector
+constexpr AttributeVectorWidth SIMD_BP128_ATTRIBUTE_VECTOR_WIDTH = 0;
+
+// Binary files start with this magic number, followed by the version of their format. Files written before the format
+// was versioned do not have it and are treated as version 0.
+constexpr char BINARY_FILE_MAGIC_NUMBER[8] = {'H', 'Y', 'R', 'I', 'S', 'E', 'B', 'F'};
+constexpr uint32_t BINARY_FILE_VERSION = 1;
+
+// Since version 1, the attribute vectors and fixed-width dictionaries of dictionary columns start at a multiple of this
+// file offset, so that ImportBinary can use the mapped pages of the file as their storage instead of copying them.
+constexpr size_t BINARY_FILE_ALIGNMENT = 4096;
+
 }  // namespace opossum
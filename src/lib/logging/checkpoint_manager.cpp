@@ -0,0 +1,380 @@
+#include "checkpoint_manager.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "logging/redo_log_record.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/mvcc_columns.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto CHECKPOINT_PREFIX = std::string{"checkpoint_"};
+const auto TEMPORARY_SUFFIX = std::string{".tmp"};
+const auto SCHEMA_FILE_NAME = std::string{"schema.bin"};
+
+// std::ofstream offers no way to force its data to disk, so the files are synced once they have been written
+void sync_file(const std::string& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "Cannot open " + path + " for syncing");
+  const auto result = ::fsync(file_descriptor);
+  ::close(file_descriptor);
+  Assert(result == 0, "Cannot sync " + path);
+}
+
+void export_table(const std::shared_ptr<const Table>& table, const std::string& file_path) {
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto export_binary = std::make_shared<ExportBinary>(table_wrapper, file_path);
+  export_binary->execute();
+  sync_file(file_path);
+}
+
+std::string chunk_file_path(const std::string& table_folder, const ChunkID chunk_id, const std::string& extension) {
+  return (filesystem::path{table_folder} / (std::to_string(chunk_id) + extension)).string();
+}
+
+void write_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, const std::string& table_folder,
+                 const CommitID snapshot_commit_id) {
+  const auto chunk = table->get_chunk(chunk_id);
+
+  auto pos_list = std::make_shared<PosList>();
+  auto begin_cids = std::vector<CommitID>{};
+  auto end_cids = std::vector<CommitID>{};
+  if (!chunk->has_mvcc_columns()) {
+    // Tables without MVCC are written as a whole. After the recovery, their rows are visible to all transactions, like
+    // those of other tables imported by ImportBinary.
+    const auto row_count = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      pos_list->emplace_back(chunk_id, chunk_offset);
+    }
+    begin_cids.resize(row_count, CommitID{0});
+    end_cids.resize(row_count, MvccColumns::MAX_COMMIT_ID);
+  } else {
+    const auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
+
+    // Insert grows the MVCC columns before the data columns
+    const auto row_count = static_cast<ChunkOffset>(std::min(size_t{chunk->size()}, mvcc_columns->size()));
+    pos_list->resize(row_count);
+    begin_cids.resize(row_count);
+    end_cids.resize(row_count);
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      // Rows that were committed after the snapshot might still be written to and are not exported. If their
+      // transaction committed, the redo log contains them.
+      const auto begin_cid = mvcc_columns->begin_cids[chunk_offset];
+      const auto end_cid = mvcc_columns->end_cids[chunk_offset];
+      const auto is_inserted = begin_cid <= snapshot_commit_id;
+
+      (*pos_list)[chunk_offset] = is_inserted ? RowID{chunk_id, chunk_offset} : NULL_ROW_ID;
+      begin_cids[chunk_offset] = is_inserted ? begin_cid : MvccColumns::MAX_COMMIT_ID;
+      end_cids[chunk_offset] = end_cid <= snapshot_commit_id ? end_cid : MvccColumns::MAX_COMMIT_ID;
+    }
+  }
+
+  auto reference_table =
+      std::make_shared<Table>(table->column_definitions(), TableType::References, table->max_chunk_size());
+  auto columns = ChunkColumns{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    columns.emplace_back(std::make_shared<ReferenceColumn>(table, column_id, pos_list));
+  }
+  reference_table->append_chunk(columns);
+  export_table(reference_table, chunk_file_path(table_folder, chunk_id, ".bin"));
+
+  const auto mvcc_file_path = chunk_file_path(table_folder, chunk_id, ".mvcc");
+  {
+    auto mvcc_file = std::ofstream{mvcc_file_path, std::ios::binary};
+    mvcc_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+
+    const auto row_count = static_cast<ChunkOffset>(begin_cids.size());
+    mvcc_file.write(reinterpret_cast<const char*>(&row_count), sizeof(row_count));
+    mvcc_file.write(reinterpret_cast<const char*>(begin_cids.data()), row_count * sizeof(CommitID));
+    mvcc_file.write(reinterpret_cast<const char*>(end_cids.data()), row_count * sizeof(CommitID));
+  }
+  sync_file(mvcc_file_path);
+}
+
+std::shared_ptr<Chunk> read_chunk(const std::string& table_folder, const ChunkID chunk_id) {
+  auto import_binary = std::make_shared<ImportBinary>(chunk_file_path(table_folder, chunk_id, ".bin"));
+  import_binary->execute();
+  const auto chunk_table = std::const_pointer_cast<Table>(import_binary->get_output());
+  Assert(chunk_table->chunk_count() == 1, "Checkpoint files must contain exactly one chunk");
+  const auto chunk = chunk_table->get_chunk(ChunkID{0});
+
+  auto mvcc_file = std::ifstream{chunk_file_path(table_folder, chunk_id, ".mvcc"), std::ios::binary};
+  mvcc_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+  auto row_count = ChunkOffset{0};
+  mvcc_file.read(reinterpret_cast<char*>(&row_count), sizeof(row_count));
+  Assert(row_count == chunk->size(), "MVCC file does not match the chunk");
+
+  auto begin_cids = std::vector<CommitID>(row_count);
+  auto end_cids = std::vector<CommitID>(row_count);
+  mvcc_file.read(reinterpret_cast<char*>(begin_cids.data()), row_count * sizeof(CommitID));
+  mvcc_file.read(reinterpret_cast<char*>(end_cids.data()), row_count * sizeof(CommitID));
+
+  auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
+  std::copy(begin_cids.begin(), begin_cids.end(), mvcc_columns->begin_cids.begin());
+  std::copy(end_cids.begin(), end_cids.end(), mvcc_columns->end_cids.begin());
+
+  return chunk;
+}
+
+void replay_value(Table& table, const RowID& row_id, const std::vector<AllTypeVariant>& values,
+                  const CommitID commit_id) {
+  Assert(values.size() == table.column_count(), "Redo log record does not match the table");
+
+  while (table.chunk_count() <= row_id.chunk_id) {
+    table.append_mutable_chunk();
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  const auto row_count = size_t{row_id.chunk_offset} + 1;
+
+  // Rows that were inserted by transactions which did not commit stay as invisible gaps
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto value_column = std::dynamic_pointer_cast<ValueColumn<ColumnDataType>>(chunk->get_column(column_id));
+      Assert(value_column, "Rows can only be replayed into ValueColumns");
+
+      value_column->values().grow_to_at_least(row_count);
+      if (value_column->is_nullable()) value_column->null_values().grow_to_at_least(row_count);
+
+      // The checkpoint stores the rows that were not yet committed as NULLs in nullable columns
+      const auto& value = values[column_id];
+      if (variant_is_null(value)) {
+        Assert(value_column->is_nullable(), "Cannot replay NULL into NOT NULL column");
+        value_column->null_values()[row_id.chunk_offset] = true;
+      } else {
+        value_column->values()[row_id.chunk_offset] = type_cast<ColumnDataType>(value);
+        if (value_column->is_nullable()) value_column->null_values()[row_id.chunk_offset] = false;
+      }
+    });
+  }
+
+  auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
+  if (mvcc_columns->size() < row_count) {
+    mvcc_columns->grow_by(row_count - mvcc_columns->size(), MvccColumns::MAX_COMMIT_ID);
+  }
+  mvcc_columns->begin_cids[row_id.chunk_offset] = commit_id;
+}
+
+void replay_invalidation(Table& table, const RowID& row_id, const CommitID commit_id) {
+  Assert(row_id.chunk_id < table.chunk_count(), "Redo log invalidates a row that does not exist");
+  auto mvcc_columns = table.get_chunk(row_id.chunk_id)->get_scoped_mvcc_columns_lock();
+  Assert(row_id.chunk_offset < mvcc_columns->size(), "Redo log invalidates a row that does not exist");
+  mvcc_columns->end_cids[row_id.chunk_offset] = commit_id;
+}
+
+}  // namespace
+
+namespace opossum {
+
+CheckpointManager::CheckpointManager(const std::string& folder) : _folder(folder) {
+  filesystem::create_directories(_folder);
+}
+
+CheckpointManager::~CheckpointManager() = default;
+
+CommitID CheckpointManager::take_checkpoint() {
+  std::lock_guard<std::mutex> lock(_checkpoint_mutex);
+
+  const auto snapshot_commit_id = TransactionManager::get().last_commit_id();
+  const auto checkpoint_path = (filesystem::path{_folder} / (CHECKPOINT_PREFIX + std::to_string(snapshot_commit_id)));
+
+  // Nothing has been committed since the last checkpoint
+  if (filesystem::exists(checkpoint_path)) return snapshot_commit_id;
+
+  const auto temporary_path = filesystem::path{checkpoint_path.string() + TEMPORARY_SUFFIX};
+  filesystem::remove_all(temporary_path);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    const auto table = std::shared_ptr<const Table>{StorageManager::get().get_table(table_name)};
+    const auto table_folder = (temporary_path / table_name).string();
+    filesystem::create_directories(table_folder);
+
+    export_table(std::make_shared<Table>(table->column_definitions(), TableType::Data, table->max_chunk_size()),
+                 (filesystem::path{table_folder} / SCHEMA_FILE_NAME).string());
+
+    // Chunks that are appended from now on only contain rows committed after the snapshot
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>(
+          [table, chunk_id, table_folder, snapshot_commit_id]() {
+            write_chunk(table, chunk_id, table_folder, snapshot_commit_id);
+          }));
+      jobs.back()->schedule();
+    }
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  filesystem::rename(temporary_path, checkpoint_path);
+  sync_file(_folder);
+
+  // Only the latest checkpoint is needed for recovery
+  for (const auto& entry : filesystem::directory_iterator(_folder)) {
+    const auto file_name = entry.path().filename().string();
+    if (file_name.compare(0, CHECKPOINT_PREFIX.size(), CHECKPOINT_PREFIX) == 0 && entry.path() != checkpoint_path) {
+      filesystem::remove_all(entry.path());
+    }
+  }
+
+  return snapshot_commit_id;
+}
+
+void CheckpointManager::start_periodic_checkpoints(const std::chrono::milliseconds interval) {
+  _checkpoint_thread = std::make_unique<PausableLoopThread>(interval, [this](size_t) { take_checkpoint(); });
+}
+
+std::optional<std::string> CheckpointManager::latest_checkpoint() const {
+  auto latest_snapshot_commit_id = std::optional<CommitID>{};
+  auto latest_path = std::optional<std::string>{};
+
+  for (const auto& entry : filesystem::directory_iterator(_folder)) {
+    const auto file_name = entry.path().filename().string();
+    if (file_name.compare(0, CHECKPOINT_PREFIX.size(), CHECKPOINT_PREFIX) != 0) continue;
+
+    // Incomplete checkpoints are ignored
+    if (file_name.size() >= TEMPORARY_SUFFIX.size() &&
+        file_name.compare(file_name.size() - TEMPORARY_SUFFIX.size(), TEMPORARY_SUFFIX.size(), TEMPORARY_SUFFIX) == 0) {
+      continue;
+    }
+
+    const auto snapshot_commit_id = static_cast<CommitID>(std::stoul(file_name.substr(CHECKPOINT_PREFIX.size())));
+    if (!latest_snapshot_commit_id || snapshot_commit_id > *latest_snapshot_commit_id) {
+      latest_snapshot_commit_id = snapshot_commit_id;
+      latest_path = entry.path().string();
+    }
+  }
+
+  return latest_path;
+}
+
+CommitID CheckpointManager::recover(const std::string& log_file_path) {
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  auto snapshot_commit_id = CommitID{0};
+
+  const auto checkpoint_path = latest_checkpoint();
+  if (checkpoint_path) {
+    const auto checkpoint_name = filesystem::path{*checkpoint_path}.filename().string();
+    snapshot_commit_id = static_cast<CommitID>(std::stoul(checkpoint_name.substr(CHECKPOINT_PREFIX.size())));
+
+    auto chunks = std::map<std::string, std::vector<std::shared_ptr<Chunk>>>{};
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+    for (const auto& table_entry : filesystem::directory_iterator(*checkpoint_path)) {
+      const auto table_name = table_entry.path().filename().string();
+      const auto table_folder = table_entry.path().string();
+
+      auto import_schema = std::make_shared<ImportBinary>((table_entry.path() / SCHEMA_FILE_NAME).string());
+      import_schema->execute();
+      tables[table_name] = std::const_pointer_cast<Table>(import_schema->get_output());
+
+      auto chunk_count = size_t{0};
+      for (const auto& file_entry : filesystem::directory_iterator(table_entry.path())) {
+        if (file_entry.path().extension() == ".mvcc") ++chunk_count;
+      }
+
+      // The vectors are not resized while the jobs write to them
+      auto& table_chunks = chunks[table_name];
+      table_chunks.resize(chunk_count);
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&table_chunks, table_folder, chunk_id]() {
+          table_chunks[chunk_id] = read_chunk(table_folder, chunk_id);
+        }));
+        jobs.back()->schedule();
+      }
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (const auto& [table_name, table_chunks] : chunks) {
+      for (const auto& chunk : table_chunks) {
+        tables[table_name]->append_chunk(chunk);
+      }
+    }
+  }
+
+  auto last_commit_id = snapshot_commit_id;
+  auto last_transaction_id = TransactionID{0};
+
+  if (filesystem::exists(log_file_path)) {
+    const auto records = read_redo_log(log_file_path);
+
+    // Only transactions that committed after the checkpoint are replayed
+    auto commit_ids = std::unordered_map<TransactionID, CommitID>{};
+    for (const auto& record : records) {
+      last_transaction_id = std::max(last_transaction_id, record.transaction_id);
+      if (record.type != RedoLogRecordType::Commit || record.commit_id <= snapshot_commit_id) continue;
+
+      commit_ids[record.transaction_id] = record.commit_id;
+      last_commit_id = std::max(last_commit_id, record.commit_id);
+    }
+
+    for (const auto& record : records) {
+      if (record.type == RedoLogRecordType::Commit) continue;
+
+      const auto commit_id_iter = commit_ids.find(record.transaction_id);
+      if (commit_id_iter == commit_ids.end()) continue;
+
+      auto table_iter = tables.find(record.table_name);
+      if (table_iter == tables.end()) {
+        // Tables that were created after the checkpoint (e.g., by loading them at startup) are not in the redo log
+        if (!StorageManager::get().has_table(record.table_name)) continue;
+        table_iter = tables.emplace(record.table_name, StorageManager::get().get_table(record.table_name)).first;
+      }
+
+      if (record.type == RedoLogRecordType::Value) {
+        replay_value(*table_iter->second, record.row_id, record.values, commit_id_iter->second);
+      } else {
+        replay_invalidation(*table_iter->second, record.row_id, commit_id_iter->second);
+      }
+    }
+  }
+
+  for (const auto& [table_name, table] : tables) {
+    // Only the last chunk receives new rows. Marking the others as immutable computes their MVCC summaries.
+    for (auto chunk_id = ChunkID{0}; chunk_id + 1 < table->chunk_count(); ++chunk_id) {
+      table->get_chunk(chunk_id)->mark_immutable();
+    }
+
+    if (StorageManager::get().has_table(table_name)) StorageManager::get().drop_table(table_name);
+    StorageManager::get().add_table(table_name, table);
+  }
+
+  TransactionManager::get()._reset_to(last_commit_id, last_transaction_id + 1);
+
+  return last_commit_id;
+}
+
+}  // namespace opossum
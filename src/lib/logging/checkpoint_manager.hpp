@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct PausableLoopThread;
+
+/**
+ * The CheckpointManager writes checkpoints of all tables in the StorageManager and restores them, together with the
+ * redo log of the Logger, after a restart.
+ *
+ * A checkpoint is consistent for a snapshot CommitID, the last commit ID when the checkpoint starts. Writers are not
+ * blocked: each chunk is exported with ExportBinary through a ReferenceColumn that replaces the rows inserted after
+ * the snapshot (or not committed yet) by NULL_ROW_IDs. Next to the data, the begin and end CommitIDs of all rows are
+ * stored, with CommitIDs after the snapshot replaced by MvccColumns::MAX_COMMIT_ID. Thereby, all rows keep their
+ * RowIDs, which the redo log refers to.
+ *
+ * Layout of a checkpoint (tables and chunks are written by one JobTask per chunk):
+ *
+ *   <folder>/checkpoint_<snapshot commit id>/<table name>/schema.bin    Header of the table (ExportBinary, no chunks)
+ *   <folder>/checkpoint_<snapshot commit id>/<table name>/<chunk id>.bin     One chunk (ExportBinary)
+ *   <folder>/checkpoint_<snapshot commit id>/<table name>/<chunk id>.mvcc    Row count, begin and end CommitIDs
+ *
+ * A checkpoint is written to a temporary folder that is renamed once it is complete. Older checkpoints are removed
+ * afterwards.
+ *
+ * Note: Chunk and table indexes and the encoding of chunks are not part of the checkpoint, all chunks are restored as
+ * ValueColumns.
+ */
+class CheckpointManager : private Noncopyable {
+ public:
+  explicit CheckpointManager(const std::string& folder);
+  ~CheckpointManager();
+
+  /**
+   * Writes a checkpoint of all tables and returns its snapshot commit ID.
+   */
+  CommitID take_checkpoint();
+
+  /**
+   * Takes a checkpoint in a background thread after every interval.
+   */
+  void start_periodic_checkpoints(const std::chrono::milliseconds interval);
+
+  /**
+   * Returns the path of the latest complete checkpoint, if any.
+   */
+  std::optional<std::string> latest_checkpoint() const;
+
+  /**
+   * Adds the tables of the latest checkpoint to the StorageManager, replaying the transactions in the redo log at
+   * log_file_path that committed after the checkpoint. Chunks are imported in parallel. The TransactionManager
+   * continues with the last restored CommitID, which is returned.
+   *
+   * Must be called before any transaction is started and before the Logger is set up.
+   */
+  CommitID recover(const std::string& log_file_path);
+
+ private:
+  const std::string _folder;
+  std::mutex _checkpoint_mutex;
+  std::unique_ptr<PausableLoopThread> _checkpoint_thread;
+};
+
+}  // namespace opossum
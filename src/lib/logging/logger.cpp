@@ -0,0 +1,157 @@
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "redo_log_record.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+Logger& Logger::get() {
+  static Logger instance;
+  return instance;
+}
+
+void Logger::setup(const std::string& log_folder, const std::chrono::microseconds group_commit_interval) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  Assert(_file_descriptor == -1, "Logger has already been set up.");
+
+  filesystem::create_directories(log_folder);
+  _log_file_path = (filesystem::path{log_folder} / LOG_FILE_NAME).string();
+
+  _file_descriptor = ::open(_log_file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor != -1, "Cannot open log file " + _log_file_path + ": " + std::strerror(errno));
+
+  _group_commit_interval = group_commit_interval;
+  _shutdown_requested = false;
+  _writer_thread = std::thread(&Logger::_write_loop, this);
+}
+
+void Logger::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_file_descriptor == -1) return;
+    _shutdown_requested = true;
+  }
+  _records_logged.notify_one();
+  _writer_thread.join();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  ::close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+Logger::~Logger() { shutdown(); }
+
+bool Logger::is_enabled() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _file_descriptor != -1;
+}
+
+std::string Logger::log_file_path() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _log_file_path;
+}
+
+void Logger::log_value(const TransactionID transaction_id, const std::string& table_name, const RowID& row_id,
+                       const std::vector<AllTypeVariant>& values) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  append_value_record(_buffer, transaction_id, table_name, row_id, values);
+  ++_logged_sequence_number;
+  if (_buffer.size() >= MAX_BUFFER_SIZE) _records_logged.notify_one();
+}
+
+void Logger::log_invalidation(const TransactionID transaction_id, const std::string& table_name, const RowID& row_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  append_invalidation_record(_buffer, transaction_id, table_name, row_id);
+  ++_logged_sequence_number;
+  if (_buffer.size() >= MAX_BUFFER_SIZE) _records_logged.notify_one();
+}
+
+void Logger::log_commit(const TransactionID transaction_id, const CommitID commit_id,
+                        const std::function<void()>& callback) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    append_commit_record(_buffer, transaction_id, commit_id);
+    _commit_callbacks.emplace_back(callback);
+    ++_logged_sequence_number;
+  }
+  _records_logged.notify_one();
+}
+
+void Logger::flush() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_file_descriptor == -1) return;
+
+  const auto sequence_number = _logged_sequence_number;
+  _flush_requested = true;
+  _records_logged.notify_one();
+  _records_written.wait(lock, [&]() { return _written_sequence_number >= sequence_number; });
+}
+
+void Logger::_write_loop() {
+  auto buffer = std::vector<char>{};
+  auto commit_callbacks = std::vector<std::function<void()>>{};
+
+  while (true) {
+    auto sequence_number = uint64_t{0};
+    auto shutdown = false;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      const auto buffer_is_full = [&]() { return _buffer.size() >= MAX_BUFFER_SIZE; };
+      const auto must_write = [&]() { return _shutdown_requested || _flush_requested || buffer_is_full(); };
+
+      _records_logged.wait(lock, [&]() { return must_write() || !_commit_callbacks.empty(); });
+
+      // Group commit: give concurrent transactions the chance to add their Commit records to this write
+      if (!must_write()) _records_logged.wait_for(lock, _group_commit_interval, must_write);
+
+      std::swap(buffer, _buffer);
+      std::swap(commit_callbacks, _commit_callbacks);
+      sequence_number = _logged_sequence_number;
+      shutdown = _shutdown_requested;
+      _flush_requested = false;
+    }
+
+    _write_to_file(buffer);
+    buffer.clear();
+
+    for (const auto& callback : commit_callbacks) {
+      callback();
+    }
+    commit_callbacks.clear();
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _written_sequence_number = sequence_number;
+    }
+    _records_written.notify_all();
+
+    if (shutdown) return;
+  }
+}
+
+void Logger::_write_to_file(const std::vector<char>& buffer) {
+  if (buffer.empty()) return;
+
+  auto bytes_written = size_t{0};
+  while (bytes_written < buffer.size()) {
+    const auto result = ::write(_file_descriptor, buffer.data() + bytes_written, buffer.size() - bytes_written);
+    if (result == -1 && errno == EINTR) continue;
+    Assert(result != -1, std::string{"Cannot write to log file: "} + std::strerror(errno));
+    bytes_written += static_cast<size_t>(result);
+  }
+
+  const auto sync_result = ::fsync(_file_descriptor);
+  Assert(sync_result == 0, std::string{"Cannot sync log file: "} + std::strerror(errno));
+}
+
+}  // namespace opossum
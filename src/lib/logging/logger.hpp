@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The Logger writes the redo log (see redo_log_record.hpp) that makes committed transactions durable.
+ *
+ * Read-write operators append their records to an in-memory buffer when their transaction commits. A dedicated log
+ * writer thread writes the buffer to the log file and calls fsync. It does not sync each commit on its own: once a
+ * Commit record arrives, it waits for up to the group commit interval so that the commits of concurrent transactions
+ * share a single fsync (group commit). Afterwards, it calls the callbacks of all Commit records in the written buffer.
+ * TransactionContext uses these callbacks to make the transaction visible only after its records are durable.
+ *
+ * Logging is disabled until setup() is called. The Logger is thread-safe.
+ */
+class Logger : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_GROUP_COMMIT_INTERVAL = std::chrono::microseconds{1000};
+
+  // The writer does not wait for further commits once the buffer has grown to this size
+  static constexpr auto MAX_BUFFER_SIZE = size_t{1u << 20u};
+
+  static constexpr auto LOG_FILE_NAME = "hyrise.log";
+
+  static Logger& get();
+
+  /**
+   * Opens the log file in log_folder (the folder is created if necessary, new records are appended to an existing
+   * log) and starts the log writer thread.
+   */
+  void setup(const std::string& log_folder,
+             const std::chrono::microseconds group_commit_interval = DEFAULT_GROUP_COMMIT_INTERVAL);
+
+  /**
+   * Writes all buffered records, stops the log writer thread and closes the log file. Afterwards, logging is disabled.
+   */
+  void shutdown();
+
+  bool is_enabled() const;
+
+  std::string log_file_path() const;
+
+  void log_value(const TransactionID transaction_id, const std::string& table_name, const RowID& row_id,
+                 const std::vector<AllTypeVariant>& values);
+  void log_invalidation(const TransactionID transaction_id, const std::string& table_name, const RowID& row_id);
+
+  /**
+   * @param callback is called by the log writer thread once the Commit record is durable
+   */
+  void log_commit(const TransactionID transaction_id, const CommitID commit_id, const std::function<void()>& callback);
+
+  /**
+   * Blocks until all records that have been logged before the call are durable.
+   */
+  void flush();
+
+  ~Logger();
+
+ private:
+  Logger() = default;
+
+  void _write_loop();
+  void _write_to_file(const std::vector<char>& buffer);
+
+  mutable std::mutex _mutex;
+  std::condition_variable _records_logged;
+  std::condition_variable _records_written;
+
+  std::vector<char> _buffer;
+  std::vector<std::function<void()>> _commit_callbacks;
+
+  // Every call appending to the buffer increments _logged_sequence_number. The writer stores the sequence number of the
+  // last buffer it has written, so that flush() knows when its records are durable.
+  uint64_t _logged_sequence_number{0};
+  uint64_t _written_sequence_number{0};
+  bool _flush_requested{false};
+  bool _shutdown_requested{false};
+
+  std::string _log_file_path;
+  std::chrono::microseconds _group_commit_interval{DEFAULT_GROUP_COMMIT_INTERVAL};
+  int _file_descriptor{-1};
+  std::thread _writer_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,173 @@
+#include "redo_log_record.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+void append(std::vector<char>& buffer, const T& value) {
+  const auto offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <>
+void append(std::vector<char>& buffer, const std::string& value) {
+  append(buffer, static_cast<uint32_t>(value.size()));
+  buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+void append_header(std::vector<char>& buffer, const RedoLogRecordType type, const TransactionID transaction_id) {
+  append(buffer, type);
+  append(buffer, transaction_id);
+}
+
+void append_row(std::vector<char>& buffer, const std::string& table_name, const RowID& row_id) {
+  append(buffer, table_name);
+  append(buffer, static_cast<ChunkID::base_type>(row_id.chunk_id));
+  append(buffer, row_id.chunk_offset);
+}
+
+// Reads from a buffer and tracks whether the buffer was long enough for all reads
+class RecordReader {
+ public:
+  explicit RecordReader(const std::vector<char>& buffer) : _buffer(buffer) {}
+
+  template <typename T>
+  T read() {
+    auto value = T{};
+    if (_offset + sizeof(T) > _buffer.size()) {
+      _truncated = true;
+      return value;
+    }
+    std::memcpy(&value, _buffer.data() + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read<uint32_t>();
+    if (_truncated || _offset + length > _buffer.size()) {
+      _truncated = true;
+      return {};
+    }
+    auto value = std::string{_buffer.data() + _offset, length};
+    _offset += length;
+    return value;
+  }
+
+  RowID read_row_id() {
+    const auto chunk_id = ChunkID{read<ChunkID::base_type>()};
+    const auto chunk_offset = read<ChunkOffset>();
+    return _truncated ? RowID{} : RowID{chunk_id, chunk_offset};
+  }
+
+  bool at_end() const { return _offset == _buffer.size(); }
+  bool truncated() const { return _truncated; }
+
+ private:
+  const std::vector<char>& _buffer;
+  size_t _offset{0};
+  bool _truncated{false};
+};
+
+}  // namespace
+
+namespace opossum {
+
+void append_value_record(std::vector<char>& buffer, const TransactionID transaction_id, const std::string& table_name,
+                         const RowID& row_id, const std::vector<AllTypeVariant>& values) {
+  append_header(buffer, RedoLogRecordType::Value, transaction_id);
+  append_row(buffer, table_name, row_id);
+  append(buffer, static_cast<uint16_t>(values.size()));
+
+  for (const auto& value : values) {
+    const auto data_type = data_type_from_all_type_variant(value);
+    append(buffer, data_type);
+    if (data_type == DataType::Null) continue;
+
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      append(buffer, boost::get<ColumnDataType>(value));
+    });
+  }
+}
+
+void append_invalidation_record(std::vector<char>& buffer, const TransactionID transaction_id,
+                                const std::string& table_name, const RowID& row_id) {
+  append_header(buffer, RedoLogRecordType::Invalidation, transaction_id);
+  append_row(buffer, table_name, row_id);
+}
+
+void append_commit_record(std::vector<char>& buffer, const TransactionID transaction_id, const CommitID commit_id) {
+  append_header(buffer, RedoLogRecordType::Commit, transaction_id);
+  append(buffer, commit_id);
+}
+
+std::vector<RedoLogRecord> read_redo_log(const std::string& file_path) {
+  auto file = std::ifstream{file_path, std::ios::binary};
+  Assert(file.is_open(), "Cannot open redo log " + file_path);
+
+  const auto buffer = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  auto reader = RecordReader{buffer};
+  auto records = std::vector<RedoLogRecord>{};
+
+  while (!reader.at_end()) {
+    auto record = RedoLogRecord{};
+    record.type = reader.read<RedoLogRecordType>();
+    record.transaction_id = reader.read<TransactionID>();
+
+    switch (record.type) {
+      case RedoLogRecordType::Value: {
+        record.table_name = reader.read_string();
+        record.row_id = reader.read_row_id();
+        const auto column_count = reader.read<uint16_t>();
+        for (auto column_id = uint16_t{0}; column_id < column_count && !reader.truncated(); ++column_id) {
+          const auto data_type = reader.read<DataType>();
+          if (data_type == DataType::Null) {
+            record.values.emplace_back(NullValue{});
+            continue;
+          }
+
+          resolve_data_type(data_type, [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+              record.values.emplace_back(reader.read_string());
+            } else {
+              record.values.emplace_back(reader.read<ColumnDataType>());
+            }
+          });
+        }
+      } break;
+
+      case RedoLogRecordType::Invalidation:
+        record.table_name = reader.read_string();
+        record.row_id = reader.read_row_id();
+        break;
+
+      case RedoLogRecordType::Commit:
+        record.commit_id = reader.read<CommitID>();
+        break;
+
+      default:
+        // Only the tail of the log can be corrupted, by a write that was interrupted
+        return records;
+    }
+
+    if (reader.truncated()) break;
+    records.emplace_back(std::move(record));
+  }
+
+  return records;
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The redo log consists of a sequence of binary records. Each record starts with its RedoLogRecordType and the ID of
+ * the transaction that wrote it:
+ *
+ *   Value:        [type:u8][transaction_id:u32][table_name][chunk_id:u32][chunk_offset:u32][column_count:u16][values]
+ *   Invalidation: [type:u8][transaction_id:u32][table_name][chunk_id:u32][chunk_offset:u32]
+ *   Commit:       [type:u8][transaction_id:u32][commit_id:u32]
+ *
+ * Strings (the table name and string values) are stored as [length:u32][bytes]. Each value is prefixed with its
+ * DataType (as u8), NULLs consist of the DataType only.
+ *
+ * Value and Invalidation records are only written when a transaction commits, directly before its Commit record. A
+ * transaction whose Commit record is not in the log has not been committed and its records must be ignored.
+ */
+enum class RedoLogRecordType : uint8_t { Value = 0, Invalidation = 1, Commit = 2 };
+
+struct RedoLogRecord {
+  RedoLogRecordType type{RedoLogRecordType::Commit};
+  TransactionID transaction_id{0};
+
+  // Only set for Commit records
+  CommitID commit_id{0};
+
+  // Only set for Value and Invalidation records
+  std::string table_name;
+  RowID row_id;
+
+  // Only set for Value records
+  std::vector<AllTypeVariant> values;
+};
+
+void append_value_record(std::vector<char>& buffer, const TransactionID transaction_id, const std::string& table_name,
+                         const RowID& row_id, const std::vector<AllTypeVariant>& values);
+void append_invalidation_record(std::vector<char>& buffer, const TransactionID transaction_id,
+                                const std::string& table_name, const RowID& row_id);
+void append_commit_record(std::vector<char>& buffer, const TransactionID transaction_id, const CommitID commit_id);
+
+/**
+ * Reads all records of a log file. A crash might have interrupted the writing of the last records, such an incomplete
+ * tail is ignored.
+ */
+std::vector<RedoLogRecord> read_redo_log(const std::string& file_path);
+
+}  // namespace opossum
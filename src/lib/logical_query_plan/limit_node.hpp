@@ -6,6 +6,8 @@
 
 namespace opossum {
 
+enum class LimitType : uint8_t { Limit, TopK };
+
 /**
  * This node type represents limiting a result to a certain number of rows (LIMIT operator).
  */
@@ -17,6 +19,9 @@ class LimitNode : public EnableMakeForLQPNode<LimitNode>, public AbstractLQPNode
 
   const std::shared_ptr<AbstractExpression> num_rows_expression;
 
+  // Set to TopK by the TopKRule if this node and its input SortNode are executed by a single TopK operator
+  LimitType limit_type{LimitType::Limit};
+
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
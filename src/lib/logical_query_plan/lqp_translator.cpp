@@ -21,12 +21,14 @@
 #include "expression/list_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_select_expression.hpp"
+#include "expression/parameter_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_select_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
@@ -47,6 +49,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
@@ -172,44 +175,76 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_ta
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   /**
-   * Not using OperatorScanPredicate, since the IndexScan still wants to do BETWEEN in one step and splitting it up
-   * in two doesn't work as you can only do a single IndexScan per Table.
+   * Not using OperatorScanPredicate, since the IndexScan still wants to do BETWEEN in one step, which is a single
+   * range lookup in the index.
    */
 
   auto column_id = ColumnID{0};
-  auto value_variant = AllTypeVariant{NullValue{}};
-  auto value2_variant = std::optional<AllTypeVariant>{};
+  auto value_variant = AllParameterVariant{AllTypeVariant{NullValue{}}};
+  auto value2_variant = std::optional<AllParameterVariant>{};
 
-  // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode.
-  // Our IndexScan implementation does not work on reference columns yet.
-  Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
+  // Returns the value of a ValueExpression or the ParameterID of a ParameterExpression (e.g., a value placeholder)
+  const auto resolve_value = [](const AbstractExpression& expression) -> std::optional<AllParameterVariant> {
+    if (const auto value_expression = dynamic_cast<const ValueExpression*>(&expression)) {
+      return AllParameterVariant{value_expression->value};
+    }
+    if (const auto parameter_expression = dynamic_cast<const ParameterExpression*>(&expression)) {
+      return AllParameterVariant{parameter_expression->parameter_id};
+    }
+    return std::nullopt;
+  };
 
   const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate);
   Assert(predicate, "Expected predicate");
   Assert(!predicate->arguments.empty(), "Expected arguments");
 
+  // The IndexScan probes the indexes of the stored table that the column originates from. Unless the predicate
+  // directly follows the StoredTableNode, the input of the IndexScan references the rows of that table.
+  const auto stored_table_node = lqp_find_referenced_stored_table_node(node->left_input(), *predicate->arguments[0]);
+  Assert(stored_table_node, "IndexScan must operate on a column that references a StoredTableNode.");
+  const auto stored_column_id =
+      std::static_pointer_cast<LQPColumnExpression>(predicate->arguments[0])->column_reference.original_column_id();
+
   column_id = node->left_input()->get_column_id(*predicate->arguments[0]);
   if (predicate->arguments.size() > 1) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[1]);
+    const auto value = resolve_value(*predicate->arguments[1]);
     // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as second argument for IndexScan");
-    value_variant = value_expression->value;
+    Assert(value, "Expected value as second argument for IndexScan");
+    value_variant = *value;
   }
   if (predicate->arguments.size() > 2) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[2]);
+    value2_variant = resolve_value(*predicate->arguments[2]);
     // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as third argument for IndexScan");
-    value2_variant = value_expression->value;
+    Assert(value2_variant, "Expected value as third argument for IndexScan");
   }
 
   const std::vector<ColumnID> column_ids = {column_id};
-  const std::vector<AllTypeVariant> right_values = {value_variant};
-  std::vector<AllTypeVariant> right_values2 = {};
+  const std::vector<AllParameterVariant> right_values = {value_variant};
+  std::vector<AllParameterVariant> right_values2 = {};
   if (value2_variant) right_values2.emplace_back(*value2_variant);
 
-  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
-  const auto table_name = stored_table_node->table_name;
-  const auto table = StorageManager::get().get_table(table_name);
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+
+  // A TableIndex covers all chunks, so no TableScan is needed for the chunks without an index
+  if (table->get_table_index(stored_column_id)) {
+    return std::make_shared<IndexScan>(input_operator, ColumnIndexType::Table, column_ids,
+                                       predicate->predicate_condition, right_values, right_values2);
+  }
+
+  // The chunks of a reference input do not correspond to the chunks of the stored table. Hence, the rows of chunks
+  // without an index cannot be left to a separate TableScan. Instead, the IndexScan scans these chunks itself.
+  if (node->left_input() != stored_table_node) {
+    auto has_chunk_index = false;
+    for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count() && !has_chunk_index; ++chunk_id) {
+      has_chunk_index = table->get_chunk(chunk_id)->get_index(ColumnIndexType::GroupKey,
+                                                              std::vector<ColumnID>{stored_column_id}) != nullptr;
+    }
+    Assert(has_chunk_index, "IndexScan on references requires an index on the column of the stored table.");
+
+    return std::make_shared<IndexScan>(input_operator, ColumnIndexType::GroupKey, column_ids,
+                                       predicate->predicate_condition, right_values, right_values2);
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
@@ -275,31 +310,31 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
 
+  return std::make_shared<Sort>(input_operator, _translate_sort_column_definitions(sort_node));
+}
+
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(
+    const std::shared_ptr<SortNode>& sort_node) const {
   /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
+   * Go through all the order descriptions and create a SortColumnDefinition for each of them. They are executed by a
+   * single sort operator.
    */
+  const auto& pqp_expressions = _translate_expressions(sort_node->expressions, sort_node->left_input());
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
+  std::vector<SortColumnDefinition> sort_definitions;
+  sort_definitions.reserve(pqp_expressions.size());
 
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
-
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
+  auto order_by_mode_iter = sort_node->order_by_modes.begin();
+  for (const auto& pqp_expression : pqp_expressions) {
     const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
     Assert(pqp_column_expression,
            "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
 
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
+    sort_definitions.emplace_back(pqp_column_expression->column_id, *order_by_mode_iter);
+    ++order_by_mode_iter;
   }
 
-  return current_pqp;
+  return sort_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -383,12 +418,25 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+  if (limit_node->limit_type == LimitType::TopK) return _translate_limit_node_to_top_k(limit_node);
+
+  const auto input_operator = translate_node(node->left_input());
   return std::make_shared<Limit>(input_operator,
                                  _translate_expressions({limit_node->num_rows_expression}, node->left_input()).front());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node_to_top_k(
+    const std::shared_ptr<LimitNode>& limit_node) const {
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(limit_node->left_input());
+  Assert(sort_node, "TopK must follow a SortNode");
+
+  const auto input_operator = translate_node(sort_node->left_input());
+  return std::make_shared<TopK>(
+      input_operator, _translate_sort_column_definitions(sort_node),
+      _translate_expressions({limit_node->num_rows_expression}, limit_node->left_input()).front());
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
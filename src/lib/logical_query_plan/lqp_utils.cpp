@@ -3,8 +3,10 @@
 #include <set>
 
 #include "expression/expression_functional.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "utils/assert.hpp"
 
@@ -187,4 +189,29 @@ std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression(const std:
   }
 }
 
+std::shared_ptr<const StoredTableNode> lqp_find_referenced_stored_table_node(
+    const std::shared_ptr<const AbstractLQPNode>& lqp, const AbstractExpression& column_expression) {
+  const auto lqp_column_expression = dynamic_cast<const LQPColumnExpression*>(&column_expression);
+  if (!lqp_column_expression) return nullptr;
+
+  const auto original_node = lqp_column_expression->column_reference.original_node();
+  if (!original_node || original_node->type != LQPNodeType::StoredTable) return nullptr;
+
+  // These nodes are translated to operators that only forward positions (or NULL_ROW_IDs) of their inputs
+  static const auto forwarding_node_types = std::set<LQPNodeType>{
+      LQPNodeType::Alias, LQPNodeType::Join, LQPNodeType::Limit, LQPNodeType::Predicate, LQPNodeType::Union,
+      LQPNodeType::Validate};
+
+  const auto reaches_original_node = [&](const auto& self, const std::shared_ptr<const AbstractLQPNode>& node) {
+    if (!node) return false;
+    if (node == original_node) return true;
+    if (!forwarding_node_types.count(node->type)) return false;
+    return self(self, node->left_input()) || self(self, node->right_input());
+  };
+
+  if (!reaches_original_node(reaches_original_node, lqp)) return nullptr;
+
+  return std::static_pointer_cast<const StoredTableNode>(original_node);
+}
+
 }  // namespace opossum
@@ -10,6 +10,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class AbstractExpression;
+class StoredTableNode;
 enum class LQPInputSide;
 
 using LQPNodeMapping = std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractLQPNode>>;
@@ -48,6 +49,14 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
  */
 std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * Follows the column reference of @param column_expression from the output of @param lqp down to the StoredTableNode
+ * the column originates from. The StoredTableNode is returned if all nodes on the way are translated to operators that
+ * output ReferenceColumns pointing to the stored table (e.g., Predicate, Validate and Join), otherwise nullptr.
+ */
+std::shared_ptr<const StoredTableNode> lqp_find_referenced_stored_table_node(
+    const std::shared_ptr<const AbstractLQPNode>& lqp, const AbstractExpression& column_expression);
+
 enum class LQPVisitation { VisitInputs, DoNotVisitInputs };
 
 /**
@@ -0,0 +1,115 @@
+#include "abstract_chunkwise_operator.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/proxy_chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/numa_memory_resource.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Morsels are processed on the node whose memory holds the chunk, if the chunk was allocated on a specific node
+NodeID preferred_node_id(const Chunk& chunk) {
+  const auto* memory_resource = dynamic_cast<const NUMAMemoryResource*>(chunk.get_allocator().resource());
+  if (!memory_resource || !CurrentScheduler::is_set()) return CURRENT_NODE_ID;
+
+  const auto node_id = memory_resource->get_node_id();
+  if (node_id == NUMAMemoryResource::UNDEFINED_NODE_ID ||
+      static_cast<size_t>(node_id) >= CurrentScheduler::get()->queues().size()) {
+    return CURRENT_NODE_ID;
+  }
+
+  return static_cast<NodeID>(node_id);
+}
+
+}  // namespace
+
+void AbstractChunkwiseOperator::execute_pipeline(
+    const std::vector<std::shared_ptr<AbstractChunkwiseOperator>>& pipeline) {
+  DebugAssert(!pipeline.empty(), "Pipeline must contain at least one operator");
+  DebugAssert(
+      [&]() {
+        for (auto index = size_t{1}; index < pipeline.size(); ++index) {
+          if (pipeline[index]->input_left() != pipeline[index - 1]) return false;
+        }
+        return true;
+      }(),
+      "Each operator of a pipeline must be the left input of the next one");
+
+  const auto& first_operator = pipeline.front();
+  const auto& last_operator = pipeline.back();
+
+  DebugAssert(first_operator->input_left() && first_operator->input_left()->get_output(),
+              "Input of the pipeline has not yet been executed");
+  DebugAssert(!last_operator->_output, "Pipeline has already been executed");
+
+  Timer performance_timer;
+
+  // All operators of a query plan share the same transaction context
+  const auto transaction_context = last_operator->transaction_context();
+  if (transaction_context) {
+    // Do not execute the pipeline if the transaction has been aborted, see AbstractOperator::execute()
+    if (transaction_context->aborted()) return;
+    transaction_context->on_operator_started();
+  }
+
+  const auto in_table = first_operator->input_table_left();
+  first_operator->_on_prepare_chunks(in_table);
+
+  auto output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+  std::mutex output_mutex;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(in_table->chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    const auto node_id = preferred_node_id(*in_table->get_chunk(chunk_id));
+
+    auto job_task = std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
+
+      auto columns = first_operator->_on_execute_chunk(in_table, chunk_id, transaction_context);
+
+      // TableScan and Validate resolve the positions of their input, so the output never references a morsel
+      for (auto index = size_t{1}; index < pipeline.size() && !columns.empty(); ++index) {
+        auto morsel = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+        morsel->append_chunk(columns);
+        columns = pipeline[index]->_on_execute_chunk(morsel, ChunkID{0}, transaction_context);
+      }
+
+      if (columns.empty()) return;
+
+      std::lock_guard<std::mutex> lock(output_mutex);
+      output_table->append_chunk(columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
+    });
+
+    jobs.push_back(job_task);
+    job_task->schedule(node_id);
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  last_operator->_output = output_table;
+
+  if (transaction_context) transaction_context->on_operator_finished();
+
+  for (const auto& op : pipeline) op->_on_cleanup();
+
+  last_operator->_base_performance_data.walltime = performance_timer.lap();
+}
+
+bool AbstractChunkwiseOperator::can_be_pipelined() const { return true; }
+
+void AbstractChunkwiseOperator::_on_prepare_chunks(const std::shared_ptr<const Table>& in_table) {}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * AbstractChunkwiseOperator is the superclass for operators whose output chunks each only depend on a single chunk of
+ * their left input, e.g., TableScan and Validate.
+ *
+ * Besides being executed operator-at-a-time via execute(), a chain of these operators can be executed morsel-wise via
+ * execute_pipeline(): Each chunk of the first operator's input is passed through all operators of the chain by a
+ * single JobTask, preferably on the NUMA node that holds the chunk. The intermediate result of each operator is a
+ * single chunk, which is wrapped into a table of its own (a morsel) and handed to the next operator right away. Thus,
+ * intermediate results are not materialized as complete tables and are likely still in the caches of the worker.
+ * Pipeline breakers, such as joins, aggregates and sorts, are executed operator-at-a-time as before.
+ */
+class AbstractChunkwiseOperator : public AbstractReadOnlyOperator {
+ public:
+  using AbstractReadOnlyOperator::AbstractReadOnlyOperator;
+
+  /**
+   * Executes a chain of operators, where each operator but the first has its predecessor in the chain as its left
+   * input, morsel-wise. Only the output of the last operator is set, the intermediate operators have no output.
+   */
+  static void execute_pipeline(const std::vector<std::shared_ptr<AbstractChunkwiseOperator>>& pipeline);
+
+  /**
+   * Returns false if the operator has to be executed operator-at-a-time, e.g., because its configuration refers to the
+   * chunks of its complete input table
+   */
+  virtual bool can_be_pipelined() const;
+
+ protected:
+  /**
+   * Called before the chunks of in_table are passed to _on_execute_chunk(). It is not called for morsels.
+   */
+  virtual void _on_prepare_chunks(const std::shared_ptr<const Table>& in_table);
+
+  /**
+   * Processes the chunk chunk_id of in_table, which is either the output of the left input or a morsel within a
+   * pipeline. Returns the columns of the output chunk, which are empty if no row of the chunk remains. Called
+   * concurrently for different chunks.
+   */
+  virtual ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                         const std::shared_ptr<TransactionContext>& transaction_context) = 0;
+};
+
+}  // namespace opossum
@@ -41,6 +41,7 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
@@ -6,6 +6,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -16,7 +17,12 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/create_iterable_from_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fixed_string_dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
@@ -77,6 +83,28 @@ void Aggregate::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 
 void Aggregate::_on_cleanup() { _contexts_per_column.clear(); }
 
+/*
+Returns the dictionary of a DictionaryColumn, FixedStringDictionaryColumn or FrontCodedDictionaryColumn, or nullptr for
+other column types
+*/
+template <typename ColumnDataType>
+std::shared_ptr<const pmr_vector<ColumnDataType>> dictionary_of_column(const BaseColumn& column) {
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<ColumnDataType>*>(&column)) {
+    return dictionary_column->dictionary();
+  }
+
+  if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+    if (const auto dictionary_column = dynamic_cast<const FixedStringDictionaryColumn<std::string>*>(&column)) {
+      return dictionary_column->dictionary();
+    }
+    if (const auto dictionary_column = dynamic_cast<const FrontCodedDictionaryColumn<std::string>*>(&column)) {
+      return dictionary_column->dictionary();
+    }
+  }
+
+  return nullptr;
+}
+
 /*
 Visitor context for the partitioning/grouping visitor
 */
@@ -105,6 +133,10 @@ struct GroupByContext : ColumnVisitorContext {
 /*
 Visitor context for the AggregateVisitor.
 */
+template <typename AggregateKey, typename AggregateType, typename ColumnType>
+using AggregateResultMap =
+    std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>;
+
 template <typename ColumnType, typename AggregateType, typename AggregateKey>
 struct AggregateContext : ColumnVisitorContext {
   AggregateContext() = default;
@@ -120,11 +152,160 @@ struct AggregateContext : ColumnVisitorContext {
     groupby_context->chunk_offsets_in = chunk_offsets;
   }
 
+  using ResultMap = AggregateResultMap<AggregateKey, AggregateType, ColumnType>;
+  using SpilledResults = std::vector<std::pair<AggregateKey, AggregateResult<AggregateType, ColumnType>>>;
+
   std::shared_ptr<GroupByContext<AggregateKey>> groupby_context;
-  std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-      results;
+
+  // Thread-local pre-aggregation table of a job, see _aggregate()
+  std::shared_ptr<ResultMap> results;
+
+  // Groups spilled from `results`, one vector per radix partition. Only used in the contexts of the jobs.
+  std::vector<SpilledResults> spilled_partitions;
+
+  // Merged groups, one map per radix partition. Only used in the final contexts (_contexts_per_column). The result of
+  // the aggregation is the concatenation of all partitions.
+  std::vector<ResultMap> result_partitions;
 };
 
+// Returns the number of groups in the partitioned results of an aggregate
+template <typename AggregateKey, typename AggregateType, typename ColumnType>
+size_t result_count(const std::vector<AggregateResultMap<AggregateKey, AggregateType, ColumnType>>& result_partitions) {
+  auto count = size_t{0};
+  for (const auto& results : result_partitions) count += results.size();
+  return count;
+}
+
+/*
+Calls functor(column_index, function, context) for each context in `contexts`, with the AggregateFunction passed as an
+std::integral_constant and the context cast to its actual AggregateContext type. If there are no aggregates, the dummy
+context of the DISTINCT implementation is passed as a COUNT context, as only its row ids and counts matter.
+*/
+template <typename AggregateKey, typename Functor>
+void for_each_aggregate_context(const std::vector<AggregateColumnDefinition>& aggregates, const Table& input_table,
+                                const std::vector<std::shared_ptr<ColumnVisitorContext>>& contexts,
+                                const Functor& functor) {
+  using CountFunction = std::integral_constant<AggregateFunction, AggregateFunction::Count>;
+
+  if (aggregates.empty()) {
+    functor(ColumnID{0}, CountFunction{},
+            static_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>&>(*contexts[0]));
+    return;
+  }
+
+  for (ColumnID column_index{0}; column_index < aggregates.size(); ++column_index) {
+    const auto& aggregate = aggregates[column_index];
+
+    if (!aggregate.column) {
+      // COUNT(*)
+      auto& context = *contexts[column_index];
+      functor(column_index, CountFunction{},
+              static_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>&>(context));
+      continue;
+    }
+
+    resolve_data_type(input_table.column_data_type(*aggregate.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto call_functor = [&](auto function) {
+        using AggregateType = typename AggregateTraits<ColumnDataType, decltype(function)::value>::AggregateType;
+        functor(column_index, function,
+                static_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(*contexts[column_index]));
+      };
+
+      switch (aggregate.function) {
+        case AggregateFunction::Min:
+          call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+          break;
+        case AggregateFunction::Max:
+          call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+          break;
+        case AggregateFunction::Sum:
+          call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+          break;
+        case AggregateFunction::Avg:
+          call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+          break;
+        case AggregateFunction::Count:
+          call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+          break;
+        case AggregateFunction::CountDistinct:
+          call_functor(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+          break;
+      }
+    });
+  }
+}
+
+/*
+Merges the partial aggregate `source` of a group into the partial aggregate `target` of the same group. The row_id of
+`target` is kept, as any row of the group can be used to write the group-by columns.
+*/
+template <AggregateFunction function, typename AggregateType, typename ColumnType>
+void merge_aggregate_result(AggregateResult<AggregateType, ColumnType>& target,
+                            AggregateResult<AggregateType, ColumnType>& source) {
+  if (source.current_aggregate) {
+    if (!target.current_aggregate) {
+      target.current_aggregate = std::move(source.current_aggregate);
+    } else {
+      if constexpr (function == AggregateFunction::Min) {
+        if (value_smaller(*source.current_aggregate, *target.current_aggregate)) {
+          target.current_aggregate = std::move(source.current_aggregate);
+        }
+      }
+      if constexpr (function == AggregateFunction::Max) {
+        if (value_greater(*source.current_aggregate, *target.current_aggregate)) {
+          target.current_aggregate = std::move(source.current_aggregate);
+        }
+      }
+      if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        *target.current_aggregate += *source.current_aggregate;
+      }
+    }
+  }
+
+  target.aggregate_count += source.aggregate_count;
+
+  if constexpr (function == AggregateFunction::CountDistinct) {
+    target.distinct_values.insert(source.distinct_values.begin(), source.distinct_values.end());
+  }
+}
+
+/*
+Calls functor(get_result) for a chunk, where get_result(key) returns the AggregateResult of the group of a row's key.
+If `dense_group_ids` is empty, the results are looked up in `results`. Otherwise, the keys of the chunk are the value
+IDs of its dictionary-encoded group-by column. The rows are then accumulated in a vector indexed by value ID, which is
+merged into `results` once per chunk by mapping each value ID to its group ID. As all aggregates of a chunk visit the
+same rows, the groups are inserted into the tables of all aggregates in the same order.
+*/
+template <AggregateFunction function, typename ResultMap, typename Functor>
+void accumulate_groups(ResultMap& results, const std::vector<AggregateKeyEntry>& dense_group_ids,
+                       const Functor& functor) {
+  using AggregateKey = typename ResultMap::key_type;
+  using Result = typename ResultMap::mapped_type;
+
+  if (dense_group_ids.empty()) {
+    functor([&](const AggregateKey& key) -> Result& { return results[key]; });
+    return;
+  }
+
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+    auto dense_results = std::vector<Result>(dense_group_ids.size());
+    functor([&](const AggregateKey& value_id) -> Result& { return dense_results[value_id]; });
+
+    for (auto value_id = size_t{0}; value_id < dense_results.size(); ++value_id) {
+      auto& result = dense_results[value_id];
+      // No row of the chunk has this value
+      if (result.row_id.is_null()) continue;
+
+      auto [it, inserted] = results.try_emplace(dense_group_ids[value_id], std::move(result));  // NOLINT
+      if (!inserted) merge_aggregate_result<function>(it->second, result);
+    }
+  } else {
+    Fail("Dense aggregation requires a single group-by column");
+  }
+}
+
 /*
 The AggregateFunctionBuilder is used to create the lambda function that will be used by
 the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
@@ -199,48 +380,158 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Co
 };
 
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-void Aggregate::_aggregate_column(ChunkID chunk_id, ColumnID column_index, const BaseColumn& base_column,
-                                  const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+void Aggregate::_aggregate_column(ChunkID chunk_id, const BaseColumn& base_column,
+                                  const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                  const std::vector<AggregateKeyEntry>& dense_group_ids,
+                                  ColumnVisitorContext& aggregate_context) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  auto& context = static_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(aggregate_context);
 
-  auto& results = *context.results;
   const auto& hash_keys = keys_per_chunk[chunk_id];
 
-  resolve_column_type<ColumnDataType>(
-      base_column, [&results, &hash_keys, chunk_id, aggregator](const auto& typed_column) {
-        auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+  accumulate_groups<function>(*context.results, dense_group_ids, [&](const auto& get_result) {
+    resolve_column_type<ColumnDataType>(base_column, [&](const auto& typed_column) {
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
 
-        ChunkOffset chunk_offset{0};
+      ChunkOffset chunk_offset{0};
 
-        // Now that all relevant types have been resolved, we can iterate over the column and build the aggregations.
-        iterable.for_each([&, chunk_id, aggregator](const auto& value) {
-          auto& hash_entry = results[hash_keys[chunk_offset]];
-          hash_entry.row_id = RowID(chunk_id, chunk_offset);
+      // Now that all relevant types have been resolved, we can iterate over the column and build the aggregations.
+      iterable.for_each([&, chunk_id, aggregator](const auto& value) {
+        auto& hash_entry = get_result(hash_keys[chunk_offset]);
+        hash_entry.row_id = RowID(chunk_id, chunk_offset);
 
-          /**
-          * If the value is NULL, the current aggregate value does not change.
-          */
-          if (!value.is_null()) {
-            // If we have a value, use the aggregator lambda to update the current aggregate value for this group
-            hash_entry.current_aggregate = aggregator(value.value(), hash_entry.current_aggregate);
+        /**
+        * If the value is NULL, the current aggregate value does not change.
+        */
+        if (!value.is_null()) {
+          // If we have a value, use the aggregator lambda to update the current aggregate value for this group
+          hash_entry.current_aggregate = aggregator(value.value(), hash_entry.current_aggregate);
 
-            // increase value counter
-            ++hash_entry.aggregate_count;
+          // increase value counter
+          ++hash_entry.aggregate_count;
 
-            if (function == AggregateFunction::CountDistinct) {
-              // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-              hash_entry.distinct_values.insert(value.value());
-            }
+          if (function == AggregateFunction::CountDistinct) {
+            // for the case of CountDistinct, insert this value into the set to keep track of distinct values
+            hash_entry.distinct_values.insert(value.value());
           }
+        }
 
-          ++chunk_offset;
+        ++chunk_offset;
+      });
+    });
+  });
+}
+
+template <typename AggregateKey>
+void Aggregate::_aggregate_chunk(const ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                 const std::vector<AggregateKeyEntry>& dense_group_ids,
+                                 const std::vector<std::shared_ptr<ColumnVisitorContext>>& contexts) {
+  const auto input_table = input_table_left();
+  auto chunk_in = input_table->get_chunk(chunk_id);
+
+  const auto& hash_keys = keys_per_chunk[chunk_id];
+
+  if (_aggregates.empty()) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+     *
+     * For a query like "SELECT DISTINCT * FROM A;"
+     * we would assume that all columns from A are part of 'groupby_columns',
+     * respectively any columns that were specified in the projection.
+     * The optimizer is responsible to take care of passing in the correct columns.
+     *
+     * How does this operation work?
+     * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
+     * these vectors are used as keys in the 'column_results' map.
+     *
+     * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
+     * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
+     * One could optimize here in the future.
+     *
+     * Obviously this implementation is also used for plain GroupBy's.
+     */
+
+    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
+        contexts[0]);
+    accumulate_groups<AggregateFunction::Count>(*context->results, dense_group_ids, [&](const auto& get_result) {
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_in->size(); chunk_offset++) {
+        get_result(hash_keys[chunk_offset]).row_id = RowID(chunk_id, chunk_offset);
+      }
+    });
+  } else {
+    ColumnID column_index{0};
+    for (const auto& aggregate : _aggregates) {
+      /**
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+       * We then go through the keys_per_chunk map and count the occurrences of each group key.
+       * The results are saved in the regular aggregate_count variable so that we don't need a
+       * specific output logic for COUNT(*).
+       */
+      if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+        auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+            contexts[column_index]);
+
+        // count occurrences for each group key
+        accumulate_groups<AggregateFunction::Count>(*context->results, dense_group_ids, [&](const auto& get_result) {
+          for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_in->size(); chunk_offset++) {
+            auto& hash_entry = get_result(hash_keys[chunk_offset]);
+            hash_entry.row_id = RowID(chunk_id, chunk_offset);
+            ++hash_entry.aggregate_count;
+          }
         });
+
+        ++column_index;
+        continue;
+      }
+
+      auto base_column = chunk_in->get_column(*aggregate.column);
+      auto data_type = input_table->column_data_type(*aggregate.column);
+      auto& context = *contexts[column_index];
+
+      /*
+      Invoke correct aggregator for each column
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate.function) {
+          case AggregateFunction::Min:
+            _aggregate_column<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                chunk_id, *base_column, keys_per_chunk, dense_group_ids, context);
+            break;
+          case AggregateFunction::Max:
+            _aggregate_column<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                chunk_id, *base_column, keys_per_chunk, dense_group_ids, context);
+            break;
+          case AggregateFunction::Sum:
+            _aggregate_column<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                chunk_id, *base_column, keys_per_chunk, dense_group_ids, context);
+            break;
+          case AggregateFunction::Avg:
+            _aggregate_column<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                chunk_id, *base_column, keys_per_chunk, dense_group_ids, context);
+            break;
+          case AggregateFunction::Count:
+            _aggregate_column<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                chunk_id, *base_column, keys_per_chunk, dense_group_ids, context);
+            break;
+          case AggregateFunction::CountDistinct:
+            _aggregate_column<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
+                chunk_id, *base_column, keys_per_chunk, dense_group_ids, context);
+            break;
+        }
       });
+
+      ++column_index;
+    }
+  }
 }
 
 template <typename AggregateKey>
@@ -318,12 +609,17 @@ void Aggregate::_aggregate() {
                        " was not enough and a second buffer was needed");
   }
 
+  // For each chunk that is aggregated densely, the mapping from the value IDs of its group-by column to the group IDs.
+  // Empty for all other chunks.
+  auto dense_group_ids_per_chunk = std::vector<std::vector<AggregateKeyEntry>>(input_table->chunk_count());
+
   // Now that we have the data structures in place, we can start the actual work
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(_groupby_column_ids.size());
 
   for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, this]() {
+    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk,
+                                                 &dense_group_ids_per_chunk, this]() {
       const auto column_id = _groupby_column_ids.at(group_column_index);
       const auto data_type = input_table->column_data_type(column_id);
 
@@ -341,6 +637,48 @@ void Aggregate::_aggregate() {
           const auto chunk_in = input_table->get_chunk(chunk_id);
           const auto base_column = chunk_in->get_column(column_id);
 
+          /*
+          Fast path for dictionary-encoded columns: Instead of looking up the value of every row in id_map, each entry
+          of the chunk's dictionary is looked up once. This yields a dense mapping from value ID to group ID, so that
+          the rows can be mapped using their value IDs without any hashing.
+          */
+          if (const auto dictionary = dictionary_of_column<ColumnDataType>(*base_column)) {
+            const auto& dictionary_column = static_cast<const BaseDictionaryColumn&>(*base_column);
+
+            // The NULL value ID is usually the size of the dictionary. A FixedStringDictionaryColumn that only holds
+            // NULLs has an empty dictionary, but still uses 1 as its NULL value ID.
+            const auto null_value_id = static_cast<size_t>(dictionary_column.null_value_id());
+            DebugAssert(null_value_id >= dictionary->size(), "Unexpected NULL value ID");
+
+            // All entries from the dictionary size up to the NULL value ID do not belong to a value and stay 0
+            auto group_ids = std::vector<AggregateKeyEntry>(null_value_id + 1, 0u);
+            for (ValueID value_id{0}; value_id < dictionary->size(); ++value_id) {
+              const auto inserted = id_map.try_emplace((*dictionary)[value_id], id_counter);
+              group_ids[value_id] = inserted.first->second;
+              if (inserted.second) ++id_counter;
+            }
+
+            // With a single group-by column and a small dictionary, the chunk is aggregated densely by value ID (see
+            // accumulate_groups()). Its keys are the value IDs then, which are mapped to the group IDs afterwards.
+            const auto aggregate_densely = std::is_same_v<AggregateKey, AggregateKeyEntry> &&
+                                           null_value_id <= DENSE_AGGREGATION_MAX_DICTIONARY_SIZE;
+
+            resolve_compressed_vector_type(*dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+              ChunkOffset chunk_offset{0};
+              for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+                   ++value_id_it, ++chunk_offset) {
+                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                  keys_per_chunk[chunk_id][chunk_offset] = aggregate_densely ? *value_id_it : group_ids[*value_id_it];
+                } else {
+                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = group_ids[*value_id_it];
+                }
+              }
+            });
+
+            if (aggregate_densely) dense_group_ids_per_chunk[chunk_id] = std::move(group_ids);
+            continue;
+          }
+
           resolve_column_type<ColumnDataType>(*base_column, [&](auto& typed_column) {
             auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
 
@@ -378,149 +716,132 @@ void Aggregate::_aggregate() {
 
   /*
   AGGREGATION PHASE
+  The aggregation is performed in two phases, so that it scales with the number of workers:
+
+  (1) Pre-aggregation: The chunks are split into ranges of consecutive chunks, one JobTask each. A job aggregates its
+      chunks into its own, thread-local hash table per aggregate column (AggregateContext::results). Once that table
+      holds PRE_AGGREGATION_TABLE_CAPACITY groups, it is spilled: its groups are moved into radix partitions (chosen by
+      the hash of the group key) and the table is cleared. This keeps the table small and cache-resident even for a
+      high number of groups, while inputs with few groups are almost completely aggregated thread-locally.
+  (2) Merge: One JobTask per radix partition merges the spilled partial aggregates of all jobs. As each group is
+      contained in exactly one partition, the partitions can be merged independently and without synchronization.
+
+  The output is written per aggregate column by iterating over the result maps of its context. The iteration order of
+  all maps has to be the same, so that the rows match up. This holds because all maps of a job contain the same groups
+  (each row creates an entry in the map of every aggregate column), are spilled at the same time, and are merged in the
+  same order.
   */
-  _contexts_per_column = std::vector<std::shared_ptr<ColumnVisitorContext>>(_aggregates.size());
-
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
+  const auto chunk_count = static_cast<size_t>(input_table->chunk_count());
+  const auto job_count = std::max(size_t{1}, std::min(chunk_count, Topology::get().num_cpus()));
 
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    context->results =
-        std::make_shared<std::unordered_map<AggregateKey, AggregateResult<DistinctAggregateType, DistinctColumnType>,
-                                            std::hash<AggregateKey>>>();
-
-    _contexts_per_column.push_back(context);
+  // With a single job, its pre-aggregation table already holds the final result and there is nothing to merge
+  auto partition_count = size_t{1};
+  if (job_count > 1) {
+    while (partition_count < job_count) partition_count <<= 1;
   }
+  const auto partition_mask = partition_count - 1;
 
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
-    const auto& aggregate = _aggregates[column_id];
-    if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      context->results =
-          std::make_shared<std::unordered_map<AggregateKey, AggregateResult<CountAggregateType, CountColumnType>,
-                                              std::hash<AggregateKey>>>();
-      _contexts_per_column[column_id] = context;
-      continue;
-    }
-    auto data_type = input_table->column_data_type(*aggregate.column);
-    _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
-  }
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
 
-  // Process Chunks and perform aggregations
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    auto chunk_in = input_table->get_chunk(chunk_id);
-
-    const auto& hash_keys = keys_per_chunk[chunk_id];
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
-      auto& results = *context->results;
+  auto contexts_per_job = std::vector<std::vector<std::shared_ptr<ColumnVisitorContext>>>(job_count);
+  for (auto& contexts : contexts_per_job) {
+    contexts = _create_aggregate_contexts<AggregateKey>();
+    for_each_aggregate_context<AggregateKey>(_aggregates, *input_table, contexts,
+                                             [&](const ColumnID, auto, auto& context) {
+                                               context.spilled_partitions.resize(partition_count);
+                                             });
+  }
 
-      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_in->size(); chunk_offset++) {
-        results[hash_keys[chunk_offset]].row_id = RowID(chunk_id, chunk_offset);
-      }
-    } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[column_index]);
-
-          auto& results = *context->results;
-
-          // count occurrences for each group key
-          for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_in->size(); chunk_offset++) {
-            auto& hash_entry = results[hash_keys[chunk_offset]];
-            hash_entry.row_id = RowID(chunk_id, chunk_offset);
-            ++hash_entry.aggregate_count;
+  // Moves all groups of the pre-aggregation tables into the radix partitions of the job
+  const auto spill = [&](const std::vector<std::shared_ptr<ColumnVisitorContext>>& contexts) {
+    for_each_aggregate_context<AggregateKey>(
+        _aggregates, *input_table, contexts, [&](const ColumnID, auto, auto& context) {
+          for (auto& [key, result] : *context.results) {  // NOLINT
+            const auto partition_id = std::hash<AggregateKey>{}(key) & partition_mask;
+            context.spilled_partitions[partition_id].emplace_back(key, std::move(result));
           }
-
-          ++column_index;
-          continue;
+          context.results->clear();
+        });
+  };
+
+  // All pre-aggregation tables of a job hold the same groups, so checking the first one is sufficient
+  const auto pre_aggregation_group_count = [&](const std::vector<std::shared_ptr<ColumnVisitorContext>>& contexts) {
+    auto group_count = size_t{0};
+    for_each_aggregate_context<AggregateKey>(_aggregates, *input_table, contexts,
+                                             [&](const ColumnID column_index, auto, auto& context) {
+                                               if (column_index == 0) group_count = context.results->size();
+                                             });
+    return group_count;
+  };
+
+  std::vector<std::shared_ptr<AbstractTask>> aggregate_jobs;
+  aggregate_jobs.reserve(job_count);
+
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    const auto first_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * job_id / job_count)};
+    const auto last_chunk_id = ChunkID{static_cast<uint32_t>(chunk_count * (job_id + 1) / job_count)};
+
+    aggregate_jobs.emplace_back(std::make_shared<JobTask>([&, job_id, first_chunk_id, last_chunk_id]() {
+      const auto& contexts = contexts_per_job[job_id];
+
+      // Process Chunks and perform aggregations
+      for (auto chunk_id = first_chunk_id; chunk_id < last_chunk_id; ++chunk_id) {
+        _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, dense_group_ids_per_chunk[chunk_id], contexts);
+
+        if (partition_count > 1 && pre_aggregation_group_count(contexts) >= PRE_AGGREGATION_TABLE_CAPACITY) {
+          spill(contexts);
         }
+      }
 
-        auto base_column = chunk_in->get_column(*aggregate.column);
-        auto data_type = input_table->column_data_type(*aggregate.column);
+      if (partition_count > 1) spill(contexts);
+    }));
+    aggregate_jobs.back()->schedule();
+  }
 
-        /*
-        Invoke correct aggregator for each column
-        */
+  CurrentScheduler::wait_for_tasks(aggregate_jobs);
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate.function) {
-            case AggregateFunction::Min:
-              _aggregate_column<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, column_index,
-                                                                                      *base_column, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_column<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, column_index,
-                                                                                      *base_column, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_column<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, column_index,
-                                                                                      *base_column, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_column<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, column_index,
-                                                                                      *base_column, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_column<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, column_index,
-                                                                                        *base_column, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_column<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, column_index, *base_column, keys_per_chunk);
-              break;
-          }
-        });
+  if (partition_count == 1) {
+    for_each_aggregate_context<AggregateKey>(_aggregates, *input_table, _contexts_per_column,
+                                             [&](const ColumnID column_index, auto, auto& context) {
+                                               using Context = std::decay_t<decltype(context)>;
+                                               auto& job_context =
+                                                   static_cast<Context&>(*contexts_per_job[0][column_index]);
+                                               context.result_partitions.emplace_back(std::move(*job_context.results));
+                                             });
+  } else {
+    for_each_aggregate_context<AggregateKey>(
+        _aggregates, *input_table, _contexts_per_column,
+        [&](const ColumnID, auto, auto& context) { context.result_partitions.resize(partition_count); });
+
+    std::vector<std::shared_ptr<AbstractTask>> merge_jobs;
+    merge_jobs.reserve(partition_count);
+
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      merge_jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        for_each_aggregate_context<AggregateKey>(
+            _aggregates, *input_table, _contexts_per_column,
+            [&](const ColumnID column_index, auto function, auto& context) {
+              using Context = std::decay_t<decltype(context)>;
+              auto& merged_results = context.result_partitions[partition_id];
+
+              for (const auto& job_contexts : contexts_per_job) {
+                auto& spilled_results =
+                    static_cast<Context&>(*job_contexts[column_index]).spilled_partitions[partition_id];
+
+                for (auto& [key, result] : spilled_results) {  // NOLINT
+                  auto [it, inserted] = merged_results.try_emplace(key, std::move(result));  // NOLINT
+                  if (!inserted) merge_aggregate_result<decltype(function)::value>(it->second, result);
+                }
 
-        ++column_index;
-      }
+                // Free the memory of the spilled groups as early as possible
+                spilled_results = typename Context::SpilledResults{};
+              }
+            });
+      }));
+      merge_jobs.back()->schedule();
     }
+
+    CurrentScheduler::wait_for_tasks(merge_jobs);
   }
 
   // add group by columns
@@ -545,9 +866,11 @@ void Aggregate::_aggregate() {
     auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
         _contexts_per_column[0]);
     auto pos_list = PosList();
-    pos_list.reserve(context->results->size());
-    for (auto& map : *context->results) {
-      pos_list.push_back(map.second.row_id);
+    pos_list.reserve(result_count(context->result_partitions));
+    for (const auto& results : context->result_partitions) {
+      for (const auto& map : results) {
+        pos_list.push_back(map.second.row_id);
+      }
     }
     _write_groupby_output(pos_list);
   }
@@ -600,31 +923,33 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
 /*
 The following template functions write the aggregated values for the different aggregate functions.
 They are separate and templated to avoid compiler errors for invalid type/function combinations.
+The values are written partition by partition, in the same order in which the group-by columns are written.
 */
 // MIN, MAX, SUM write the current aggregated value
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<
     func == AggregateFunction::Min || func == AggregateFunction::Max || func == AggregateFunction::Sum, void>::type
-write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
-                       std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>,
-                                                          std::hash<AggregateKey>>>
-                           results) {
+write_aggregate_values(
+    std::shared_ptr<ValueColumn<AggregateType>> column,
+    const std::vector<AggregateResultMap<AggregateKey, AggregateType, ColumnType>>& result_partitions) {
   DebugAssert(column->is_nullable(), "Aggregate: Output column needs to be nullable");
 
   auto& values = column->values();
   auto& null_values = column->null_values();
 
-  values.resize(results->size());
-  null_values.resize(results->size());
+  values.resize(result_count(result_partitions));
+  null_values.resize(result_count(result_partitions));
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+  for (const auto& results : result_partitions) {
+    for (auto& kv : results) {
+      null_values[i] = !kv.second.current_aggregate;
 
-    if (kv.second.current_aggregate) {
-      values[i] = *kv.second.current_aggregate;
+      if (kv.second.current_aggregate) {
+        values[i] = *kv.second.current_aggregate;
+      }
+      ++i;
     }
-    ++i;
   }
 }
 
@@ -632,18 +957,18 @@ write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::Count, void>::type write_aggregate_values(
     std::shared_ptr<ValueColumn<AggregateType>> column,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-        results) {
+    const std::vector<AggregateResultMap<AggregateKey, AggregateType, ColumnType>>& result_partitions) {
   DebugAssert(!column->is_nullable(), "Aggregate: Output column for COUNT shouldn't be nullable");
 
   auto& values = column->values();
-  values.resize(results->size());
+  values.resize(result_count(result_partitions));
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    values[i] = kv.second.aggregate_count;
-    ++i;
+  for (const auto& results : result_partitions) {
+    for (auto& kv : results) {
+      values[i] = kv.second.aggregate_count;
+      ++i;
+    }
   }
 }
 
@@ -651,44 +976,45 @@ typename std::enable_if<func == AggregateFunction::Count, void>::type write_aggr
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::CountDistinct, void>::type write_aggregate_values(
     std::shared_ptr<ValueColumn<AggregateType>> column,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-        results) {
+    const std::vector<AggregateResultMap<AggregateKey, AggregateType, ColumnType>>& result_partitions) {
   DebugAssert(!column->is_nullable(), "Aggregate: Output column for COUNT shouldn't be nullable");
 
   auto& values = column->values();
-  values.resize(results->size());
+  values.resize(result_count(result_partitions));
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    values[i] = kv.second.distinct_values.size();
-    ++i;
+  for (const auto& results : result_partitions) {
+    for (auto& kv : results) {
+      values[i] = kv.second.distinct_values.size();
+      ++i;
+    }
   }
 }
 
 // AVG writes the calculated average from current aggregate and the aggregate counter
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::Avg && std::is_arithmetic<AggregateType>::value, void>::type
-write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
-                       std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>,
-                                                          std::hash<AggregateKey>>>
-                           results) {
+write_aggregate_values(
+    std::shared_ptr<ValueColumn<AggregateType>> column,
+    const std::vector<AggregateResultMap<AggregateKey, AggregateType, ColumnType>>& result_partitions) {
   DebugAssert(column->is_nullable(), "Aggregate: Output column needs to be nullable");
 
   auto& values = column->values();
   auto& null_values = column->null_values();
 
-  values.resize(results->size());
-  null_values.resize(results->size());
+  values.resize(result_count(result_partitions));
+  null_values.resize(result_count(result_partitions));
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+  for (const auto& results : result_partitions) {
+    for (auto& kv : results) {
+      null_values[i] = !kv.second.current_aggregate;
 
-    if (kv.second.current_aggregate) {
-      values[i] = *kv.second.current_aggregate / static_cast<AggregateType>(kv.second.aggregate_count);
+      if (kv.second.current_aggregate) {
+        values[i] = *kv.second.current_aggregate / static_cast<AggregateType>(kv.second.aggregate_count);
+      }
+      ++i;
     }
-    ++i;
   }
 }
 
@@ -696,8 +1022,7 @@ write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>> column,
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::Avg && !std::is_arithmetic<AggregateType>::value, void>::type
 write_aggregate_values(std::shared_ptr<ValueColumn<AggregateType>>,
-                       std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>,
-                                                          std::hash<AggregateKey>>>) {
+                       const std::vector<AggregateResultMap<AggregateKey, AggregateType, ColumnType>>&) {
   Fail("Invalid aggregate");
 }
 
@@ -780,17 +1105,19 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   // write all group keys into the respective columns
   if (column_index == 0) {
     auto pos_list = PosList();
-    pos_list.reserve(context->results->size());
-    for (auto& map : *context->results) {
-      pos_list.push_back(map.second.row_id);
+    pos_list.reserve(result_count(context->result_partitions));
+    for (const auto& results : context->result_partitions) {
+      for (const auto& map : results) {
+        pos_list.push_back(map.second.row_id);
+      }
     }
     _write_groupby_output(pos_list);
   }
 
   // write aggregated values into the column
-  if (!context->results->empty()) {
+  if (result_count(context->result_partitions) > 0) {
     write_aggregate_values<ColumnType, decltype(aggregate_type), function, AggregateKey>(output_column,
-                                                                                         context->results);
+                                                                                         context->result_partitions);
   } else if (_groupby_columns.empty()) {
     // If we did not GROUP BY anything and we have no results, we need to add NULL for most aggregates and 0 for count
     output_column->values().push_back(decltype(aggregate_type){});
@@ -802,6 +1129,49 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   _output_columns.push_back(output_column);
 }
 
+template <typename AggregateKey>
+std::vector<std::shared_ptr<ColumnVisitorContext>> Aggregate::_create_aggregate_contexts() const {
+  auto contexts = std::vector<std::shared_ptr<ColumnVisitorContext>>(_aggregates.size());
+
+  if (_aggregates.empty()) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, _contexts_per_column will always have at least one context with results.
+    This is important later on when we write the group keys into the table.
+
+    We choose int8_t for column type and aggregate type because it's small.
+    */
+    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
+    context->results =
+        std::make_shared<std::unordered_map<AggregateKey, AggregateResult<DistinctAggregateType, DistinctColumnType>,
+                                            std::hash<AggregateKey>>>();
+
+    contexts.push_back(context);
+  }
+
+  /**
+   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
+   * created on. We do this here, and not in the per-chunk-loop, because there might be no Chunks in the input
+   * and _write_aggregate_output() needs these contexts anyway.
+   */
+  for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
+    const auto& aggregate = _aggregates[column_id];
+    if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
+      context->results =
+          std::make_shared<std::unordered_map<AggregateKey, AggregateResult<CountAggregateType, CountColumnType>,
+                                              std::hash<AggregateKey>>>();
+      contexts[column_id] = context;
+      continue;
+    }
+    auto data_type = input_table_left()->column_data_type(*aggregate.column);
+    contexts[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
+  }
+
+  return contexts;
+}
+
 template <typename AggregateKey>
 std::shared_ptr<ColumnVisitorContext> Aggregate::_create_aggregate_context(const DataType data_type,
                                                                            const AggregateFunction function) const {
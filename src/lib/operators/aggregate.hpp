@@ -103,6 +103,13 @@ class Aggregate : public AbstractReadOnlyOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  // Aggregates a single chunk into the thread-local pre-aggregation tables of a job. If `dense_group_ids` is not
+  // empty, the chunk is aggregated densely by the value IDs of its group-by column (see _aggregate()).
+  template <typename AggregateKey>
+  void _aggregate_chunk(const ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        const std::vector<AggregateKeyEntry>& dense_group_ids,
+                        const std::vector<std::shared_ptr<ColumnVisitorContext>>& contexts);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -130,8 +137,14 @@ class Aggregate : public AbstractReadOnlyOperator {
   void _write_groupby_output(PosList& pos_list);
 
   template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-  void _aggregate_column(ChunkID chunk_id, ColumnID column_index, const BaseColumn& base_column,
-                         const KeysPerChunk<AggregateKey>& keys_per_chunk);
+  void _aggregate_column(ChunkID chunk_id, const BaseColumn& base_column,
+                         const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                         const std::vector<AggregateKeyEntry>& dense_group_ids,
+                         ColumnVisitorContext& aggregate_context);
+
+  // Creates one AggregateContext per aggregate (or the dummy context for DISTINCT, see _aggregate())
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<ColumnVisitorContext>> _create_aggregate_contexts() const;
 
   template <typename AggregateKey>
   std::shared_ptr<ColumnVisitorContext> _create_aggregate_context(const DataType data_type,
@@ -140,6 +153,14 @@ class Aggregate : public AbstractReadOnlyOperator {
   template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
   std::shared_ptr<ColumnVisitorContext> _create_aggregate_context_impl() const;
 
+  // Number of groups a job's thread-local pre-aggregation table may hold before it is spilled to the radix partitions.
+  // Chosen so that the table of a single aggregate column stays within the L2 cache for small aggregate types.
+  static constexpr auto PRE_AGGREGATION_TABLE_CAPACITY = size_t{16384};
+
+  // Maximum dictionary size of a dictionary-encoded group-by column for which a chunk is aggregated into a vector
+  // indexed by value ID instead of the pre-aggregation tables. Only used for a single group-by column.
+  static constexpr auto DENSE_AGGREGATION_MAX_DICTIONARY_SIZE = size_t{1024};
+
   const std::vector<AggregateColumnDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
 
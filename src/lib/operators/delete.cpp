@@ -4,6 +4,7 @@
 #include <string>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/logger.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
@@ -61,11 +62,23 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 }
 
 void Delete::_on_commit_records(const CommitID cid) {
+  // The invalidations are logged before the TransactionContext logs the Commit record
+  auto& logger = Logger::get();
+  if (logger.is_enabled()) {
+    for (const auto& pos_list : _pos_lists) {
+      for (const auto& row_id : *pos_list) {
+        logger.log_invalidation(_transaction_id, _table_name, row_id);
+      }
+    }
+  }
+
   for (const auto& pos_list : _pos_lists) {
     for (const auto& row_id : *pos_list) {
       auto chunk = _table->get_chunk(row_id.chunk_id);
 
-      chunk->get_scoped_mvcc_columns_lock()->end_cids[row_id.chunk_offset] = cid;
+      auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
+      mvcc_columns->end_cids[row_id.chunk_offset] = cid;
+      mvcc_columns->register_invalidated_row(cid);
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
   }
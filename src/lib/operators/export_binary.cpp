@@ -1,16 +1,20 @@
 #include "export_binary.hpp"
 
+#include <array>
 #include <cstring>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "import_export/binary.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -108,6 +112,16 @@ template <typename T>
 void export_value(std::ofstream& ofstream, const T& value) {
   ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
+
+// Writes zeros up to the next multiple of BINARY_FILE_ALIGNMENT, so that the following values can be mapped on import
+void export_padding(std::ofstream& ofstream) {
+  static const auto zeros = std::array<char, opossum::BINARY_FILE_ALIGNMENT>{};
+
+  const auto offset = static_cast<size_t>(ofstream.tellp());
+  const auto padding = (opossum::BINARY_FILE_ALIGNMENT - offset % opossum::BINARY_FILE_ALIGNMENT) %
+                       opossum::BINARY_FILE_ALIGNMENT;
+  ofstream.write(zeros.data(), padding);
+}
 }  // namespace
 
 namespace opossum {
@@ -141,6 +155,8 @@ std::shared_ptr<AbstractOperator> ExportBinary::_on_deep_copy(
 void ExportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 void ExportBinary::_write_header(const std::shared_ptr<const Table>& table, std::ofstream& ofstream) {
+  ofstream.write(BINARY_FILE_MAGIC_NUMBER, sizeof(BINARY_FILE_MAGIC_NUMBER));
+  export_value(ofstream, BINARY_FILE_VERSION);
   export_value(ofstream, static_cast<ChunkOffset>(table->max_chunk_size()));
   export_value(ofstream, static_cast<ChunkID>(table->chunk_count()));
   export_value(ofstream, static_cast<ColumnID>(table->column_count()));
@@ -203,36 +219,24 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_column(const ReferenceColumn&
 
   // Unfortunately, we have to iterate over all values of the reference column
   // to materialize its contents. Then we can write them to the file
+  auto values = std::vector<T>(ref_column.size());
+  auto null_values = std::vector<bool>(ref_column.size());
   for (ChunkOffset row = 0; row < ref_column.size(); ++row) {
-    export_value(context->ofstream, type_cast<T>(ref_column[row]));
+    const auto value = ref_column[row];
+    if (variant_is_null(value)) {
+      null_values[row] = true;
+    } else {
+      values[row] = type_cast<T>(value);
+    }
   }
-}
-
-// handle_column implementation for string columns
-template <>
-void ExportBinary::ExportBinaryVisitor<std::string>::handle_column(const ReferenceColumn& ref_column,
-                                                                   std::shared_ptr<ColumnVisitorContext> base_context) {
-  auto context = std::static_pointer_cast<ExportContext>(base_context);
-
-  // We materialize reference columns and save them as value columns
-  export_value(context->ofstream, BinaryColumnType::value_column);
 
-  // If there is no data, we can skip all of the coming steps.
-  if (ref_column.size() == 0) return;
-
-  std::stringstream values;
-  std::string value;
-  std::vector<size_t> string_lengths(ref_column.size());
-
-  // We export the values materialized
-  for (ChunkOffset row = 0; row < ref_column.size(); ++row) {
-    value = type_cast<std::string>(ref_column[row]);
-    string_lengths[row] = value.length();
-    values << value;
+  // Like a ValueColumn, the column has a null value vector if the referenced column is nullable. NULL_ROW_IDs are
+  // exported as the default value of T if the column is not nullable.
+  if (ref_column.referenced_table()->column_is_nullable(ref_column.referenced_column_id())) {
+    export_values(context->ofstream, null_values);
   }
 
-  export_values(context->ofstream, string_lengths);
-  context->ofstream << values.rdbuf();
+  export_values(context->ofstream, values);
 }
 
 template <typename T>
@@ -240,38 +244,43 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_column(const BaseDictionaryCol
                                                          std::shared_ptr<ColumnVisitorContext> base_context) {
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
-  const auto is_fixed_size_byte_aligned = [&]() {
+  const auto attribute_vector_width = [&]() {
     switch (base_column.compressed_vector_type()) {
       case CompressedVectorType::FixedSize4ByteAligned:
+        return AttributeVectorWidth{4u};
       case CompressedVectorType::FixedSize2ByteAligned:
+        return AttributeVectorWidth{2u};
       case CompressedVectorType::FixedSize1ByteAligned:
-        return true;
+        return AttributeVectorWidth{1u};
+      case CompressedVectorType::SimdBp128:
+        return SIMD_BP128_ATTRIBUTE_VECTOR_WIDTH;
       default:
-        return false;
+        Fail("Unknown compressed vector type.");
     }
   }();
 
-  if (!is_fixed_size_byte_aligned) {
-    Fail("Does only support fixed-size byte-aligned compressed attribute vectors.");
+  if (base_column.encoding_type() == EncodingType::FrontCodedDictionary) {
+    const auto& column = static_cast<const FrontCodedDictionaryColumn<std::string>&>(base_column);
+    const auto& dictionary = *column.front_coded_dictionary();
+
+    // The front-coded dictionary is written as it is, so that it does not need to be encoded again when importing it
+    export_value(context->ofstream, BinaryColumnType::front_coded_dictionary_column);
+    export_value(context->ofstream, attribute_vector_width);
+    export_value(context->ofstream, static_cast<ValueID>(dictionary.size()));
+    export_value(context->ofstream, dictionary.chars().size());
+    export_padding(context->ofstream);
+    export_values(context->ofstream, dictionary.block_offsets());
+    export_padding(context->ofstream);
+    export_values(context->ofstream, dictionary.chars());
+
+    _export_attribute_vector(context->ofstream, base_column.compressed_vector_type(), *base_column.attribute_vector());
+    return;
   }
 
   export_value(context->ofstream, BinaryColumnType::dictionary_column);
 
-  const auto attribute_vector_width = [&]() {
-    switch (base_column.compressed_vector_type()) {
-      case CompressedVectorType::FixedSize4ByteAligned:
-        return 4u;
-      case CompressedVectorType::FixedSize2ByteAligned:
-        return 2u;
-      case CompressedVectorType::FixedSize1ByteAligned:
-        return 1u;
-      default:
-        return 0u;
-    }
-  }();
-
   // Write attribute vector width
-  export_value(context->ofstream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
+  export_value(context->ofstream, attribute_vector_width);
 
   if (base_column.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& column = static_cast<const FixedStringDictionaryColumn<std::string>&>(base_column);
@@ -282,8 +291,9 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_column(const BaseDictionaryCol
   } else {
     const auto& column = static_cast<const DictionaryColumn<T>&>(base_column);
 
-    // Write the dictionary size and dictionary
+    // Write the dictionary size and dictionary. Strings are not mapped on import, so they need no padding.
     export_value(context->ofstream, static_cast<ValueID>(column.dictionary()->size()));
+    if constexpr (!std::is_same_v<T, std::string>) export_padding(context->ofstream);
     export_values(context->ofstream, *column.dictionary());
   }
 
@@ -303,14 +313,24 @@ void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ofstrea
                                                                     const BaseCompressedVector& attribute_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
+      export_padding(ofstream);
       export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
+      export_padding(ofstream);
       export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
+      export_padding(ofstream);
       export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
       return;
+    case CompressedVectorType::SimdBp128: {
+      const auto& data = dynamic_cast<const SimdBp128Vector&>(attribute_vector).data();
+      export_value(ofstream, static_cast<uint32_t>(data.size()));
+      export_padding(ofstream);
+      export_values(ofstream, data);
+      return;
+    }
     default:
       Fail("Any other type should have been caught before.");
   }
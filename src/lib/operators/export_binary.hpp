@@ -49,6 +49,8 @@ class ExportBinary : public AbstractReadOnlyOperator {
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
+   * Magic number          | char array (BINARY_FILE_MAGIC_NUMBER) |   8
+   * Format version        | uint32_t (BINARY_FILE_VERSION)        |   4
    * Chunk size            | ChunkOffset                           |   4
    * Chunk count           | ChunkID                               |   4
    * Column count          | ColumnID                              |   2
@@ -121,6 +123,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractColumnVisitor {
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
    * Column Type           | ColumnType                            |   1
+   * Null Values'          | vector<bool> (BoolAsByteType)         |   rows * 1
    * Values°               | T (int, float, double, long)          |   rows * sizeof(T)
    * Length of Strings^    | vector<size_t>                        |   rows * 2
    * Values^               | std::string                           |   rows * string.length()
@@ -128,6 +131,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractColumnVisitor {
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
    *
+   * ': These fields are only written if the referenced column is nullable.
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is writen if the type of the column is NOT a string
    *
@@ -144,16 +148,39 @@ class ExportBinary::ExportBinaryVisitor : public AbstractColumnVisitor {
    * Column Type           | ColumnType                            |   1
    * Width of attribute v. | AttributeVectorWidth                  |   1
    * Size of dictionary v. | ValueID                               |   4
+   * Padding°              | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
    * Dictionary Values°    | T (int, float, double, long)          |   dict. size * sizeof(T)
    * Dict. String Length^  | size_t                                |   dict. size * 2
    * Dictionary Values^    | std::string                           |   Sum of all string lengths
-   * Attribute v. values   | uintX                                 |   rows * width of attribute v.
+   * Padding'              | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Attribute v. values'  | uintX                                 |   rows * width of attribute v.
+   * Attribute v. size"    | uint32_t                              |   4
+   * Padding"              | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Attribute v. values"  | uint128_t                             |   Attribute v. size * 16
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
+   * The padding makes the following values start at a multiple of BINARY_FILE_ALIGNMENT, so that ImportBinary can use
+   * the mapped file as their storage.
    *
    * ^: These fields are only written if the type of the column IS a string.
-   * °: This field is written if the type of the column is NOT a string
+   * °: These fields are written if the type of the column is NOT a string
+   * ': These fields are written for FixedSizeByteAlignedVectors (width 1, 2, or 4).
+   * ": These fields are written for SimdBp128Vectors (width SIMD_BP128_ATTRIBUTE_VECTOR_WIDTH).
+   *
+   * FrontCodedDictionaryColumns keep their front-coded dictionary:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Width of attribute v. | AttributeVectorWidth                  |   1
+   * Size of dictionary v. | ValueID                               |   4
+   * Number of characters  | size_t                                |   8
+   * Padding               | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Block offsets         | size_t array                          |   ceil(dict. size / 16) * 8
+   * Padding               | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Characters            | char array                            |   Number of characters
+   * Attribute vector      | see above                             |
    *
    * @param base_column The Column to export
    * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
@@ -164,7 +191,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractColumnVisitor {
   void handle_column(const BaseEncodedColumn& base_column, std::shared_ptr<ColumnVisitorContext> base_context) override;
 
  private:
-  // Chooses the right FixedSizeByteAlignedVector depending on the attribute_vector_width and exports it.
+  // Chooses the right FixedSizeByteAlignedVector or SimdBp128Vector depending on the type and exports it.
   static void _export_attribute_vector(std::ofstream& ofstream, const CompressedVectorType type,
                                        const BaseCompressedVector& attribute_vector);
 };
@@ -1,23 +1,67 @@
 #include "import_binary.hpp"
 
+#include <boost/container/container_fwd.hpp>
 #include <boost/hana/for_each.hpp>
 
 #include <cstdint>
-#include <fstream>
+#include <cstring>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "constant_mappings.hpp"
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "utils/assert.hpp"
+#include "utils/mapped_file_memory_resource.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace {
+
+// Yields default_init for each of count many elements. Constructing a vector from it default-initializes the elements,
+// which leaves values of trivial types untouched.
+struct DefaultInitIterator {
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = boost::container::default_init_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+  reference operator*() const { return boost::container::default_init; }
+  DefaultInitIterator& operator++() {
+    ++index;
+    return *this;
+  }
+  difference_type operator-(const DefaultInitIterator& other) const {
+    return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+  }
+  bool operator==(const DefaultInitIterator& other) const { return index == other.index; }
+  bool operator!=(const DefaultInitIterator& other) const { return index != other.index; }
+
+  size_t index;
+};
+
+// Creates the object in a shared_ptr that keeps the memory resources of its mapped vectors alive until it is destroyed
+template <typename T, typename Resources, typename... Args>
+std::shared_ptr<T> make_shared_with_resources(const Resources& resources, Args&&... args) {
+  if (resources.empty()) return std::make_shared<T>(std::forward<Args>(args)...);
+
+  return std::shared_ptr<T>(new T(std::forward<Args>(args)...), [resources](T* object) { delete object; });
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -26,37 +70,52 @@ ImportBinary::ImportBinary(const std::string& filename, const std::optional<std:
 
 const std::string ImportBinary::name() const { return "ImportBinary"; }
 
+const char* ImportBinary::FileCursor::read(const size_t byte_count) {
+  Assert(static_cast<size_t>(end - position) >= byte_count, "ImportBinary: Unexpected end of file");
+  const auto* const data = position;
+  position += byte_count;
+  return data;
+}
+
+void ImportBinary::FileCursor::skip_padding() {
+  if (version == 0) return;
+
+  const auto offset = static_cast<size_t>(position - file->data());
+  read((BINARY_FILE_ALIGNMENT - offset % BINARY_FILE_ALIGNMENT) % BINARY_FILE_ALIGNMENT);
+}
+
 template <typename T>
-pmr_vector<T> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> ImportBinary::_read_values(FileCursor& cursor, const size_t count) {
   pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  const auto* const data = cursor.read(count * sizeof(T));
+  // The file does not guarantee any alignment of the values, so they are not accessed in place
+  if (count > 0) std::memcpy(values.data(), data, count * sizeof(T));
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<std::string> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  return _read_string_values(file, count);
+pmr_vector<std::string> ImportBinary::_read_values(FileCursor& cursor, const size_t count) {
+  return _read_string_values(cursor, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
-  return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
+pmr_vector<bool> ImportBinary::_read_values(FileCursor& cursor, const size_t count) {
+  const auto* const readable_bools = reinterpret_cast<const BoolAsByteType*>(cursor.read(count));
+  return pmr_vector<bool>(readable_bools, readable_bools + count);
 }
 
-pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, const size_t count) {
-  const auto string_lengths = _read_values<size_t>(file, count);
+pmr_vector<std::string> ImportBinary::_read_string_values(FileCursor& cursor, const size_t count) {
+  const auto string_lengths = _read_values<size_t>(cursor, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+  const auto* const buffer = cursor.read(total_length);
 
   pmr_vector<std::string> values(count);
   size_t start = 0;
 
   for (size_t i = 0; i < count; ++i) {
-    values[i] = std::string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
+    values[i] = std::string(buffer + start, buffer + start + string_lengths[i]);
     start += string_lengths[i];
   }
 
@@ -64,29 +123,80 @@ pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, c
 }
 
 template <typename T>
-T ImportBinary::_read_value(std::ifstream& file) {
+pmr_vector<T> ImportBinary::_map_values(FileCursor& cursor, const size_t count, MemoryResources& resources) {
+  if (cursor.version == 0) return _read_values<T>(cursor, count);
+
+  cursor.skip_padding();
+  const auto* const data = cursor.read(count * sizeof(T));
+  if (count == 0) return pmr_vector<T>{};
+
+  const auto resource = std::make_shared<MappedFileMemoryResource>(cursor.file, data, count * sizeof(T));
+  resources.emplace_back(resource);
+
+  // The vector gets the mapped values as its storage from the resource. As its elements are default-initialized, they
+  // keep these values and the read-only pages are not written to.
+  return pmr_vector<T>(DefaultInitIterator{0}, DefaultInitIterator{count}, PolymorphicAllocator<T>{resource.get()});
+}
+
+template <typename T>
+void ImportBinary::_skip_mapped_values(FileCursor& cursor, const size_t count) {
+  cursor.skip_padding();
+  _skip_values<T>(cursor, count);
+}
+
+template <typename T>
+T ImportBinary::_read_value(FileCursor& cursor) {
   T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
+  std::memcpy(&result, cursor.read(sizeof(T)), sizeof(T));
   return result;
 }
 
+template <typename T>
+void ImportBinary::_skip_values(FileCursor& cursor, const size_t count) {
+  cursor.read(count * sizeof(T));
+}
+
+// specialized implementation for string values
+template <>
+void ImportBinary::_skip_values<std::string>(FileCursor& cursor, const size_t count) {
+  const auto string_lengths = _read_values<size_t>(cursor, count);
+  cursor.read(std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0)));
+}
+
 std::shared_ptr<const Table> ImportBinary::_on_execute() {
   if (_tablename && StorageManager::get().has_table(*_tablename)) {
     return StorageManager::get().get_table(*_tablename);
   }
 
-  std::ifstream file;
-  file.open(_filename, std::ios::binary);
-
-  Assert(file.is_open(), "ImportBinary: Could not find file " + _filename);
-
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  const auto file = std::make_shared<const MemoryMappedFile>(_filename);
+  auto cursor = FileCursor{file->data(), file->data() + file->size(), file};
 
   std::shared_ptr<Table> table;
   ChunkID chunk_count;
-  std::tie(table, chunk_count) = _read_header(file);
+  std::tie(table, chunk_count) = _read_header(cursor);
+
+  // Locate all chunks first, so that they can be imported in parallel. This also validates the file, so that the
+  // jobs do not fail.
+  auto chunk_cursors = std::vector<FileCursor>{};
+  chunk_cursors.reserve(chunk_count);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    chunk_cursors.emplace_back(cursor);
+    _skip_chunk(cursor, *table);
+  }
+
+  auto chunk_columns = std::vector<ChunkColumns>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      chunk_columns[chunk_id] = _import_chunk(chunk_cursors[chunk_id], *table);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (auto& columns : chunk_columns) {
+    table->append_chunk(columns);
   }
 
   if (_tablename) {
@@ -104,13 +214,22 @@ std::shared_ptr<AbstractOperator> ImportBinary::_on_deep_copy(
 
 void ImportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstream& file) {
-  const auto chunk_size = _read_value<ChunkOffset>(file);
-  const auto chunk_count = _read_value<ChunkID>(file);
-  const auto column_count = _read_value<ColumnID>(file);
-  const auto data_types = _read_values<std::string>(file, column_count);
-  const auto column_nullables = _read_values<bool>(file, column_count);
-  const auto column_names = _read_string_values(file, column_count);
+std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(FileCursor& cursor) {
+  const auto magic_number_size = sizeof(BINARY_FILE_MAGIC_NUMBER);
+  if (static_cast<size_t>(cursor.end - cursor.position) >= magic_number_size &&
+      std::memcmp(cursor.position, BINARY_FILE_MAGIC_NUMBER, magic_number_size) == 0) {
+    cursor.read(magic_number_size);
+    cursor.version = _read_value<uint32_t>(cursor);
+    Assert(cursor.version >= 1 && cursor.version <= BINARY_FILE_VERSION,
+           "Cannot import binary file of version " + std::to_string(cursor.version));
+  }
+
+  const auto chunk_size = _read_value<ChunkOffset>(cursor);
+  const auto chunk_count = _read_value<ChunkID>(cursor);
+  const auto column_count = _read_value<ColumnID>(cursor);
+  const auto data_types = _read_values<std::string>(cursor, column_count);
+  const auto column_nullables = _read_values<bool>(cursor, column_count);
+  const auto column_names = _read_string_values(cursor, column_count);
 
   TableColumnDefinitions output_column_definitions;
   for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
@@ -123,37 +242,106 @@ std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
-  const auto row_count = _read_value<ChunkOffset>(file);
+ChunkColumns ImportBinary::_import_chunk(FileCursor& cursor, const Table& table) {
+  const auto row_count = _read_value<ChunkOffset>(cursor);
 
   ChunkColumns output_columns;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
     output_columns.push_back(
-        _import_column(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+        _import_column(cursor, row_count, table.column_data_type(column_id), table.column_is_nullable(column_id)));
+  }
+  return output_columns;
+}
+
+void ImportBinary::_skip_chunk(FileCursor& cursor, const Table& table) {
+  const auto row_count = _read_value<ChunkOffset>(cursor);
+
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _skip_column<ColumnDataType>(cursor, row_count, table.column_is_nullable(column_id));
+    });
+  }
+}
+
+template <typename ColumnDataType>
+void ImportBinary::_skip_column(FileCursor& cursor, ChunkOffset row_count, bool is_nullable) {
+  const auto column_type = _read_value<BinaryColumnType>(cursor);
+
+  switch (column_type) {
+    case BinaryColumnType::value_column:
+      if (is_nullable) _skip_values<BoolAsByteType>(cursor, row_count);
+      _skip_values<ColumnDataType>(cursor, row_count);
+      return;
+    case BinaryColumnType::dictionary_column: {
+      const auto attribute_vector_width = _read_value<AttributeVectorWidth>(cursor);
+      const auto dictionary_size = _read_value<ValueID>(cursor);
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        _skip_values<ColumnDataType>(cursor, dictionary_size);
+      } else {
+        _skip_mapped_values<ColumnDataType>(cursor, dictionary_size);
+      }
+      _skip_attribute_vector(cursor, row_count, attribute_vector_width);
+      return;
+    }
+    case BinaryColumnType::front_coded_dictionary_column: {
+      Assert((std::is_same_v<ColumnDataType, std::string>), "Only string columns can have a front-coded dictionary");
+      const auto attribute_vector_width = _read_value<AttributeVectorWidth>(cursor);
+      const auto dictionary_size = _read_value<ValueID>(cursor);
+      const auto char_count = _read_value<size_t>(cursor);
+      _skip_mapped_values<size_t>(cursor, (dictionary_size + FrontCodedStringVector::block_size - 1u) /
+                                              FrontCodedStringVector::block_size);
+      _skip_mapped_values<char>(cursor, char_count);
+      _skip_attribute_vector(cursor, row_count, attribute_vector_width);
+      return;
+    }
+    default:
+      // This case happens if the read column type is not a valid BinaryColumnType.
+      Fail("Cannot import column: invalid column type");
+  }
+}
+
+void ImportBinary::_skip_attribute_vector(FileCursor& cursor, ChunkOffset row_count,
+                                          AttributeVectorWidth attribute_vector_width) {
+  switch (attribute_vector_width) {
+    case 1:
+    case 2:
+    case 4:
+      _skip_mapped_values<char>(cursor, row_count * attribute_vector_width);
+      return;
+    case SIMD_BP128_ATTRIBUTE_VECTOR_WIDTH:
+      _skip_mapped_values<uint128_t>(cursor, _read_value<uint32_t>(cursor));
+      return;
+    default:
+      Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
-  table->append_chunk(output_columns);
 }
 
-std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+std::shared_ptr<BaseColumn> ImportBinary::_import_column(FileCursor& cursor, ChunkOffset row_count, DataType data_type,
                                                          bool is_nullable) {
   std::shared_ptr<BaseColumn> result;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
-    result = _import_column<ColumnDataType>(file, row_count, is_nullable);
+    result = _import_column<ColumnDataType>(cursor, row_count, is_nullable);
   });
 
   return result;
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, ChunkOffset row_count, bool is_nullable) {
-  const auto column_type = _read_value<BinaryColumnType>(file);
+std::shared_ptr<BaseColumn> ImportBinary::_import_column(FileCursor& cursor, ChunkOffset row_count, bool is_nullable) {
+  const auto column_type = _read_value<BinaryColumnType>(cursor);
 
   switch (column_type) {
     case BinaryColumnType::value_column:
-      return _import_value_column<ColumnDataType>(file, row_count, is_nullable);
+      return _import_value_column<ColumnDataType>(cursor, row_count, is_nullable);
     case BinaryColumnType::dictionary_column:
-      return _import_dictionary_column<ColumnDataType>(file, row_count);
+      return _import_dictionary_column<ColumnDataType>(cursor, row_count);
+    case BinaryColumnType::front_coded_dictionary_column:
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        return _import_front_coded_dictionary_column(cursor, row_count);
+      }
+      Fail("Only string columns can have a front-coded dictionary");
     default:
       // This case happens if the read column type is not a valid BinaryColumnType.
       Fail("Cannot import column: invalid column type");
@@ -161,46 +349,90 @@ std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, Ch
 }
 
 std::shared_ptr<BaseCompressedVector> ImportBinary::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    FileCursor& cursor, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+  auto resources = MemoryResources{};
+
+  const auto import_fixed_size_byte_aligned_vector = [&](auto unsigned_int_type) {
+    using UnsignedIntType = decltype(unsigned_int_type);
+    auto values = _map_values<UnsignedIntType>(cursor, row_count, resources);
+    return std::static_pointer_cast<BaseCompressedVector>(
+        make_shared_with_resources<FixedSizeByteAlignedVector<UnsignedIntType>>(resources, std::move(values)));
+  };
+
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return import_fixed_size_byte_aligned_vector(uint8_t{});
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return import_fixed_size_byte_aligned_vector(uint16_t{});
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return import_fixed_size_byte_aligned_vector(uint32_t{});
+    case SIMD_BP128_ATTRIBUTE_VECTOR_WIDTH: {
+      const auto data_size = _read_value<uint32_t>(cursor);
+      auto data = _map_values<uint128_t>(cursor, data_size, resources);
+      return make_shared_with_resources<SimdBp128Vector>(resources, std::move(data), row_count);
+    }
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 template <typename T>
-std::shared_ptr<ValueColumn<T>> ImportBinary::_import_value_column(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueColumn<T>> ImportBinary::_import_value_column(FileCursor& cursor, ChunkOffset row_count,
                                                                    bool is_nullable) {
   // TODO(unknown): Ideally _read_values would directly write into a tbb::concurrent_vector so that no conversion is
   // needed
   if (is_nullable) {
-    const auto nullables = _read_values<bool>(file, row_count);
-    const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueColumn<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()},
-                                            tbb::concurrent_vector<bool>{nullables.begin(), nullables.end()});
+    const auto nullables = _read_values<bool>(cursor, row_count);
+    auto values = _read_values<T>(cursor, row_count);
+    return std::make_shared<ValueColumn<T>>(
+        tbb::concurrent_vector<T>{std::make_move_iterator(values.begin()), std::make_move_iterator(values.end())},
+        tbb::concurrent_vector<bool>{nullables.begin(), nullables.end()});
   } else {
-    const auto values = _read_values<T>(file, row_count);
-    return std::make_shared<ValueColumn<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()});
+    auto values = _read_values<T>(cursor, row_count);
+    return std::make_shared<ValueColumn<T>>(
+        tbb::concurrent_vector<T>{std::make_move_iterator(values.begin()), std::make_move_iterator(values.end())});
   }
 }
 
 template <typename T>
-std::shared_ptr<DictionaryColumn<T>> ImportBinary::_import_dictionary_column(std::ifstream& file,
+std::shared_ptr<DictionaryColumn<T>> ImportBinary::_import_dictionary_column(FileCursor& cursor,
                                                                              ChunkOffset row_count) {
-  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
-  const auto dictionary_size = _read_value<ValueID>(file);
+  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(cursor);
+  const auto dictionary_size = _read_value<ValueID>(cursor);
   const auto null_value_id = dictionary_size;
-  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
 
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+  auto dictionary = std::shared_ptr<const pmr_vector<T>>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(cursor, dictionary_size));
+  } else {
+    auto resources = MemoryResources{};
+    auto values = _map_values<T>(cursor, dictionary_size, resources);
+    dictionary = make_shared_with_resources<pmr_vector<T>>(resources, std::move(values));
+  }
+
+  auto attribute_vector = _import_attribute_vector(cursor, row_count, attribute_vector_width);
 
   return std::make_shared<DictionaryColumn<T>>(dictionary, attribute_vector, null_value_id);
 }
 
+std::shared_ptr<FrontCodedDictionaryColumn<std::string>> ImportBinary::_import_front_coded_dictionary_column(
+    FileCursor& cursor, ChunkOffset row_count) {
+  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(cursor);
+  const auto dictionary_size = _read_value<ValueID>(cursor);
+  const auto null_value_id = dictionary_size;
+  const auto char_count = _read_value<size_t>(cursor);
+
+  auto resources = MemoryResources{};
+  auto block_offsets = _map_values<size_t>(
+      cursor, (dictionary_size + FrontCodedStringVector::block_size - 1u) / FrontCodedStringVector::block_size,
+      resources);
+  auto chars = _map_values<char>(cursor, char_count, resources);
+  auto dictionary = make_shared_with_resources<FrontCodedStringVector>(
+      resources, std::move(chars), std::move(block_offsets), static_cast<size_t>(dictionary_size));
+
+  auto attribute_vector = _import_attribute_vector(cursor, row_count, attribute_vector_width);
+
+  return std::make_shared<FrontCodedDictionaryColumn<std::string>>(dictionary, attribute_vector, null_value_id);
+}
+
 }  // namespace opossum
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -10,16 +9,29 @@
 #include "abstract_read_only_operator.hpp"
 #include "import_export/binary.hpp"
 #include "storage/base_column.hpp"
+#include "storage/chunk.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 #include "storage/value_column.hpp"
 
 namespace opossum {
 
+class MappedFileMemoryResource;
+class MemoryMappedFile;
+
 /*
  * This operator reads a Opossum binary file and creates a table from that input.
  * If parameter tablename provided, the imported table is stored in the StorageManager. If a table with this name
  * already exists, it is returned and no import is performed.
  *
+ * The file is memory-mapped instead of being read through a stream. In files of the current format version, the
+ * attribute vectors and fixed-width dictionaries of dictionary columns are page-aligned. They are not copied: their
+ * vectors are constructed in place on the read-only mapping (see MappedFileMemoryResource), which stays mapped as long
+ * as they exist. Thus, processes that import the same file share these pages through the page cache. Value columns
+ * and string dictionaries are copied from the mapping, as are all values of files written before the format was
+ * versioned. After the start of each chunk has been located, the chunks are imported in parallel, one JobTask per
+ * chunk.
+ *
  * Note: ImportBinary does not support null values at the moment
  */
 class ImportBinary : public AbstractReadOnlyOperator {
@@ -48,14 +60,33 @@ class ImportBinary : public AbstractReadOnlyOperator {
   const std::string name() const final;
 
  private:
+  // Position in the memory-mapped file
+  struct FileCursor {
+    // Returns the current position and advances it by byte_count bytes. Fails if the file is shorter than that.
+    const char* read(const size_t byte_count);
+
+    // Advances the position to the next multiple of BINARY_FILE_ALIGNMENT. Does nothing for files of version 0.
+    void skip_padding();
+
+    const char* position;
+    const char* end;
+    std::shared_ptr<const MemoryMappedFile> file;
+    uint32_t version{0};
+  };
+
+  // The memory resources that back the mapped vectors of an object, see _map_values()
+  using MemoryResources = std::vector<std::shared_ptr<MappedFileMemoryResource>>;
+
   /*
-   * Reads the header from the given file.
+   * Reads the header from the given file and sets the format version of the cursor.
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    * The header has the following format:
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
+   * Magic number'         | char array (BINARY_FILE_MAGIC_NUMBER) |   8
+   * Format version'       | uint32_t                              |   4
    * Chunk size            | ChunkOffset                           |   4
    * Chunk count           | ChunkID                               |   4
    * Column count          | ColumnID                              |   2
@@ -64,8 +95,9 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * Column name lengths   | size_t array                          |   Column Count * 1
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
+   * ': These fields are missing in files of version 0, which were written before the format was versioned.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(FileCursor& cursor);
 
   /*
    * Creates a chunk from chunk information from the given file and adds it to the given table.
@@ -79,15 +111,27 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static ChunkColumns _import_chunk(FileCursor& cursor, const Table& table);
+
+  // Advances the cursor to the end of the chunk without importing it. Fails for invalid column types.
+  static void _skip_chunk(FileCursor& cursor, const Table& table);
+
+  template <typename ColumnDataType>
+  static void _skip_column(FileCursor& cursor, ChunkOffset row_count, bool is_nullable);
+
+  template <typename T>
+  static void _skip_values(FileCursor& cursor, const size_t count);
+
+  static void _skip_attribute_vector(FileCursor& cursor, ChunkOffset row_count,
+                                     AttributeVectorWidth attribute_vector_width);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseColumn> _import_column(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+  static std::shared_ptr<BaseColumn> _import_column(FileCursor& cursor, ChunkOffset row_count, DataType data_type,
                                                     bool is_nullable);
 
   // Reads the column type from the given file and chooses a column import function from it.
   template <typename ColumnDataType>
-  static std::shared_ptr<BaseColumn> _import_column(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseColumn> _import_column(FileCursor& cursor, ChunkOffset row_count, bool is_nullable);
 
   /*
    * Imports a serialized ValueColumn from the given file.
@@ -115,7 +159,7 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    */
   template <typename T>
-  static std::shared_ptr<ValueColumn<T>> _import_value_column(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueColumn<T>> _import_value_column(FileCursor& cursor, ChunkOffset row_count,
                                                               bool is_nullable);
 
   /*
@@ -126,31 +170,69 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * -----------------------------------------------------------------------------------------
    * Width of attribute v. | AttributeVectorWidth                  |   1
    * Size of dictionary v. | ValueID                               |   4
+   * Padding°*             | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
    * Dictionary Values°    | T (int, float, double, long)          |   dict. size * sizeof(T)
    * Dict. String Length^  | size_t                                |   dict. size * 2
    * Dictionary Values^    | std::string                           |   Sum of all string lengths
-   * Attribute v. values   | uintX                                 |   row_count * width of attribute v.
+   * Padding'*             | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Attribute v. values'  | uintX                                 |   row_count * width of attribute v.
+   * Attribute v. size"    | uint32_t                              |   4
+   * Padding"*             | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Attribute v. values"  | uint128_t                             |   Attribute v. size * 16
    *
    * ^: These fields are only needed if the type of the column is a string.
-   * °: This field is needed if the type of the column is NOT a string
+   * °: These fields are needed if the type of the column is NOT a string
+   * ': These fields are only needed for FixedSizeByteAlignedVectors (width 1, 2, or 4).
+   * ": These fields are only needed for SimdBp128Vectors (width SIMD_BP128_ATTRIBUTE_VECTOR_WIDTH).
+   * *: The padding is missing in files of version 0.
    */
   template <typename T>
-  static std::shared_ptr<DictionaryColumn<T>> _import_dictionary_column(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionaryColumn<T>> _import_dictionary_column(FileCursor& cursor, ChunkOffset row_count);
 
-  // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+  /*
+   * Imports a serialized FrontCodedDictionaryColumn from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Width of attribute v. | AttributeVectorWidth                  |   1
+   * Size of dictionary v. | ValueID                               |   4
+   * Number of characters  | size_t                                |   8
+   * Padding*              | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Block offsets         | size_t array                          |   ceil(dict. size / 16) * 8
+   * Padding*              | zeros                                 |   up to BINARY_FILE_ALIGNMENT - 1
+   * Characters            | char array                            |   Number of characters
+   * Attribute vector      | see _import_dictionary_column         |
+   *
+   * *: The padding is missing in files of version 0.
+   */
+  static std::shared_ptr<FrontCodedDictionaryColumn<std::string>> _import_front_coded_dictionary_column(
+      FileCursor& cursor, ChunkOffset row_count);
+
+  // Creates the FixedSizeByteAlignedVector or SimdBp128Vector that corresponds to the given attribute_vector_width.
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(FileCursor& cursor, ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(FileCursor& cursor, const size_t count);
+
+  // Skips the padding and returns a vector of count many values of type T that uses the mapped file as its storage.
+  // The MappedFileMemoryResource of the vector is added to resources and has to outlive it. Copies the values from
+  // files of version 0, which are not aligned.
+  template <typename T>
+  static pmr_vector<T> _map_values(FileCursor& cursor, const size_t count, MemoryResources& resources);
+
+  // Skips the padding and count many values of type T
+  template <typename T>
+  static void _skip_mapped_values(FileCursor& cursor, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<std::string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<std::string> _read_string_values(FileCursor& cursor, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(FileCursor& cursor);
 
  private:
   // Name of the import file
@@ -1,27 +1,75 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
-
+#include <map>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "expression/evaluation/like_matcher.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index/table_index.hpp"
 #include "storage/reference_column.hpp"
+#include "table_scan.hpp"
+#include "table_wrapper.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<AllParameterVariant> to_parameter_variants(const std::vector<AllTypeVariant>& values) {
+  return std::vector<AllParameterVariant>(values.begin(), values.end());
+}
+
+std::vector<AllTypeVariant> to_values(const std::vector<AllParameterVariant>& parameters) {
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(parameters.size());
+  for (const auto& parameter : parameters) {
+    Assert(is_variant(parameter), "IndexScan: The values of all parameters need to be set before the execution");
+    values.emplace_back(boost::get<AllTypeVariant>(parameter));
+  }
+  return values;
+}
+
+// Returns the prefix of a LIKE pattern of the form 'prefix%' or std::nullopt for all other patterns
+std::optional<std::string> like_prefix(const AllTypeVariant& pattern) {
+  if (pattern.type() != typeid(std::string)) return std::nullopt;
+
+  const auto pattern_variant = LikeMatcher::pattern_string_to_pattern_variant(boost::get<std::string>(pattern));
+  if (pattern_variant.type() != typeid(LikeMatcher::StartsWithPattern)) return std::nullopt;
+
+  return boost::get<LikeMatcher::StartsWithPattern>(pattern_variant).string;
+}
+
+}  // namespace
+
 namespace opossum {
 
 IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnIndexType index_type,
                      const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
                      const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2)
+    : IndexScan{in, index_type, left_column_ids, predicate_condition, to_parameter_variants(right_values),
+                to_parameter_variants(right_values2)} {}
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnIndexType index_type,
+                     const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
+                     const std::vector<AllParameterVariant>& right_parameters,
+                     const std::vector<AllParameterVariant>& right_parameters2)
     : AbstractReadOnlyOperator{OperatorType::IndexScan, in},
       _index_type{index_type},
       _left_column_ids{left_column_ids},
       _predicate_condition{predicate_condition},
-      _right_values{right_values},
-      _right_values2{right_values2} {}
+      _right_parameters{right_parameters},
+      _right_parameters2{right_parameters2} {}
 
 const std::string IndexScan::name() const { return "IndexScan"; }
 
@@ -29,24 +77,28 @@ void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) {
 
 std::shared_ptr<const Table> IndexScan::_on_execute() {
   _in_table = input_table_left();
+  _right_values = to_values(_right_parameters);
+  _right_values2 = to_values(_right_parameters2);
 
   _validate_input();
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_in_table->type() == TableType::References) {
+    _probe_referenced_table();
+  } else if (_index_type == ColumnIndexType::Table) {
+    _scan_table_index();
+    return _out_table;
+  }
+
   std::mutex output_mutex;
 
+  const auto chunk_ids = _chunk_ids_to_scan();
+
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  if (_included_chunk_ids.empty()) {
-    jobs.reserve(_in_table->chunk_count());
-    for (auto chunk_id = ChunkID{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
-    }
-  } else {
-    jobs.reserve(_included_chunk_ids.size());
-    for (auto chunk_id : _included_chunk_ids) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
-    }
+  jobs.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
@@ -57,15 +109,38 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto copy = std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids,
+                                                _predicate_condition, _right_parameters, _right_parameters2);
+  copy->set_included_chunk_ids(_included_chunk_ids);
+  return copy;
 }
 
-void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  for (auto* right_parameters : {&_right_parameters, &_right_parameters2}) {
+    for (auto& right_parameter : *right_parameters) {
+      if (!is_parameter_id(right_parameter)) continue;
+
+      const auto value_iter = parameters.find(boost::get<ParameterID>(right_parameter));
+      if (value_iter == parameters.end()) continue;
+
+      right_parameter = value_iter->second;
+    }
+  }
+}
+
+std::vector<ChunkID> IndexScan::_chunk_ids_to_scan() const {
+  if (!_included_chunk_ids.empty()) return _included_chunk_ids;
+
+  auto chunk_ids = std::vector<ChunkID>(_in_table->chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0u});
+  return chunk_ids;
+}
 
 std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex) {
   auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-    const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
+    const auto matches_out = std::make_shared<PosList>(_in_table->type() == TableType::References
+                                                           ? _filter_reference_chunk(chunk_id)
+                                                           : _scan_chunk(*_in_table, chunk_id, _left_column_ids));
 
     const auto chunk = _in_table->get_chunk(chunk_id);
     // The output chunk is allocated on the same NUMA node as the input chunk. Also, the ChunkAccessCounter is
@@ -74,9 +149,32 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
 
     ChunkColumns columns;
 
-    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-      auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-      columns.push_back(ref_column_out);
+    if (_in_table->type() == TableType::References) {
+      // As in the TableScan, the matches are resolved so that the output references the data table again. Columns
+      // that share their position list in the input also share it in the output.
+      auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        const auto ref_column_in = std::static_pointer_cast<const ReferenceColumn>(chunk->get_column(column_id));
+        const auto pos_list_in = ref_column_in->pos_list();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<PosList>();
+          filtered_pos_list->reserve(matches_out->size());
+          for (const auto& match : *matches_out) {
+            filtered_pos_list->push_back((*pos_list_in)[match.chunk_offset]);
+          }
+        }
+
+        columns.push_back(std::make_shared<ReferenceColumn>(ref_column_in->referenced_table(),
+                                                            ref_column_in->referenced_column_id(), filtered_pos_list));
+      }
+    } else {
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
+        columns.push_back(ref_column_out);
+      }
     }
 
     std::lock_guard<std::mutex> lock(output_mutex);
@@ -88,7 +186,6 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
 }
 
 void IndexScan::_validate_input() {
-  Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
 
   Assert(_left_column_ids.size() == _right_values.size(),
@@ -98,19 +195,193 @@ void IndexScan::_validate_input() {
            "Count mismatch: left column IDs and right values don’t have same size.");
   }
 
-  Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+  if (_predicate_condition == PredicateCondition::Like) {
+    Assert(_index_type == ColumnIndexType::AdaptiveRadixTree, "LIKE is only supported by AdaptiveRadixTreeIndexes.");
+    Assert(_left_column_ids.size() == 1 && like_prefix(_right_values[0]),
+           "LIKE is only supported for patterns of the form 'prefix%'.");
+  }
+
+  if (_index_type == ColumnIndexType::Table) {
+    Assert(_left_column_ids.size() == 1, "TableIndexes only cover a single column.");
+  }
+}
+
+PosList IndexScan::_lookup_table_index(const Table& table, const ColumnID column_id) const {
+  const auto table_index = table.get_table_index(column_id);
+  Assert(table_index != nullptr, "TableIndex not found for column.");
+
+  const auto search_value2 = _predicate_condition == PredicateCondition::Between
+                                 ? std::optional<AllTypeVariant>{_right_values2[0]}
+                                 : std::nullopt;
+  return table_index->lookup(_predicate_condition, _right_values[0], search_value2);
+}
+
+void IndexScan::_scan_table_index() {
+  // Recorded before the lookup, as concurrent inserts might add chunks that the lookup already returns rows of
+  auto chunk_is_included = std::vector<bool>(_in_table->chunk_count(), _included_chunk_ids.empty());
+  for (const auto chunk_id : _included_chunk_ids) chunk_is_included[chunk_id] = true;
+
+  auto matches_out = std::make_shared<PosList>(_lookup_table_index(*_in_table, _left_column_ids[0]));
+  matches_out->erase(std::remove_if(matches_out->begin(), matches_out->end(),
+                                    [&](const auto& row_id) {
+                                      return static_cast<size_t>(row_id.chunk_id) >= chunk_is_included.size() ||
+                                             !chunk_is_included[row_id.chunk_id];
+                                    }),
+                     matches_out->end());
+
+  // The matches of all chunks are emitted as a single chunk
+  ChunkColumns columns;
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    columns.push_back(std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out));
+  }
+  _out_table->append_chunk(columns);
+}
+
+void IndexScan::_probe_referenced_table() {
+  const auto chunk_ids = _chunk_ids_to_scan();
+  if (chunk_ids.empty()) return;
+
+  const auto get_left_column = [&](const ChunkID chunk_id, const ColumnID column_id) {
+    return std::static_pointer_cast<const ReferenceColumn>(_in_table->get_chunk(chunk_id)->get_column(column_id));
+  };
+
+  const auto referenced_table = get_left_column(chunk_ids.front(), _left_column_ids[0])->referenced_table();
+
+  auto referenced_column_ids = std::vector<ColumnID>{};
+  for (const auto column_id : _left_column_ids) {
+    referenced_column_ids.emplace_back(get_left_column(chunk_ids.front(), column_id)->referenced_column_id());
+  }
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto first_left_column = get_left_column(chunk_id, _left_column_ids[0]);
+    Assert(first_left_column->referenced_table() == referenced_table,
+           "IndexScan requires all chunks to reference the same table.");
+    for (const auto column_id : _left_column_ids) {
+      Assert(get_left_column(chunk_id, column_id)->pos_list() == first_left_column->pos_list(),
+             "IndexScan requires the left columns to share their positions.");
+    }
+  }
+
+  _referenced_matches.assign(referenced_table->chunk_count(), {});
+
+  const auto mark_matches = [&](const PosList& matches) {
+    for (const auto& row_id : matches) {
+      // Rows appended after the input was created cannot be referenced by it. This includes rows appended to a chunk
+      // after its matches were sized.
+      if (static_cast<size_t>(row_id.chunk_id) >= _referenced_matches.size()) continue;
+
+      auto& chunk_matches = _referenced_matches[row_id.chunk_id];
+      if (chunk_matches.empty()) chunk_matches.resize(referenced_table->get_chunk(row_id.chunk_id)->size());
+      if (row_id.chunk_offset >= chunk_matches.size()) continue;
+
+      chunk_matches[row_id.chunk_offset] = true;
+    }
+  };
+
+  if (_index_type == ColumnIndexType::Table) {
+    mark_matches(_lookup_table_index(*referenced_table, referenced_column_ids[0]));
+    return;
+  }
+
+  // Only the chunk indexes of referenced chunks are probed
+  auto chunk_is_referenced = std::vector<bool>(referenced_table->chunk_count(), false);
+  for (const auto chunk_id : chunk_ids) {
+    for (const auto& row_id : *get_left_column(chunk_id, _left_column_ids[0])->pos_list()) {
+      if (!row_id.is_null()) chunk_is_referenced[row_id.chunk_id] = true;
+    }
+  }
+
+  // Each job only marks the rows of its own chunk. Chunks that were added after the plan was created, e.g., the
+  // mutable last chunk, might not be indexed yet. As for a data table input (see LQPTranslator), they are scanned.
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  auto has_unindexed_chunks = false;
+  for (ChunkID referenced_chunk_id{0u}; referenced_chunk_id < chunk_is_referenced.size(); ++referenced_chunk_id) {
+    const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+    const auto is_indexed = referenced_chunk->get_index(_index_type, referenced_column_ids) != nullptr;
+    if (!chunk_is_referenced[referenced_chunk_id] || is_indexed) excluded_chunk_ids.emplace_back(referenced_chunk_id);
+
+    if (!chunk_is_referenced[referenced_chunk_id]) continue;
+    if (!is_indexed) {
+      has_unindexed_chunks = true;
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, referenced_chunk_id]() {
+      mark_matches(_scan_chunk(*referenced_table, referenced_chunk_id, referenced_column_ids));
+    }));
+    jobs.back()->schedule();
+  }
+
+  if (has_unindexed_chunks) {
+    mark_matches(_scan_referenced_chunks(referenced_table, referenced_column_ids[0], excluded_chunk_ids));
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
 }
 
-PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
+PosList IndexScan::_scan_referenced_chunks(const std::shared_ptr<const Table>& referenced_table,
+                                           const ColumnID column_id,
+                                           const std::vector<ChunkID>& excluded_chunk_ids) const {
+  const auto table_wrapper = std::make_shared<TableWrapper>(referenced_table);
+  table_wrapper->execute();
+
+  // See the BETWEEN handling in LQPTranslator::_translate_predicate_node
+  auto table_scan = std::shared_ptr<TableScan>{};
+  if (_predicate_condition == PredicateCondition::Between) {
+    const auto table_scan_gt = std::make_shared<TableScan>(table_wrapper, column_id,
+                                                           PredicateCondition::GreaterThanEquals, _right_values[0]);
+    table_scan_gt->set_excluded_chunk_ids(excluded_chunk_ids);
+    table_scan_gt->execute();
+    table_scan =
+        std::make_shared<TableScan>(table_scan_gt, column_id, PredicateCondition::LessThanEquals, _right_values2[0]);
+  } else {
+    table_scan = std::make_shared<TableScan>(table_wrapper, column_id, _predicate_condition, _right_values[0]);
+    table_scan->set_excluded_chunk_ids(excluded_chunk_ids);
+  }
+  table_scan->execute();
+
+  // The output of the TableScan references the rows of referenced_table
+  auto matches = PosList{};
+  const auto& output_table = *table_scan->get_output();
+  for (ChunkID chunk_id{0u}; chunk_id < output_table.chunk_count(); ++chunk_id) {
+    const auto& column = static_cast<const ReferenceColumn&>(*output_table.get_chunk(chunk_id)->get_column(column_id));
+    matches.insert(matches.end(), column.pos_list()->begin(), column.pos_list()->end());
+  }
+  return matches;
+}
+
+PosList IndexScan::_filter_reference_chunk(const ChunkID chunk_id) const {
+  const auto ref_column =
+      std::static_pointer_cast<const ReferenceColumn>(_in_table->get_chunk(chunk_id)->get_column(_left_column_ids[0]));
+  const auto& pos_list = *ref_column->pos_list();
+
+  auto matches_out = PosList{};
+
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < pos_list.size(); ++chunk_offset) {
+    const auto& row_id = pos_list[chunk_offset];
+    if (row_id.is_null()) continue;
+
+    const auto& chunk_matches = _referenced_matches[row_id.chunk_id];
+    if (!chunk_matches.empty() && chunk_matches[row_id.chunk_offset]) {
+      matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  return matches_out;
+}
+
+PosList IndexScan::_scan_chunk(const Table& table, const ChunkID chunk_id,
+                               const std::vector<ColumnID>& column_ids) const {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
   auto range_begin = BaseIndex::Iterator{};
   auto range_end = BaseIndex::Iterator{};
 
-  const auto chunk = _in_table->get_chunk_with_access_counting(chunk_id);
+  const auto chunk = table.get_chunk_with_access_counting(chunk_id);
   auto matches_out = PosList{};
 
-  const auto index = chunk->get_index(_index_type, _left_column_ids);
+  const auto index = chunk->get_index(_index_type, column_ids);
   Assert(index != nullptr, "Index of specified type not found for column (vector).");
 
   switch (_predicate_condition) {
@@ -157,6 +428,11 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
       range_end = index->upper_bound(_right_values2);
       break;
     }
+    case PredicateCondition::Like: {
+      const auto art_index = std::static_pointer_cast<const AdaptiveRadixTreeIndex>(index);
+      std::tie(range_begin, range_end) = art_index->prefix_range(*like_prefix(_right_values[0]));
+      break;
+    }
     default:
       Fail("Unsupported comparison type encountered");
   }
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 
+#include "all_parameter_variant.hpp"
 #include "all_type_variant.hpp"
 #include "storage/index/column_index_type.hpp"
 #include "types.hpp"
@@ -17,6 +20,15 @@ class AbstractTask;
  * Operator that performs a predicate search using indices
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * LIKE is supported for patterns of the form 'prefix%' on AdaptiveRadixTreeIndexes.
+ *
+ * With ColumnIndexType::Table, the TableIndex of the input table is used instead of the chunk indexes. It is probed
+ * once and all matches are returned in a single chunk.
+ *
+ * The input may also be a reference table, e.g., the output of a join or of another scan. In that case, the indexes of
+ * the referenced table are probed (the chunk indexes only for the referenced chunks) and each input chunk is reduced to
+ * the positions found in the index. Referenced chunks without a chunk index of the requested type are scanned instead.
  */
 class IndexScan : public AbstractReadOnlyOperator {
   friend class LQPTranslatorTest;
@@ -26,10 +38,17 @@ class IndexScan : public AbstractReadOnlyOperator {
             const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
             const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2 = {});
 
+  // The right values may also be ParameterIDs (e.g., for a prepared statement), which are replaced by their values in
+  // set_parameters()
+  IndexScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnIndexType index_type,
+            const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
+            const std::vector<AllParameterVariant>& right_parameters,
+            const std::vector<AllParameterVariant>& right_parameters2 = {});
+
   const std::string name() const final;
 
   /**
-   * @brief If set, only the specified chunks will be scanned.
+   * @brief If set, only the specified chunks of the input table will be scanned.
    *
    * @see TableScan::set_excluded_chunk_ids for usage
    */
@@ -44,20 +63,39 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
   void _validate_input();
+  std::vector<ChunkID> _chunk_ids_to_scan() const;
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
-  PosList _scan_chunk(const ChunkID chunk_id);
+  PosList _scan_chunk(const Table& table, const ChunkID chunk_id, const std::vector<ColumnID>& column_ids) const;
+  PosList _lookup_table_index(const Table& table, const ColumnID column_id) const;
+  void _scan_table_index();
+
+  // Probes the indexes of the table referenced by the input and fills _referenced_matches
+  void _probe_referenced_table();
+  PosList _filter_reference_chunk(const ChunkID chunk_id) const;
+
+  // Returns the rows of the referenced table that match the predicate, not including the excluded chunks
+  PosList _scan_referenced_chunks(const std::shared_ptr<const Table>& referenced_table, const ColumnID column_id,
+                                  const std::vector<ChunkID>& excluded_chunk_ids) const;
 
  private:
   const ColumnIndexType _index_type;
   const std::vector<ColumnID> _left_column_ids;
   const PredicateCondition _predicate_condition;
-  const std::vector<AllTypeVariant> _right_values;
-  const std::vector<AllTypeVariant> _right_values2;
+  std::vector<AllParameterVariant> _right_parameters;
+  std::vector<AllParameterVariant> _right_parameters2;
+
+  // The values of _right_parameters and _right_parameters2, set at the start of the execution
+  std::vector<AllTypeVariant> _right_values;
+  std::vector<AllTypeVariant> _right_values2;
 
   std::vector<ChunkID> _included_chunk_ids;
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
+
+  // For reference input: for each chunk of the referenced table, which of its rows satisfy the predicate. Chunks that
+  // are not referenced by the input are left empty.
+  std::vector<std::vector<bool>> _referenced_matches;
 };
 
 }  // namespace opossum
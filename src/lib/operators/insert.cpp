@@ -6,8 +6,10 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/logger.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_column.hpp"
+#include "storage/index/table_index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_column.hpp"
 #include "type_cast.hpp"
@@ -105,6 +107,7 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
 
   _target_table = StorageManager::get().get_table(_target_table_name);
+  _transaction_id = context->transaction_id();
 
   // These TypedColumnProcessors kind of retrieve the template parameter of the columns.
   auto typed_column_processors = std::vector<std::unique_ptr<AbstractTypedColumnProcessor>>();
@@ -195,6 +198,13 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
+    // The new rows are added to the table's TableIndexes right away. They stay in there even if this transaction is
+    // rolled back, lookups are always followed by a Validate (see TableIndex).
+    for (const auto& table_index : _target_table->table_indexes()) {
+      table_index->insert(*target_chunk->get_column(table_index->column_id()), target_chunk_id, start_index,
+                          start_index + current_num_rows_to_insert);
+    }
+
     for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
@@ -213,25 +223,59 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
-  for (auto row_id : _inserted_rows) {
-    auto chunk = _target_table->get_chunk(row_id.chunk_id);
-
-    auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
-    mvcc_columns->begin_cids[row_id.chunk_offset] = cid;
-    mvcc_columns->tids[row_id.chunk_offset] = 0u;
+  // The rows are logged before the TransactionContext logs the Commit record
+  auto& logger = Logger::get();
+  if (logger.is_enabled()) {
+    auto values = std::vector<AllTypeVariant>(_target_table->column_count());
+    for (const auto& row_id : _inserted_rows) {
+      const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+      for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+        values[column_id] = (*chunk->get_column(column_id))[row_id.chunk_offset];
+      }
+      logger.log_value(_transaction_id, _target_table_name, row_id, values);
+    }
   }
+
+  _for_each_inserted_chunk([&](MvccColumns& mvcc_columns, const ChunkOffset begin, const ChunkOffset end) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      mvcc_columns.begin_cids[chunk_offset] = cid;
+      mvcc_columns.tids[chunk_offset] = 0u;
+    }
+  });
 }
 
 void Insert::_on_rollback_records() {
-  for (auto row_id : _inserted_rows) {
-    auto chunk = _target_table->get_chunk(row_id.chunk_id);
-    // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
-    // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
-    chunk->get_scoped_mvcc_columns_lock()->end_cids[row_id.chunk_offset] = 0u;
-    std::atomic_thread_fence(std::memory_order_release);
-    chunk->get_scoped_mvcc_columns_lock()->begin_cids[row_id.chunk_offset] = 0u;
-
-    chunk->get_scoped_mvcc_columns_lock()->tids[row_id.chunk_offset] = 0u;
+  _for_each_inserted_chunk([&](MvccColumns& mvcc_columns, const ChunkOffset begin, const ChunkOffset end) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
+      // does not think that this row is still incomplete. We need to make sure that the end is written before the
+      // begin.
+      mvcc_columns.end_cids[chunk_offset] = 0u;
+      mvcc_columns.register_invalidated_row(0u);
+      std::atomic_thread_fence(std::memory_order_release);
+      mvcc_columns.begin_cids[chunk_offset] = 0u;
+
+      mvcc_columns.tids[chunk_offset] = 0u;
+    }
+  });
+}
+
+template <typename Functor>
+void Insert::_for_each_inserted_chunk(const Functor& functor) {
+  // The rows of a chunk are inserted consecutively, so that its MVCC columns are locked only once
+  for (auto begin = _inserted_rows.cbegin(); begin != _inserted_rows.cend();) {
+    const auto chunk_id = begin->chunk_id;
+    const auto end = std::find_if(begin, _inserted_rows.cend(),
+                                  [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
+    functor(*mvcc_columns, begin->chunk_offset, static_cast<ChunkOffset>(std::prev(end)->chunk_offset + 1));
+
+    // The summary of an immutable chunk was computed while the rows were not committed yet
+    if (!chunk->is_mutable()) mvcc_columns->update_max_begin_cid();
+
+    begin = end;
   }
 }
 
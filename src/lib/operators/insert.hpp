@@ -35,8 +35,14 @@ class Insert : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  // Calls functor(mvcc_columns, begin, end) with the locked MVCC columns and the range of offsets of each chunk into
+  // which rows were inserted
+  template <typename Functor>
+  void _for_each_inserted_chunk(const Functor& functor);
+
   const std::string _target_table_name;
   std::shared_ptr<Table> _target_table;
+  TransactionID _transaction_id{0};
 
   PosList _inserted_rows;
 };
@@ -1,22 +1,24 @@
 #include "join_hash.hpp"
 
 #include <boost/lexical_cast.hpp>
-#include <boost/variant.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "join_hash/bloom_filter.hpp"
 #include "join_hash/hash_traits.hpp"
+#include "join_hash/join_hash_table.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/abstract_column_visitor.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "type_cast.hpp"
@@ -30,9 +32,9 @@ namespace opossum {
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-                   const size_t radix_bits)
+                   const std::optional<RadixPartitioningPlan>& radix_partitioning_plan)
     : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
-      _radix_bits(radix_bits) {
+      _radix_partitioning_plan(radix_partitioning_plan) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
 }
 
@@ -41,7 +43,8 @@ const std::string JoinHash::name() const { return "JoinHash"; }
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                    _radix_partitioning_plan);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -82,7 +85,8 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
       build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), build_operator,
-      probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
+      probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped,
+      _radix_partitioning_plan);
   return _impl->_on_execute();
 }
 
@@ -109,7 +113,7 @@ template <typename T>
 using Partition = std::vector<PartitionedElement<T>>;
 
 template <typename T>
-using HashTable = std::unordered_map<T, boost::variant<RowID, PosList>>;
+using HashTable = JoinHashTable<T>;
 
 /*
 This struct contains radix-partitioned data in a contiguous buffer,
@@ -122,10 +126,12 @@ struct RadixContainer {
 };
 
 /*
-Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
+Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left.
+If a bloom filter is given, the hashes of all build keys are added to it.
 */
 template <typename LeftType, typename HashedType>
-std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container) {
+std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container,
+                                                        const std::shared_ptr<BloomFilter>& bloom_filter = nullptr) {
   /*
   NUMA notes:
   The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
@@ -158,22 +164,13 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
       for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end; ++partition_offset) {
         const auto& element = partition_left[partition_offset];
 
-        const auto hash_key = type_cast<HashedType>(element.value);
-        const auto it = hashtable.find(hash_key);
-        if (it == hashtable.end()) {
-          // key is not present: add value and row ID
-          hashtable[hash_key] = element.row_id;
-        } else {
-          auto& map_entry = it->second;
-          if (map_entry.type() == typeid(RowID)) {
-            // Previously, there was only one row id stored for this value. Convert the entry to a multi-row-id one.
-            hashtable[hash_key] = PosList{boost::get<RowID>(map_entry), element.row_id};
-          } else {
-            boost::get<PosList>(map_entry).push_back(element.row_id);
-          }
-        }
+        // The partition hash was computed on the value cast to HashedType, so it can be reused for the hash table
+        hashtable.insert(element.partition_hash, type_cast<HashedType>(element.value), element.row_id);
+
+        if (bloom_filter) bloom_filter->insert(element.partition_hash);
       }
 
+      hashtable.finalize();
       hashtables[current_partition_id] = std::move(hashtable);
     }));
     jobs.back()->schedule();
@@ -200,11 +197,17 @@ constexpr Hash hash_value(const OriginalType& value, const unsigned int seed) {
   // clang-format on
 }
 
+/*
+Materializes the join column of in_table and builds the histograms needed for radix partitioning.
+If a bloom filter is given, only values whose hash might be contained in it are materialized. All other values
+cannot find a join partner and are treated like NULL values, i.e., they are skipped by partition_radix_parallel.
+*/
 template <typename T, typename HashedType>
 std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
                                                 std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
                                                 const size_t radix_bits, const unsigned int partitioning_seed,
-                                                bool keep_nulls = false) {
+                                                bool keep_nulls = false,
+                                                const std::shared_ptr<const BloomFilter>& bloom_filter = nullptr) {
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>();
   elements->resize(in_table->row_count());
@@ -212,9 +215,8 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
-  size_t pass = 0;
-  size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
+  // this is the first partitioning pass, further passes are performed by partition_radix_refine()
+  const size_t mask = num_partitions - 1;
 
   auto chunk_offsets = std::vector<size_t>(in_table->chunk_count());
 
@@ -253,21 +255,25 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
           if (!value.is_null() || keep_nulls) {
             const Hash hashed_value = hash_value<T, HashedType>(value.value(), partitioning_seed);
 
-            /*
-            For ReferenceColumns we do not use the RowIDs from the referenced tables.
-            Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
-            values from different inputs (important for Multi Joins).
-            */
-            if constexpr (std::is_same<std::decay<decltype(typed_column)>, ReferenceColumn>::value) {
-              *(output_iterator++) =
-                  PartitionedElement<T>{RowID{chunk_id, reference_column_offset}, hashed_value, value.value()};
-            } else {
-              *(output_iterator++) =
-                  PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, hashed_value, value.value()};
-            }
+            // Values whose hash is not contained in the bloom filter cannot find a join partner. Like NULL values,
+            // they are not materialized.
+            if (!bloom_filter || bloom_filter->may_contain(hashed_value)) {
+              /*
+              For ReferenceColumns we do not use the RowIDs from the referenced tables.
+              Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
+              values from different inputs (important for Multi Joins).
+              */
+              if constexpr (std::is_same<std::decay<decltype(typed_column)>, ReferenceColumn>::value) {
+                *(output_iterator++) =
+                    PartitionedElement<T>{RowID{chunk_id, reference_column_offset}, hashed_value, value.value()};
+              } else {
+                *(output_iterator++) =
+                    PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, hashed_value, value.value()};
+              }
 
-            const Hash radix = hashed_value & mask;
-            histogram[radix]++;
+              const Hash radix = hashed_value & mask;
+              histogram[radix]++;
+            }
           }
           // reference_column_offset is only used for ReferenceColumns
           if constexpr (std::is_same<std::decay<decltype(typed_column)>, ReferenceColumn>::value) {
@@ -292,9 +298,8 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
-  size_t pass = 0;
-  size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
+  // this is the first partitioning pass, further passes are performed by partition_radix_refine()
+  const size_t mask = num_partitions - 1;
 
   // allocate new (shared) output
   auto output = std::make_shared<Partition<T>>();
@@ -354,6 +359,89 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
   return radix_output;
 }
 
+/*
+Performs a further radix partitioning pass on already partitioned data, using the radix_bits bits of the hash that
+start at first_bit. Partition i of the input becomes the partitions [i * fan_out, (i + 1) * fan_out) of the output.
+As long as both relations are partitioned using the same RadixPartitioningPlan, partitions with the same id still
+contain the same hash values. Each input partition is refined by its own job.
+*/
+template <typename T>
+RadixContainer<T> partition_radix_refine(const RadixContainer<T>& input, const size_t first_bit,
+                                         const size_t radix_bits) {
+  const size_t fan_out = 1ull << radix_bits;
+  const size_t mask = fan_out - 1;
+  const auto input_partition_count = input.partition_offsets.size() - 1;
+
+  RadixContainer<T> output;
+  output.elements = std::make_shared<Partition<T>>(input.elements->size());
+  output.partition_offsets.resize(input_partition_count * fan_out + 1);
+  output.partition_offsets.back() = input.partition_offsets.back();
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(input_partition_count);
+
+  for (size_t input_partition_id = 0; input_partition_id < input_partition_count; ++input_partition_id) {
+    const auto partition_begin = input.partition_offsets[input_partition_id];
+    const auto partition_end = input.partition_offsets[input_partition_id + 1];
+    const auto first_output_partition_id = input_partition_id * fan_out;
+
+    if (partition_begin == partition_end) {
+      std::fill_n(output.partition_offsets.begin() + first_output_partition_id, fan_out, partition_begin);
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, first_output_partition_id]() {
+      const auto& in = static_cast<const Partition<T>&>(*input.elements);
+      auto& out = static_cast<Partition<T>&>(*output.elements);
+
+      std::vector<size_t> histogram(fan_out);
+      for (size_t offset = partition_begin; offset < partition_end; ++offset) {
+        ++histogram[(in[offset].partition_hash >> first_bit) & mask];
+      }
+
+      // The output partitions are written to the same range that the input partition occupied
+      std::vector<size_t> output_offsets(fan_out);
+      size_t output_offset = partition_begin;
+      for (size_t radix = 0; radix < fan_out; ++radix) {
+        output.partition_offsets[first_output_partition_id + radix] = output_offset;
+        output_offsets[radix] = output_offset;
+        output_offset += histogram[radix];
+      }
+
+      for (size_t offset = partition_begin; offset < partition_end; ++offset) {
+        const auto& element = in[offset];
+        out[output_offsets[(element.partition_hash >> first_bit) & mask]++] = element;
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return output;
+}
+
+/*
+Performs all passes of the radix partitioning plan. The first pass is based on the histograms that were built
+during materialization.
+*/
+template <typename T>
+RadixContainer<T> partition_radix(const std::shared_ptr<Partition<T>>& materialized,
+                                  const std::shared_ptr<std::vector<size_t>>& chunk_offsets,
+                                  std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
+                                  const RadixPartitioningPlan& plan, bool keep_nulls = false) {
+  auto radix_container =
+      partition_radix_parallel<T>(materialized, chunk_offsets, histograms, plan.bits_per_pass[0], keep_nulls);
+
+  auto first_bit = plan.bits_per_pass[0];
+  for (auto pass = size_t{1}; pass < plan.bits_per_pass.size(); ++pass) {
+    radix_container = partition_radix_refine<T>(radix_container, first_bit, plan.bits_per_pass[pass]);
+    first_bit += plan.bits_per_pass[pass];
+  }
+
+  return radix_container;
+}
+
 /*
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
@@ -406,22 +494,13 @@ void probe(const RadixContainer<RightType>& radix_container,
             continue;
           }
 
-          const auto& rows_iter = hashtable.find(type_cast<HashedType>(row.value));
+          const auto [matches_begin, matches_end] =  // NOLINT
+              hashtable.find(row.partition_hash, type_cast<HashedType>(row.value));
 
-          if (rows_iter != hashtable.end()) {
+          if (matches_begin != matches_end) {
             // Key exists, thus we have at least one hit
-            const auto& matching_rows_variant = rows_iter->second;
-            if (matching_rows_variant.type() == typeid(PosList)) {
-              // Multiple matches, stored in one PosList
-              for (const auto row_id : boost::get<PosList>(matching_rows_variant)) {
-                if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
-                  pos_list_left_local.emplace_back(row_id);
-                  pos_list_right_local.emplace_back(row.row_id);
-                }
-              }
-            } else {
-              // A single RowID
-              const auto row_id = boost::get<RowID>(matching_rows_variant);
+            for (auto match_it = matches_begin; match_it != matches_end; ++match_it) {
+              const auto row_id = *match_it;
               if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
                 pos_list_left_local.emplace_back(row_id);
                 pos_list_right_local.emplace_back(row.row_id);
@@ -499,9 +578,9 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
           }
 
           const auto& hashtable = hashtables[current_partition_id].value();
-          const auto it = hashtable.find(type_cast<HashedType>(row.value));
+          const auto has_match = hashtable.contains(row.partition_hash, type_cast<HashedType>(row.value));
 
-          if ((mode == JoinMode::Semi && it != hashtable.end()) || (mode == JoinMode::Anti && it == hashtable.end())) {
+          if ((mode == JoinMode::Semi && has_match) || (mode == JoinMode::Anti && !has_match)) {
             // Semi: found at least one match for this row -> match
             // Anti: no matching rows found -> match
             pos_list_local.emplace_back(row.row_id);
@@ -618,25 +697,13 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   JoinHashImpl(const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
-               const size_t radix_bits)
+               const std::optional<RadixPartitioningPlan>& radix_partitioning_plan)
       : _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
         _inputs_swapped(inputs_swapped) {
-    /*
-      Setting number of bits for radix clustering:
-      The number of bits is used to create probe partitions with a size that can
-      be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
-      We estimate the size the following way:
-        - we assume each key appears once (that is an overestimation space-wise, but we
-        aim rather for a hash map that is slightly smaller than L2 than slightly larger)
-        - each entry in the hash map is a data structure holding the actual value
-        and the RowID
-    */
     const auto build_relation_size = _left->get_output()->row_count();
     const auto probe_relation_size = _right->get_output()->row_count();
 
@@ -651,21 +718,22 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning(warning);
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
-
-    // We assume an std::unordered_map with a linked list within the buckets.
-    // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
-    // that each value maps to two RowIDs (thus, no single value optimizatio via boost::variant).
-    const auto complete_hash_map_size =
-        // hash map
-        build_relation_size * (sizeof(LeftType) + sizeof(void*)) +
-        // PosLists
-        (build_relation_size / 2) * (sizeof(PosList) + 2 * sizeof(RowID));
+    if (radix_partitioning_plan) {
+      _radix_partitioning_plan = *radix_partitioning_plan;
+      return;
+    }
 
-    const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
-    const auto cluster_count = std::max(1.0f, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+    /*
+      Setting number of bits for radix clustering:
+      The number of bits is used to create probe partitions with a size that can be expected to fit into the L2 cache.
+      The JoinHashTable allocates up to three buckets per build row (load factor between 1/3 and 2/3, see its
+      constructor). To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume the
+      upper bound. Additionally, each build row stores its RowID in the side array.
+    */
+    const auto bytes_per_build_row = 3 * JoinHashTable<HashedType>::bucket_size() + sizeof(RowID);
 
-    _radix_bits = std::ceil(std::log2(cluster_count));
+    _radix_partitioning_plan = RadixPartitioningPlan::for_build_relation(build_relation_size, bytes_per_build_row,
+                                                                         Topology::get().cache_info());
   }
 
  protected:
@@ -678,7 +746,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   std::shared_ptr<Table> _output_table;
 
   const unsigned int _partitioning_seed = 17;
-  size_t _radix_bits;
+  RadixPartitioningPlan _radix_partitioning_plan;
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
@@ -750,10 +818,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
     auto materialized_left = materialize_input<LeftType, HashedType>(left_in_table, _column_ids.first, histograms_left,
-                                                                     _radix_bits, _partitioning_seed);
-    // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
-    auto materialized_right = materialize_input<RightType, HashedType>(
-        right_in_table, _column_ids.second, histograms_right, _radix_bits, _partitioning_seed, keep_nulls);
+                                                                     _radix_partitioning_plan.bits_per_pass[0],
+                                                                     _partitioning_seed);
 
     // Radix Partitioning phase
     /*
@@ -767,13 +833,31 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
     auto radix_left =
-        partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left, _radix_bits);
-    // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
-    auto radix_right = partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets, histograms_right,
-                                                           _radix_bits, keep_nulls);
+        partition_radix<LeftType>(materialized_left, left_chunk_offsets, histograms_left, _radix_partitioning_plan);
+
+    /*
+    Semi-join reduction: For inner and semi joins, rows of the probe relation without a join partner are not part of
+    the result. While building the hash tables, we collect the hashes of all build keys in a bloom filter. It is used
+    when materializing the probe relation, so that most rows without a join partner are neither materialized nor
+    partitioned. For outer and anti joins, these rows are part of the result and cannot be dropped.
+    */
+    std::shared_ptr<BloomFilter> bloom_filter;
+    if (_mode == JoinMode::Inner || _mode == JoinMode::Semi) {
+      bloom_filter = std::make_shared<BloomFilter>(radix_left.elements->size());
+    }
 
     // Build phase
-    auto hashtables = build<LeftType, HashedType>(radix_left);
+    auto hashtables = build<LeftType, HashedType>(radix_left, bloom_filter);
+
+    // Materialization and Radix Partitioning phase for the probe relation, see notes above
+    // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
+    auto materialized_right =
+        materialize_input<RightType, HashedType>(right_in_table, _column_ids.second, histograms_right,
+                                                 _radix_partitioning_plan.bits_per_pass[0], _partitioning_seed,
+                                                 keep_nulls, bloom_filter);
+    // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
+    auto radix_right = partition_radix<RightType>(materialized_right, right_chunk_offsets, histograms_right,
+                                                  _radix_partitioning_plan, keep_nulls);
 
     // Probe phase
     std::vector<PosList> left_pos_lists;
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_join_operator.hpp"
+#include "join_hash/radix_partitioning_plan.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -19,13 +21,16 @@ namespace opossum {
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
  *
+ * If no radix partitioning plan is given, it is derived from the size of the build relation and the caches and TLBs
+ * of the machine (see RadixPartitioningPlan).
+ *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Radix-Partitioned-and-Hash-Based-Join
  */
 class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-           const size_t radix_bits = 9);
+           const std::optional<RadixPartitioningPlan>& radix_partitioning_plan = std::nullopt);
 
   const std::string name() const override;
 
@@ -38,7 +43,7 @@ class JoinHash : public AbstractJoinOperator {
   void _on_cleanup() override;
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const size_t _radix_bits;
+  const std::optional<RadixPartitioningPlan> _radix_partitioning_plan;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
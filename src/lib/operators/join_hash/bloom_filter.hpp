@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Register-blocked Bloom filter used by JoinHash for semi-join reduction: While the hash tables are built, the hashes
+ * of all build keys are added to the filter. Rows of the probe relation whose hash is not contained in the filter
+ * cannot have a join partner and are dropped during materialization, i.e., before they are radix partitioned.
+ *
+ * All bits set for one hash lie within the same 64 bit word, so that an insert or a lookup touches a single cache
+ * line and needs no more than one memory access. The word is chosen using Fibonacci hashing on the complete hash, the
+ * bits within the word are taken from the lower bits of the hash.
+ *
+ * Inserts can be performed concurrently, since bits are only ever set using an atomic OR.
+ */
+class BloomFilter {
+ public:
+  using Hash = uint32_t;
+
+  // Number of bits set per hash
+  static constexpr auto HASH_FUNCTION_COUNT = size_t{3};
+
+  // With 16 bits per element and three bits set per element, the false positive rate is approximately 1.5%
+  explicit BloomFilter(const size_t element_count, const size_t bits_per_element = 16) {
+    auto word_count = size_t{1};
+    while (word_count * 64 < element_count * bits_per_element) word_count <<= 1;
+
+    _words = std::vector<std::atomic<uint64_t>>(word_count);
+    _word_shift = 64;
+    while (word_count >>= 1) --_word_shift;
+  }
+
+  void insert(const Hash hash) { _words[_word_id(hash)].fetch_or(_bit_mask(hash), std::memory_order_relaxed); }
+
+  // May return false positives, but never false negatives
+  bool may_contain(const Hash hash) const {
+    const auto bit_mask = _bit_mask(hash);
+    return (_words[_word_id(hash)].load(std::memory_order_relaxed) & bit_mask) == bit_mask;
+  }
+
+  size_t size_in_bytes() const { return _words.size() * sizeof(uint64_t); }
+
+ protected:
+  size_t _word_id(const Hash hash) const {
+    // The shift of 64 for a single word would be undefined behavior, hence the extra check
+    if (_word_shift == 64) return 0;
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 11400714819323198485ull) >> _word_shift);
+  }
+
+  static uint64_t _bit_mask(const Hash hash) {
+    auto bit_mask = uint64_t{0};
+    for (auto hash_function_id = size_t{0}; hash_function_id < HASH_FUNCTION_COUNT; ++hash_function_id) {
+      bit_mask |= uint64_t{1} << ((hash >> (hash_function_id * 6)) & 63);
+    }
+    return bit_mask;
+  }
+
+  std::vector<std::atomic<uint64_t>> _words;
+  size_t _word_shift;
+};
+
+}  // namespace opossum
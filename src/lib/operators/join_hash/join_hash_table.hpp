@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Open-addressing hash table used for the build side of JoinHash. It replaces the former
+ * std::unordered_map<T, boost::variant<RowID, PosList>>, which needed one node allocation per key and one PosList
+ * allocation per duplicate key.
+ *
+ * Layout:
+ *   - Buckets are stored in one flat, power-of-two sized vector and resolved using linear probing. Each bucket holds
+ *     the key, its (already computed) hash and the position of its RowIDs. During a lookup, the hash is compared
+ *     first, so that for most non-matching buckets the key does not have to be compared at all.
+ *   - The RowIDs of all keys are stored contiguously in a single side array, grouped by key. A lookup thus touches
+ *     the bucket(s) and, on a hit, one range of the side array.
+ *
+ * The table is built in two steps: insert() all (hash, key, RowID) triples, then call finalize(), which groups the
+ * RowIDs by key using a counting sort. Lookups are only allowed after finalize(). The table is not thread-safe, but
+ * JoinHash builds and probes one table per radix partition, so no synchronization is needed.
+ *
+ * The hash passed in is the (murmur) hash that was already computed for radix partitioning. Since all keys of a
+ * partition share the lower radix bits, the bucket index is derived using Fibonacci hashing, which spreads all bits
+ * of the hash over the bucket index.
+ */
+template <typename T>
+class JoinHashTable {
+ public:
+  using Hash = uint32_t;
+  using RowIDRange = std::pair<PosList::const_iterator, PosList::const_iterator>;
+
+  // max_entry_count is an upper bound for the number of (non-distinct) keys that will be inserted
+  explicit JoinHashTable(const size_t max_entry_count) {
+    // Keep the load factor below 2/3 to keep probe sequences short, even if all keys are distinct
+    auto bucket_count = size_t{8};
+    while (bucket_count < max_entry_count + max_entry_count / 2) bucket_count <<= 1;
+
+    _buckets.resize(bucket_count);
+    _bucket_mask = bucket_count - 1;
+    _bucket_shift = 64 - _log2(bucket_count);
+    _pending_row_ids.reserve(max_entry_count);
+  }
+
+  void insert(const Hash hash, const T& key, const RowID row_id) {
+    DebugAssert(!_finalized, "Cannot insert into finalized JoinHashTable");
+    DebugAssert(_pending_row_ids.size() < _buckets.size(), "JoinHashTable was created too small");
+
+    auto bucket_id = _bucket_id(hash);
+    while (true) {
+      auto& bucket = _buckets[bucket_id];
+      if (bucket.row_count == 0) {
+        bucket.hash = hash;
+        bucket.key = key;
+        ++_distinct_key_count;
+        break;
+      }
+      if (bucket.hash == hash && bucket.key == key) break;
+      bucket_id = (bucket_id + 1) & _bucket_mask;
+    }
+
+    ++_buckets[bucket_id].row_count;
+    _pending_row_ids.emplace_back(static_cast<uint32_t>(bucket_id), row_id);
+  }
+
+  // Groups the inserted RowIDs by their key. Must be called once after all inserts and before the first lookup.
+  void finalize() {
+    DebugAssert(!_finalized, "JoinHashTable was already finalized");
+
+    // Prefix sum over the row counts. Afterwards, row_offset points to the end of each bucket's range and is
+    // decremented while scattering the RowIDs, so that it ends up pointing to the begin of the range.
+    auto offset = uint32_t{0};
+    for (auto& bucket : _buckets) {
+      offset += bucket.row_count;
+      bucket.row_offset = offset;
+    }
+
+    _row_ids.resize(_pending_row_ids.size());
+    for (auto it = _pending_row_ids.rbegin(); it != _pending_row_ids.rend(); ++it) {
+      _row_ids[--_buckets[it->first].row_offset] = it->second;
+    }
+
+    // Free the staging area, it is not needed anymore
+    _pending_row_ids = std::vector<std::pair<uint32_t, RowID>>{};
+    _finalized = true;
+  }
+
+  // Returns the RowIDs stored for the key. The range is empty if the key is not present.
+  RowIDRange find(const Hash hash, const T& key) const {
+    DebugAssert(_finalized, "JoinHashTable needs to be finalized before it can be probed");
+
+    const auto* bucket = _find_bucket(hash, key);
+    if (!bucket) return {_row_ids.cend(), _row_ids.cend()};
+
+    const auto begin = _row_ids.cbegin() + bucket->row_offset;
+    return {begin, begin + bucket->row_count};
+  }
+
+  bool contains(const Hash hash, const T& key) const {
+    DebugAssert(_finalized, "JoinHashTable needs to be finalized before it can be probed");
+    return _find_bucket(hash, key) != nullptr;
+  }
+
+  size_t distinct_key_count() const { return _distinct_key_count; }
+  size_t row_count() const { return _row_ids.size(); }
+
+  // Size of one bucket, used by JoinHash to estimate the size of a hash table when choosing the radix bits
+  static constexpr size_t bucket_size() { return sizeof(Bucket); }
+
+ protected:
+  struct Bucket {
+    Hash hash{0};
+    // A bucket with a row_count of zero is empty
+    uint32_t row_count{0};
+    uint32_t row_offset{0};
+    T key{};
+  };
+
+  const Bucket* _find_bucket(const Hash hash, const T& key) const {
+    auto bucket_id = _bucket_id(hash);
+    while (true) {
+      const auto& bucket = _buckets[bucket_id];
+      if (bucket.row_count == 0) return nullptr;
+      if (bucket.hash == hash && bucket.key == key) return &bucket;
+      bucket_id = (bucket_id + 1) & _bucket_mask;
+    }
+  }
+
+  size_t _bucket_id(const Hash hash) const {
+    // Fibonacci hashing: multiply by 2^64 / phi and use the upper bits
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 11400714819323198485ull) >> _bucket_shift);
+  }
+
+  static size_t _log2(size_t value) {
+    auto log = size_t{0};
+    while (value >>= 1) ++log;
+    return log;
+  }
+
+  std::vector<Bucket> _buckets;
+  size_t _bucket_mask{0};
+  size_t _bucket_shift{0};
+  size_t _distinct_key_count{0};
+
+  // (bucket id, RowID) pairs collected by insert() and grouped by finalize()
+  std::vector<std::pair<uint32_t, RowID>> _pending_row_ids;
+  PosList _row_ids;
+  bool _finalized{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#include "radix_partitioning_plan.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "scheduler/topology.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+RadixPartitioningPlan RadixPartitioningPlan::for_build_relation(const size_t build_relation_size,
+                                                                const size_t bytes_per_build_row,
+                                                                const TopologyCacheInfo& cache_info) {
+  const auto hash_table_size = static_cast<double>(build_relation_size * bytes_per_build_row);
+
+  // Don't occupy the whole L2 cache, the probe side and the output need some space as well
+  const auto adaption_factor = 2.0;
+  const auto cluster_count = std::max(1.0, (adaption_factor * hash_table_size) / cache_info.l2_cache_size);
+  const auto radix_bits = static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+
+  // Every partition that is written to needs a TLB entry and should have its current cache line in the L1 cache
+  const auto max_fan_out =
+      std::min(cache_info.l2_tlb_entry_count, cache_info.l1_data_cache_size / cache_info.cache_line_size);
+  const auto max_bits_per_pass = std::max(size_t{1}, static_cast<size_t>(std::log2(std::max(size_t{2}, max_fan_out))));
+
+  const auto pass_count = std::max(size_t{1}, (radix_bits + max_bits_per_pass - 1) / max_bits_per_pass);
+
+  return with_fixed_bits(radix_bits, pass_count);
+}
+
+RadixPartitioningPlan RadixPartitioningPlan::with_fixed_bits(const size_t radix_bits, const size_t pass_count) {
+  Assert(pass_count > 0, "Radix partitioning needs at least one pass");
+  Assert(radix_bits < 32, "Cannot use more radix bits than there are bits in the hash");
+
+  // Earlier passes get the remaining bits if radix_bits is not divisible by pass_count
+  auto plan = RadixPartitioningPlan{};
+  for (auto pass = size_t{0}; pass < pass_count; ++pass) {
+    plan.bits_per_pass.emplace_back(radix_bits / pass_count + (pass < radix_bits % pass_count ? 1 : 0));
+  }
+  return plan;
+}
+
+size_t RadixPartitioningPlan::radix_bits() const {
+  auto radix_bits = size_t{0};
+  for (const auto bits : bits_per_pass) radix_bits += bits;
+  return radix_bits;
+}
+
+size_t RadixPartitioningPlan::partition_count() const { return size_t{1} << radix_bits(); }
+
+bool operator==(const RadixPartitioningPlan& lhs, const RadixPartitioningPlan& rhs) {
+  return lhs.bits_per_pass == rhs.bits_per_pass;
+}
+
+std::ostream& operator<<(std::ostream& stream, const RadixPartitioningPlan& plan) {
+  stream << "RadixPartitioningPlan{";
+  for (auto pass = size_t{0}; pass < plan.bits_per_pass.size(); ++pass) {
+    stream << (pass > 0 ? ", " : "") << plan.bits_per_pass[pass];
+  }
+  stream << "}";
+  return stream;
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+namespace opossum {
+
+struct TopologyCacheInfo;
+
+/**
+ * Describes how JoinHash radix partitions its inputs: the number of radix bits used in each pass. The first pass uses
+ * the lowest bits of the hash, each following pass refines the partitions of the previous pass using the next bits.
+ *
+ * The total number of radix bits is chosen so that the hash table of one partition fits into the L2 cache. The number
+ * of bits per pass is limited by the memory hierarchy: Each partition that is written to concurrently needs its own
+ * TLB entry and a cache line to write to. If the fan-out exceeds the number of TLB entries or of L1 cache lines,
+ * partitioning is dominated by TLB and cache misses, in which case multiple passes with a smaller fan-out are faster.
+ */
+struct RadixPartitioningPlan {
+  // Plan that fits the build relation to the caches and TLBs described by cache_info
+  static RadixPartitioningPlan for_build_relation(const size_t build_relation_size, const size_t bytes_per_build_row,
+                                                  const TopologyCacheInfo& cache_info);
+
+  // Plan that splits radix_bits as evenly as possible across pass_count passes, e.g., for benchmarking
+  static RadixPartitioningPlan with_fixed_bits(const size_t radix_bits, const size_t pass_count = 1);
+
+  size_t radix_bits() const;
+  size_t partition_count() const;
+
+  // Contains at least one pass. A plan with one zero-bit pass does not partition at all.
+  std::vector<size_t> bits_per_pass;
+};
+
+bool operator==(const RadixPartitioningPlan& lhs, const RadixPartitioningPlan& rhs);
+std::ostream& operator<<(std::ostream& stream, const RadixPartitioningPlan& plan);
+
+}  // namespace opossum
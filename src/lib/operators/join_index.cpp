@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -13,6 +14,7 @@
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index/table_index.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -98,54 +100,13 @@ void JoinIndex::_perform_join() {
   _pos_list_left->reserve(worst_case);
   _pos_list_right->reserve(worst_case);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = _right_in_table->get_chunk(chunk_id_right);
-    const auto column_right = chunk_right->get_column(_right_column_id);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
-
-    std::shared_ptr<BaseIndex> index = nullptr;
-
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
-    }
-
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
-        const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
+  const auto table_index =
+      _right_in_table->type() == TableType::Data ? _right_in_table->get_table_index(_right_column_id) : nullptr;
 
-        resolve_data_and_column_type(*chunk_column_left, [&](auto left_type, auto& typed_left_column) {
-          using LeftType = typename decltype(left_type)::type;
-
-          auto iterable_left = create_iterable_from_column<LeftType>(typed_left_column);
-
-          // utilize index for join
-          iterable_left.with_iterators([&](auto left_it, auto left_end) {
-            _join_two_columns_using_index(left_it, left_end, chunk_id_left, chunk_id_right, index);
-          });
-        });
-      }
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto chunk_column_right = _right_in_table->get_chunk(chunk_id_right)->get_column(_right_column_id);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
-        const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_columns(chunk_column_left, chunk_column_right, chunk_id_left, chunk_id_right,
-                                                  params);
-      }
-    }
+  if (table_index) {
+    _join_using_table_index(*table_index, track_left_matches, track_right_matches);
+  } else {
+    _join_using_chunk_indexes(track_left_matches, track_right_matches);
   }
 
   // For Full Outer and Left Join we need to add all unmatched rows for the left side
@@ -274,6 +235,112 @@ void JoinIndex::_join_two_columns_nested_loop(const BinaryFunctor& func, LeftIte
   }
 }
 
+void JoinIndex::_join_using_chunk_indexes(const bool track_left_matches, const bool track_right_matches) {
+  // Scan all chunks for right input
+  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
+    const auto chunk_right = _right_in_table->get_chunk(chunk_id_right);
+    const auto column_right = chunk_right->get_column(_right_column_id);
+    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_right_column_id});
+    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+
+    std::shared_ptr<BaseIndex> index = nullptr;
+
+    if (!indices.empty()) {
+      // We assume the first index to be efficient for our join
+      // as we do not want to spend time on evaluating the best index inside of this join loop
+      index = indices.front();
+    }
+
+    // Scan all chunks from left input
+    if (index != nullptr) {
+      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+        const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
+
+        resolve_data_and_column_type(*chunk_column_left, [&](auto left_type, auto& typed_left_column) {
+          using LeftType = typename decltype(left_type)::type;
+
+          auto iterable_left = create_iterable_from_column<LeftType>(typed_left_column);
+
+          // utilize index for join
+          iterable_left.with_iterators([&](auto left_it, auto left_end) {
+            _join_two_columns_using_index(left_it, left_end, chunk_id_left, chunk_id_right, index);
+          });
+        });
+      }
+    } else {
+      // Fall back to NestedLoopJoin
+      const auto chunk_column_right = _right_in_table->get_chunk(chunk_id_right)->get_column(_right_column_id);
+      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+        const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
+        JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                          *_pos_list_right,
+                                          _left_matches[chunk_id_left],
+                                          _right_matches[chunk_id_right],
+                                          track_left_matches,
+                                          track_right_matches,
+                                          _mode,
+                                          _predicate_condition};
+        JoinNestedLoop::_join_two_untyped_columns(chunk_column_left, chunk_column_right, chunk_id_left, chunk_id_right,
+                                                  params);
+      }
+    }
+  }
+}
+
+void JoinIndex::_join_using_table_index(const TableIndex& table_index, const bool track_left_matches,
+                                        const bool track_right_matches) {
+  // Concurrent inserts might add rows to the index while it is probed. These rows are not part of the right input, as
+  // they were not there when the join started.
+  auto right_chunk_sizes = std::vector<ChunkOffset>{};
+  for (ChunkID chunk_id_right{0}; chunk_id_right < _right_in_table->chunk_count(); ++chunk_id_right) {
+    right_chunk_sizes.emplace_back(_right_in_table->get_chunk(chunk_id_right)->size());
+  }
+
+  const auto is_in_right_input = [&](const RowID& row_id) {
+    return static_cast<size_t>(row_id.chunk_id) < right_chunk_sizes.size() &&
+           row_id.chunk_offset < right_chunk_sizes[row_id.chunk_id];
+  };
+
+  if (track_right_matches) {
+    _right_matches.resize(right_chunk_sizes.size());
+    for (ChunkID chunk_id_right{0}; chunk_id_right < right_chunk_sizes.size(); ++chunk_id_right) {
+      _right_matches[chunk_id_right].resize(right_chunk_sizes[chunk_id_right]);
+    }
+  }
+
+  // The join predicate is `left <condition> right`, so the index is probed with `right <flipped condition> left`
+  const auto index_predicate_condition = flip_predicate_condition(_predicate_condition);
+
+  for (ChunkID chunk_id_left{0}; chunk_id_left < _left_in_table->chunk_count(); ++chunk_id_left) {
+    const auto chunk_column_left = _left_in_table->get_chunk(chunk_id_left)->get_column(_left_column_id);
+
+    resolve_data_and_column_type(*chunk_column_left, [&](auto left_type, auto& typed_left_column) {
+      using LeftType = typename decltype(left_type)::type;
+
+      auto iterable_left = create_iterable_from_column<LeftType>(typed_left_column);
+      iterable_left.for_each([&](const auto& left_value) {
+        if (left_value.is_null()) return;
+
+        auto right_row_ids = table_index.lookup(index_predicate_condition, AllTypeVariant{left_value.value()});
+        right_row_ids.erase(std::remove_if(right_row_ids.begin(), right_row_ids.end(),
+                                           [&](const auto& row_id) { return !is_in_right_input(row_id); }),
+                            right_row_ids.end());
+        if (right_row_ids.empty()) return;
+
+        if (track_left_matches) _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
+
+        std::fill_n(std::back_inserter(*_pos_list_left), right_row_ids.size(),
+                    RowID{chunk_id_left, left_value.chunk_offset()});
+        _pos_list_right->insert(_pos_list_right->end(), right_row_ids.begin(), right_row_ids.end());
+
+        if (track_right_matches) {
+          for (const auto& row_id : right_row_ids) _right_matches[row_id.chunk_id][row_id.chunk_offset] = true;
+        }
+      });
+    });
+  }
+}
+
 void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                                 const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left,
                                 const ChunkID chunk_id_right) {
@@ -11,12 +11,17 @@
 #include "types.hpp"
 
 namespace opossum {
+
+class TableIndex;
+
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
    * Note: An index needs to be present on the right table in order to execute an index join.
+   * If the right input is a stored table with a TableIndex on the join column, that index is probed once per left
+   * value instead of probing the chunk indexes of every right chunk.
    * Note: Cross joins are not supported. Use the product operator instead.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -37,6 +42,11 @@ class JoinIndex : public AbstractJoinOperator {
 
   void _perform_join();
 
+  void _join_using_chunk_indexes(const bool track_left_matches, const bool track_right_matches);
+
+  void _join_using_table_index(const TableIndex& table_index, const bool track_left_matches,
+                               const bool track_right_matches);
+
   template <typename LeftIterator>
   void _join_two_columns_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
                                      const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index);
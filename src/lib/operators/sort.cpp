@@ -1,224 +1,201 @@
 #include "sort.hpp"
 
-#include <functional>
+#include <algorithm>
 #include <memory>
+#include <queue>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "storage/column_iterables/chunk_offset_mapping.hpp"
-#include "storage/reference_column.hpp"
-#include "storage/value_column.hpp"
+#include "constant_mappings.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "sort/sort_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Merges the sorted runs into a single sequence of RowIDs. The key space is split into one range per CPU (but not more
+ * than there are runs), using splitters sampled from all runs. Each range is then merged by a k-way merge in its own
+ * JobTask and written to its precomputed position in the output.
+ */
+PosList merge_sorted_runs(const std::vector<NormalizedKeyRun>& runs) {
+  auto row_count = size_t{0};
+  for (const auto& run : runs) row_count += run.keys.size();
+
+  auto sorted_row_ids = PosList(row_count);
+
+  if (runs.size() == 1) {
+    std::transform(runs[0].keys.begin(), runs[0].keys.end(), sorted_row_ids.begin(),
+                   [](const auto& key) { return key.row_id; });
+    return sorted_row_ids;
+  }
 
-namespace opossum {
+  const auto partition_count = std::max(size_t{1}, std::min(runs.size(), Topology::get().num_cpus()));
 
-Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
-           const size_t output_chunk_size)
-    : AbstractReadOnlyOperator(OperatorType::Sort, in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+  // Take a fixed number of evenly spaced samples from each run and pick the splitters from the sorted samples so that
+  // the sampling cost grows linearly with the number of runs
+  constexpr auto SAMPLES_PER_RUN = size_t{64};
 
-ColumnID Sort::column_id() const { return _column_id; }
+  std::vector<NormalizedKey> samples;
+  samples.reserve(runs.size() * SAMPLES_PER_RUN);
+  for (const auto& run : runs) {
+    const auto sample_count = std::min(SAMPLES_PER_RUN, run.keys.size());
+    for (auto sample_idx = size_t{0}; sample_idx < sample_count; ++sample_idx) {
+      samples.emplace_back(run.keys[sample_idx * run.keys.size() / sample_count]);
+    }
+  }
+  std::sort(samples.begin(), samples.end());
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+  std::vector<NormalizedKey> splitters;
+  splitters.reserve(partition_count - 1);
+  for (auto partition_id = size_t{1}; partition_id < partition_count; ++partition_id) {
+    splitters.emplace_back(samples[partition_id * samples.size() / partition_count]);
+  }
 
-const std::string Sort::name() const { return "Sort"; }
+  // For each partition and run, the range of keys that belongs to the partition
+  using KeyIterator = std::vector<NormalizedKey>::const_iterator;
+  using KeyRange = std::pair<KeyIterator, KeyIterator>;
 
-std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
-    const std::shared_ptr<AbstractOperator>& copied_input_left,
-    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Sort>(copied_input_left, _column_id, _order_by_mode, _output_chunk_size);
-}
+  std::vector<std::vector<KeyRange>> ranges_by_partition(partition_count);
+  std::vector<size_t> output_offsets(partition_count + 1);
 
-void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    auto& ranges = ranges_by_partition[partition_id];
+    auto partition_size = size_t{0};
 
-std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
-      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
-  return _impl->_on_execute();
-}
-
-void Sort::_on_cleanup() { _impl.reset(); }
-
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
- public:
-  // creates a new table with reference columns
-  SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
-                            const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
-
-  std::shared_ptr<const Table> execute() {
-    // First we create a new table as the output
-    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
-
-    // We have decided against duplicating MVCC columns in https://github.com/hyrise/hyrise/issues/408
-
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input column with a reference
-    // to the output column. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
-
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
-
-    const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
-
-    // Vector of columns for each chunk
-    std::vector<ChunkColumns> output_columns_by_chunk(chunk_count_out);
-
-    // Materialize column-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_data_type(column_id);
-
-      resolve_data_type(column_data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
-
-        // Initialize value columns
-        auto columns_out = std::vector<std::shared_ptr<ValueColumn<ColumnDataType>>>(chunk_count_out);
-        std::generate(columns_out.begin(), columns_out.end(),
-                      []() { return std::make_shared<ValueColumn<ColumnDataType>>(true); });
-
-        auto column_it = columns_out.begin();
-        auto chunk_it = output_columns_by_chunk.begin();
-        auto chunk_offset_out = 0u;
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;  // NOLINT
-
-          const auto column = _table_in->get_chunk(chunk_id)->get_column(column_id);
-
-          // Previously the value was retrieved by calling a virtual method,
-          // which was just as slow as using the subscript operator.
-          const auto value = (*column)[chunk_offset];
-          (*column_it)->append(value);
-
-          ++chunk_offset_out;
-
-          // Check if value column is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            chunk_it->push_back(*column_it);
-            ++column_it;
-            ++chunk_it;
-          }
-        }
-
-        // Last column has not been added
-        if (chunk_offset_out > 0u) {
-          chunk_it->push_back(*column_it);
-        }
-      });
-    }
+    for (const auto& run : runs) {
+      const auto begin = partition_id == 0 ? run.keys.cbegin()
+                                           : std::lower_bound(run.keys.cbegin(), run.keys.cend(),
+                                                              splitters[partition_id - 1]);
+      const auto end = partition_id == partition_count - 1
+                           ? run.keys.cend()
+                           : std::lower_bound(run.keys.cbegin(), run.keys.cend(), splitters[partition_id]);
+      if (begin == end) continue;
 
-    for (auto& columns : output_columns_by_chunk) {
-      output->append_chunk(columns);
+      ranges.emplace_back(begin, end);
+      partition_size += std::distance(begin, end);
     }
 
-    return output;
+    output_offsets[partition_id + 1] = output_offsets[partition_id] + partition_size;
   }
 
- protected:
-  const std::shared_ptr<const Table> _table_in;
-  const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
-};
-
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
-  }
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(partition_count);
 
- protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto ranges = ranges_by_partition[partition_id];
+      auto output_iterator = sorted_row_ids.begin() + output_offsets[partition_id];
 
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      _sort_with_operator<std::less<>>();
-    } else {
-      _sort_with_operator<std::greater<>>();
-    }
+      // std::priority_queue is a max-heap, so the comparison is inverted to get the smallest key on top
+      const auto greater = [](const KeyRange& lhs, const KeyRange& rhs) { return *rhs.first < *lhs.first; };
+      auto heap = std::priority_queue<KeyRange, std::vector<KeyRange>, decltype(greater)>{greater, std::move(ranges)};
 
-    // 2b. Insert null rows if necessary
-    if (!_null_value_rows->empty()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
-      }
-    }
+      while (!heap.empty()) {
+        auto range = heap.top();
+        heap.pop();
+
+        *(output_iterator++) = range.first->row_id;
 
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    return materialization->execute();
+        if (++range.first != range.second) heap.push(range);
+      }
+    }));
+    jobs.back()->schedule();
   }
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+  CurrentScheduler::wait_for_tasks(jobs);
 
-    auto& null_value_rows = *_null_value_rows;
+  return sorted_row_ids;
+}
 
-    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
-      auto chunk = _table_in->get_chunk(chunk_id);
+}  // namespace
 
-      auto base_column = chunk->get_column(_column_id);
+namespace opossum {
 
-      resolve_column_type<SortColumnType>(*base_column, [&](auto& typed_column) {
-        auto iterable = create_iterable_from_column<SortColumnType>(typed_column);
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t output_chunk_size)
+    : Sort(in, std::vector<SortColumnDefinition>{SortColumnDefinition{column_id, order_by_mode}}, output_chunk_size) {}
 
-        iterable.for_each([&](const auto& value) {
-          if (value.is_null()) {
-            null_value_rows.emplace_back(RowID{chunk_id, value.chunk_offset()}, SortColumnType{});
-          } else {
-            row_id_value_vector.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
-          }
-        });
-      });
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(OperatorType::Sort, in),
+      _sort_definitions(sort_definitions),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Sort needs at least one column to sort by");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+ColumnID Sort::column_id() const { return _sort_definitions.front().column; }
+
+OrderByMode Sort::order_by_mode() const { return _sort_definitions.front().order_by_mode; }
+
+const std::string Sort::name() const { return "Sort"; }
+
+const std::string Sort::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(";
+  for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+    const auto& definition = _sort_definitions[definition_idx];
+
+    if (input_table_left()) {
+      stream << input_table_left()->column_name(definition.column);
+    } else {
+      stream << "Col #" << definition.column;
     }
+    stream << " " << order_by_mode_to_string.at(definition.order_by_mode);
+
+    if (definition_idx + 1 < _sort_definitions.size()) stream << ", ";
   }
+  stream << ")";
+
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size);
+}
+
+void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto& table_in = *input_table_left();
+
+  // 1. Create a sorted run of normalized keys for each chunk in parallel
+  std::vector<NormalizedKeyRun> runs(table_in.chunk_count());
 
-  template <typename Comparator>
-  void _sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(table_in.chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table_in.chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      runs[chunk_id] = create_normalized_key_run(table_in, chunk_id, _sort_definitions);
+      std::sort(runs[chunk_id].keys.begin(), runs[chunk_id].keys.end());
+    }));
+    jobs.back()->schedule();
   }
 
-  const std::shared_ptr<const Table> _table_in;
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  runs.erase(std::remove_if(runs.begin(), runs.end(), [](const auto& run) { return run.keys.empty(); }), runs.end());
 
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
-  const size_t _output_chunk_size;
+  // 2. Merge the runs
+  const auto sorted_row_ids = runs.empty() ? PosList{} : merge_sorted_runs(runs);
 
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
-};
+  // 3. Materialize the result
+  return materialize_rows(table_in, sorted_row_ids, _output_chunk_size);
+}
 
 }  // namespace opossum
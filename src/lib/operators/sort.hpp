@@ -1,23 +1,34 @@
 #pragma once
 
-#include <algorithm>
-#include <functional>
 #include <memory>
 #include <string>
-#include <utility>
+#include <unordered_map>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
-#include "resolve_type.hpp"
-#include "storage/create_iterable_from_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * Defines one ORDER BY criterion of the Sort operator, i.e., the column and the direction (including the position of
+ * NULLs) to sort by.
+ */
+struct SortColumnDefinition final {
+  explicit SortColumnDefinition(const ColumnID& column, const OrderByMode order_by_mode = OrderByMode::Ascending)
+      : column(column), order_by_mode(order_by_mode) {}
+
+  ColumnID column;
+  OrderByMode order_by_mode;
+};
+
+/**
+ * Operator to sort a table by one or more columns. This implements a stable sort, i.e., rows that share the same values
+ * in all sort columns will maintain their relative order.
+ *
+ * All ORDER BY values of a row are encoded into a single normalized key (see sort/sort_utils.hpp) that can be compared
+ * using memcmp. Each input chunk is turned into a sorted run in its own JobTask, the runs are then combined by a
+ * parallel multiway merge.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -25,30 +36,27 @@ class Sort : public AbstractReadOnlyOperator {
   Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
        const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::MAX_SIZE);
 
+  // The first definition is the primary sort criterion, the following ones are only used to break ties
+  Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::MAX_SIZE);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  // Column and mode of the primary sort criterion
   ColumnID column_id() const;
   OrderByMode order_by_mode() const;
 
   const std::string name() const override;
+  const std::string description(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
-  class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
 };
 
@@ -0,0 +1,219 @@
+#include "sort_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr uint8_t NULL_FIRST_MARKER = 0x00;
+constexpr uint8_t NOT_NULL_MARKER = 0x01;
+constexpr uint8_t NULL_LAST_MARKER = 0x02;
+
+template <typename UnsignedType>
+void append_big_endian(std::vector<uint8_t>& bytes, const UnsignedType value) {
+  for (auto shift = static_cast<int>(sizeof(UnsignedType) - 1) * 8; shift >= 0; shift -= 8) {
+    bytes.push_back(static_cast<uint8_t>(value >> shift));
+  }
+}
+
+template <typename T>
+void append_normalized_value(std::vector<uint8_t>& bytes, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto character : value) {
+      const auto byte = static_cast<uint8_t>(character);
+      bytes.push_back(byte);
+      if (byte == 0x00) bytes.push_back(0xFF);
+    }
+    bytes.push_back(0x00);
+    bytes.push_back(0x00);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(T) * 8 - 1);
+
+    // -0.0 and 0.0 are equal and must therefore not be distinguished by their keys
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = Bits{};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+    bits = (bits & sign_bit) ? ~bits : bits | sign_bit;
+    append_big_endian(bytes, bits);
+  } else {
+    static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "Unexpected sort column type");
+    using Bits = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(T) * 8 - 1);
+    append_big_endian(bytes, static_cast<Bits>(static_cast<Bits>(value) ^ sign_bit));
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool nulls_first(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+}
+
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+NormalizedKeyRun create_normalized_key_run(const Table& table, const ChunkID chunk_id,
+                                           const std::vector<SortColumnDefinition>& sort_definitions,
+                                           const ChunkOffsetsList* chunk_offsets) {
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto row_count = chunk_offsets ? chunk_offsets->size() : static_cast<size_t>(chunk->size());
+
+  // The keys are assembled column by column, so that each column only has to be resolved once. The per-column
+  // encodings are concatenated to the row keys afterwards.
+  std::vector<std::vector<uint8_t>> column_bytes(sort_definitions.size());
+  std::vector<std::vector<uint32_t>> column_offsets(sort_definitions.size());
+
+  for (auto definition_idx = size_t{0}; definition_idx < sort_definitions.size(); ++definition_idx) {
+    const auto& definition = sort_definitions[definition_idx];
+    auto& bytes = column_bytes[definition_idx];
+    auto& offsets = column_offsets[definition_idx];
+    offsets.reserve(row_count + 1);
+
+    const auto null_marker = nulls_first(definition.order_by_mode) ? NULL_FIRST_MARKER : NULL_LAST_MARKER;
+    const auto descending = is_descending(definition.order_by_mode);
+
+    const auto base_column = chunk->get_column(definition.column);
+    resolve_data_and_column_type(*base_column, [&](auto type, auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      if constexpr (!std::is_same_v<ColumnDataType, std::string>) {
+        bytes.reserve(row_count * (1 + sizeof(ColumnDataType)));
+      }
+
+      const auto append_value = [&](const auto& value) {
+        offsets.push_back(static_cast<uint32_t>(bytes.size()));
+
+        if (value.is_null()) {
+          bytes.push_back(null_marker);
+          return;
+        }
+
+        bytes.push_back(NOT_NULL_MARKER);
+        const auto value_begin = bytes.size();
+        append_normalized_value(bytes, value.value());
+        if (descending) {
+          std::for_each(bytes.begin() + value_begin, bytes.end(), [](auto& byte) { byte = ~byte; });
+        }
+      };
+
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+      if constexpr (std::is_same_v<std::decay_t<decltype(typed_column)>, ReferenceColumn>) {
+        Assert(!chunk_offsets, "Normalized keys of selected rows cannot be built for ReferenceColumns");
+        iterable.for_each(append_value);
+      } else {
+        iterable.for_each(chunk_offsets, append_value);
+      }
+    });
+
+    offsets.push_back(static_cast<uint32_t>(bytes.size()));
+    DebugAssert(offsets.size() == row_count + 1, "Iterable did not visit every row of the column");
+  }
+
+  auto run = NormalizedKeyRun{};
+
+  auto key_byte_count = row_count * (sizeof(ChunkID) + sizeof(ChunkOffset));
+  for (const auto& bytes : column_bytes) key_byte_count += bytes.size();
+  run.key_bytes.reserve(key_byte_count);
+
+  // Holds the offsets of the keys until the key buffer is complete and pointers into it become stable
+  std::vector<uint32_t> key_offsets(row_count + 1);
+
+  const auto row_chunk_offset = [&](const size_t row_idx) {
+    return chunk_offsets ? (*chunk_offsets)[row_idx].into_referenced : static_cast<ChunkOffset>(row_idx);
+  };
+
+  for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+    key_offsets[row_idx] = static_cast<uint32_t>(run.key_bytes.size());
+
+    for (auto definition_idx = size_t{0}; definition_idx < sort_definitions.size(); ++definition_idx) {
+      const auto& bytes = column_bytes[definition_idx];
+      const auto& offsets = column_offsets[definition_idx];
+      run.key_bytes.insert(run.key_bytes.end(), bytes.begin() + offsets[row_idx], bytes.begin() + offsets[row_idx + 1]);
+    }
+
+    append_big_endian(run.key_bytes, static_cast<uint32_t>(chunk_id));
+    append_big_endian(run.key_bytes, static_cast<uint32_t>(row_chunk_offset(row_idx)));
+  }
+  key_offsets[row_count] = static_cast<uint32_t>(run.key_bytes.size());
+
+  run.keys.reserve(row_count);
+  for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+    run.keys.emplace_back(NormalizedKey{run.key_bytes.data() + key_offsets[row_idx],
+                                        key_offsets[row_idx + 1] - key_offsets[row_idx],
+                                        RowID{chunk_id, row_chunk_offset(row_idx)}});
+  }
+
+  return run;
+}
+
+std::shared_ptr<Table> materialize_rows(const Table& table, const PosList& row_ids, const size_t output_chunk_size) {
+  // We have decided against duplicating MVCC columns in https://github.com/hyrise/hyrise/issues/408
+  auto output = std::make_shared<Table>(table.column_definitions(), TableType::Data, output_chunk_size);
+
+  // Because the values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead, each
+  // output chunk is filled in its own JobTask by copying the values of its rows column by column.
+  const auto row_count_out = row_ids.size();
+  const auto chunk_count_out = (row_count_out + output_chunk_size - 1) / output_chunk_size;
+
+  std::vector<ChunkColumns> output_columns_by_chunk(chunk_count_out);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count_out);
+
+  for (auto output_chunk_idx = size_t{0}; output_chunk_idx < chunk_count_out; ++output_chunk_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, output_chunk_idx]() {
+      const auto row_begin = row_ids.begin() + output_chunk_idx * output_chunk_size;
+      const auto row_end =
+          row_ids.begin() + std::min((output_chunk_idx + 1) * output_chunk_size, row_count_out);
+
+      auto& columns_out = output_columns_by_chunk[output_chunk_idx];
+
+      for (ColumnID column_id{0u}; column_id < table.column_count(); ++column_id) {
+        resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto column_out = std::make_shared<ValueColumn<ColumnDataType>>(true);
+          column_out->values().reserve(std::distance(row_begin, row_end));
+          column_out->null_values().reserve(std::distance(row_begin, row_end));
+
+          for (auto row_it = row_begin; row_it != row_end; ++row_it) {
+            const auto column = table.get_chunk(row_it->chunk_id)->get_column(column_id);
+            column_out->append((*column)[row_it->chunk_offset]);
+          }
+
+          columns_out.push_back(column_out);
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (auto& columns : output_columns_by_chunk) {
+    output->append_chunk(columns);
+  }
+
+  return output;
+}
+
+}  // namespace opossum
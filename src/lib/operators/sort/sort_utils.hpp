@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "operators/sort.hpp"
+#include "storage/column_iterables/chunk_offset_mapping.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A normalized key encodes all ORDER BY values of a row into a byte string such that comparing the byte strings of two
+ * rows with memcmp yields the order of the rows. For each sort column, the key contains
+ *   - one byte that places NULLs before or after all other values and
+ *   - for non-NULL values, an order-preserving binary encoding of the value. Integers are stored big-endian with their
+ *     sign bit flipped, floats additionally invert all bits if they are negative. Strings escape their zero bytes and
+ *     are terminated by two zero bytes, so that shorter strings sort before longer strings sharing the same prefix.
+ *     For descending columns, these bytes are inverted.
+ * Finally, the RowID is appended. This makes all keys unique, so that sorting them yields the same order as a stable
+ * sort of the input.
+ */
+struct NormalizedKey {
+  const uint8_t* data;
+  uint32_t size;
+  RowID row_id;
+};
+
+inline bool operator<(const NormalizedKey& lhs, const NormalizedKey& rhs) {
+  const auto result = std::memcmp(lhs.data, rhs.data, std::min(lhs.size, rhs.size));
+  return result < 0 || (result == 0 && lhs.size < rhs.size);
+}
+
+// The normalized keys of (some of) the rows of a chunk. The keys point into key_bytes.
+struct NormalizedKeyRun {
+  std::vector<uint8_t> key_bytes;
+  std::vector<NormalizedKey> keys;
+};
+
+// Whether NULLs are placed before all other values (true for Ascending and Descending)
+bool nulls_first(const OrderByMode order_by_mode);
+
+bool is_descending(const OrderByMode order_by_mode);
+
+/**
+ * Builds the (unsorted) normalized keys of a chunk. If chunk_offsets is given, keys are only built for these rows,
+ * which requires the chunk not to contain ReferenceColumns.
+ */
+NormalizedKeyRun create_normalized_key_run(const Table& table, const ChunkID chunk_id,
+                                           const std::vector<SortColumnDefinition>& sort_definitions,
+                                           const ChunkOffsetsList* chunk_offsets = nullptr);
+
+/**
+ * Creates a data table that contains the values of the given rows of table in the given order. One JobTask is used per
+ * output chunk.
+ */
+std::shared_ptr<Table> materialize_rows(const Table& table, const PosList& row_ids, const size_t output_chunk_size);
+
+}  // namespace opossum
@@ -31,7 +31,7 @@ namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, ColumnID left_column_id,
                      const PredicateCondition predicate_condition, const AllParameterVariant& right_parameter)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in},
+    : AbstractChunkwiseOperator{OperatorType::TableScan, in},
       _left_column_id{left_column_id},
       _predicate_condition{predicate_condition},
       _right_parameter{right_parameter} {}
@@ -48,6 +48,8 @@ const AllParameterVariant& TableScan::right_parameter() const { return _right_pa
 
 const std::string TableScan::name() const { return "TableScan"; }
 
+bool TableScan::can_be_pipelined() const { return _excluded_chunk_ids.empty(); }
+
 const std::string TableScan::description(DescriptionMode description_mode) const {
   std::string column_name = std::string("Col #") + std::to_string(_left_column_id);
 
@@ -72,13 +74,14 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<TableScan>(copied_input_left, _left_column_id, _predicate_condition, _right_parameter);
+  const auto copy =
+      std::make_shared<TableScan>(copied_input_left, _left_column_id, _predicate_condition, _right_parameter);
+  copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  return copy;
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
-  _in_table = input_table_left();
-
-  _init_scan();
+  _on_prepare_chunks(input_table_left());
 
   _output_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
@@ -94,80 +97,99 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
     auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
       const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
+
+      const auto out_columns = _on_execute_chunk(_in_table, chunk_id, nullptr);
+      if (out_columns.empty()) return;
 
       // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
       // towards the original chunk.
-      ChunkColumns out_columns;
+      std::lock_guard<std::mutex> lock(output_mutex);
+      _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
+    });
+
+    jobs.push_back(job_task);
+    job_task->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
 
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference columns of the output. If it is a reference column,
-       * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between columns as much as possible. Position lists can be shared between two columns iff
-       * (a) they point to the same table and
-       * (b) the reference columns of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (_in_table->type() == TableType::References) {
-        const auto chunk_in = _in_table->get_chunk(chunk_id);
+  return _output_table;
+}
 
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+void TableScan::_on_prepare_chunks(const std::shared_ptr<const Table>& in_table) {
+  _in_table = in_table;
+  _impl = _create_impl(_in_table);
+}
 
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto column_in = chunk_in->get_column(column_id);
+ChunkColumns TableScan::_on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                          const std::shared_ptr<TransactionContext>& transaction_context) {
+  // Morsels of a pipeline are tables of their own, each of them needs a separate scan implementation
+  auto morsel_impl = std::unique_ptr<BaseTableScanImpl>{};
+  if (in_table != _in_table) morsel_impl = _create_impl(in_table);
+  auto& impl = morsel_impl ? *morsel_impl : *_impl;
 
-          auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
-          DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = impl.scan_chunk(chunk_id);
+  if (matches_out->empty()) return {};
 
-          const auto pos_list_in = ref_column_in->pos_list();
+  ChunkColumns out_columns;
 
-          const auto table_out = ref_column_in->referenced_table();
-          const auto column_id_out = ref_column_in->referenced_column_id();
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+   * directly use the matches to construct the reference columns of the output. If it is a reference column,
+   * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between columns as much as possible. Position lists can be shared between two columns iff
+   * (a) they point to the same table and
+   * (b) the reference columns of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (in_table->type() == TableType::References) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
 
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto column_in = chunk_in->get_column(column_id);
 
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
-          }
+      auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
+      DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
 
-          auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
-          out_columns.push_back(ref_column_out);
-        }
-      } else {
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-          out_columns.push_back(ref_column_out);
+      const auto pos_list_in = ref_column_in->pos_list();
+
+      const auto table_out = ref_column_in->referenced_table();
+      const auto column_id_out = ref_column_in->referenced_column_id();
+
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(matches_out->size());
+
+        for (const auto& match : *matches_out) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          filtered_pos_list->push_back(row_id);
         }
       }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
-
-    jobs.push_back(job_task);
-    job_task->schedule();
+      auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
+      out_columns.push_back(ref_column_out);
+    }
+  } else {
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto ref_column_out = std::make_shared<ReferenceColumn>(in_table, column_id, matches_out);
+      out_columns.push_back(ref_column_out);
+    }
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
-
-  return _output_table;
+  return out_columns;
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
 
-void TableScan::_init_scan() {
+std::unique_ptr<BaseTableScanImpl> TableScan::_create_impl(const std::shared_ptr<const Table>& in_table) const {
   if (_predicate_condition == PredicateCondition::Like || _predicate_condition == PredicateCondition::NotLike) {
-    const auto left_column_type = _in_table->column_data_type(_left_column_id);
+    const auto left_column_type = in_table->column_data_type(_left_column_id);
     Assert((left_column_type == DataType::String), "LIKE operator only applicable on string columns.");
 
     DebugAssert(is_variant(_right_parameter), "Right parameter must be variant.");
@@ -178,26 +200,23 @@ void TableScan::_init_scan() {
 
     const auto right_wildcard = type_cast<std::string>(right_value);
 
-    _impl = std::make_unique<LikeTableScanImpl>(_in_table, _left_column_id, _predicate_condition, right_wildcard);
-
-    return;
+    return std::make_unique<LikeTableScanImpl>(in_table, _left_column_id, _predicate_condition, right_wildcard);
   }
 
   if (_predicate_condition == PredicateCondition::IsNull || _predicate_condition == PredicateCondition::IsNotNull) {
-    _impl = std::make_unique<IsNullTableScanImpl>(_in_table, _left_column_id, _predicate_condition);
-    return;
+    return std::make_unique<IsNullTableScanImpl>(in_table, _left_column_id, _predicate_condition);
   }
 
   if (is_variant(_right_parameter)) {
     const auto right_value = boost::get<AllTypeVariant>(_right_parameter);
 
-    _impl = std::make_unique<SingleColumnTableScanImpl>(_in_table, _left_column_id, _predicate_condition, right_value);
-  } else /* is_column_name(_right_parameter) */ {
-    const auto right_column_id = boost::get<ColumnID>(_right_parameter);
-
-    _impl = std::make_unique<ColumnComparisonTableScanImpl>(_in_table, _left_column_id, _predicate_condition,
-                                                            right_column_id);
+    return std::make_unique<SingleColumnTableScanImpl>(in_table, _left_column_id, _predicate_condition, right_value);
   }
+
+  // is_column_name(_right_parameter)
+  const auto right_column_id = boost::get<ColumnID>(_right_parameter);
+  return std::make_unique<ColumnComparisonTableScanImpl>(in_table, _left_column_id, _predicate_condition,
+                                                          right_column_id);
 }
 
 }  // namespace opossum
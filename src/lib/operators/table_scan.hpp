@@ -5,7 +5,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -15,7 +15,7 @@ namespace opossum {
 class BaseTableScanImpl;
 class Table;
 
-class TableScan : public AbstractReadOnlyOperator {
+class TableScan : public AbstractChunkwiseOperator {
   friend class LQPTranslatorTest;
 
  public:
@@ -47,6 +47,9 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  // The excluded chunk ids refer to the complete input table, so the scan is not executed as part of a pipeline
+  bool can_be_pipelined() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -58,7 +61,12 @@ class TableScan : public AbstractReadOnlyOperator {
 
   void _on_cleanup() override;
 
-  void _init_scan();
+  void _on_prepare_chunks(const std::shared_ptr<const Table>& in_table) override;
+
+  ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                 const std::shared_ptr<TransactionContext>& transaction_context) override;
+
+  std::unique_ptr<BaseTableScanImpl> _create_impl(const std::shared_ptr<const Table>& in_table) const;
 
  private:
   const ColumnID _left_column_id;
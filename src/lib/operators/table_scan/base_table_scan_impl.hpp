@@ -1,5 +1,11 @@
 #pragma once
 
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
 #include <functional>
 #include <memory>
 
@@ -77,6 +83,81 @@ class BaseTableScanImpl {
     }
   }
 
+  // Number of values that are evaluated at once by _unary_scan_block
+  static constexpr auto SCAN_BLOCK_SIZE = size_t{1024};
+
+  /**
+   * Version of _unary_scan for a block of at most SCAN_BLOCK_SIZE values that are stored contiguously, optionally
+   * accompanied by their contiguous null values. The first value of the block is at chunk offset block_offset.
+   *
+   * First, the functor is evaluated for all values of the block. This loop does not contain any branches, so the
+   * compiler vectorizes it and compares 8 to 32 values per instruction, depending on the data type and the instruction
+   * set. Afterwards, the resulting match bytes are turned into bitmasks using movemask and only the set bits are
+   * visited to append the matching offsets to matches_out.
+   */
+  template <typename UnaryFunctor, typename T>
+  void __attribute__((noinline))
+  _unary_scan_block(const UnaryFunctor& func, const T* values, const bool* null_values, const ChunkOffset block_offset,
+                    const size_t block_size, const ChunkID chunk_id, PosList& matches_out) {
+    DebugAssert(block_size <= SCAN_BLOCK_SIZE, "Block is too large");
+
+    alignas(32) std::array<uint8_t, SCAN_BLOCK_SIZE> block_matches;
+
+    for (auto index = size_t{0}; index < block_size; ++index) {
+      block_matches[index] = static_cast<uint8_t>(func(values[index]));
+    }
+
+    if (null_values) {
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        block_matches[index] &= static_cast<uint8_t>(!null_values[index]);
+      }
+    }
+
+    const auto append_mask = [&](const size_t first_index, uint32_t mask) {
+      while (mask != 0u) {
+        const auto chunk_offset = static_cast<ChunkOffset>(block_offset + first_index + __builtin_ctz(mask));
+        matches_out.push_back(RowID{chunk_id, chunk_offset});
+        mask &= mask - 1u;
+      }
+    };
+
+    auto index = size_t{0};
+
+#ifdef __AVX2__
+    for (; index + 32 <= block_size; index += 32) {
+      const auto bytes = _mm256_load_si256(reinterpret_cast<const __m256i*>(block_matches.data() + index));
+      const auto zero_bytes = _mm256_cmpeq_epi8(bytes, _mm256_setzero_si256());
+      const auto zero_mask = static_cast<uint32_t>(_mm256_movemask_epi8(zero_bytes));
+      append_mask(index, ~zero_mask);
+    }
+#endif
+
+#ifdef __SSE2__
+    for (; index + 16 <= block_size; index += 16) {
+      const auto bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(block_matches.data() + index));
+      const auto zero_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_setzero_si128())));
+      append_mask(index, ~zero_mask & 0xFFFFu);
+    }
+#endif
+
+    for (; index < block_size; ++index) {
+      if (block_matches[index]) {
+        matches_out.push_back(RowID{chunk_id, static_cast<ChunkOffset>(block_offset + index)});
+      }
+    }
+  }
+
+  // Scans size contiguously stored values without NULLs using _unary_scan_block
+  template <typename UnaryFunctor, typename T>
+  void _unary_scan_contiguous(const UnaryFunctor& func, const T* values, const size_t size, const ChunkID chunk_id,
+                              PosList& matches_out) {
+    for (auto block_begin = size_t{0}; block_begin < size; block_begin += SCAN_BLOCK_SIZE) {
+      const auto block_size = std::min(SCAN_BLOCK_SIZE, size - block_begin);
+      _unary_scan_block(func, values + block_begin, static_cast<const bool*>(nullptr),
+                        static_cast<ChunkOffset>(block_begin), block_size, chunk_id, matches_out);
+    }
+  }
+
   /**@}*/
 
  protected:
@@ -61,9 +61,12 @@ void LikeTableScanImpl::handle_column(const BaseDictionaryColumn& base_column,
   if (base_column.encoding_type() == EncodingType::Dictionary) {
     const auto& left_column = static_cast<const DictionaryColumn<std::string>&>(base_column);
     result = _find_matches_in_dictionary(*left_column.dictionary());
-  } else {
+  } else if (base_column.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& left_column = static_cast<const FixedStringDictionaryColumn<std::string>&>(base_column);
     result = _find_matches_in_dictionary(*left_column.dictionary());
+  } else {
+    const auto& left_column = static_cast<const FrontCodedDictionaryColumn<std::string>&>(base_column);
+    result = _find_matches_in_dictionary(*left_column.dictionary());
   }
 
   const auto& match_count = result.first;
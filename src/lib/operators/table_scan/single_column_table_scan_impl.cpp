@@ -1,6 +1,9 @@
 #include "single_column_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -8,10 +11,24 @@
 #include "storage/column_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/resolve_encoded_column_type.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+struct is_fixed_size_byte_aligned_vector : std::false_type {};
+
+template <typename UnsignedIntType>
+struct is_fixed_size_byte_aligned_vector<FixedSizeByteAlignedVector<UnsignedIntType>> : std::true_type {};
+
+}  // namespace
+
 namespace opossum {
 
 SingleColumnTableScanImpl::SingleColumnTableScanImpl(const std::shared_ptr<const Table>& in_table,
@@ -49,6 +66,13 @@ void SingleColumnTableScanImpl::handle_column(const BaseValueColumn& base_column
 
     auto& left_column = static_cast<const ValueColumn<ColumnDataType>&>(base_column);
 
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (!mapped_chunk_offsets) {
+        _scan_value_column_in_blocks(left_column, chunk_id, matches_out);
+        return;
+      }
+    }
+
     auto left_column_iterable = create_iterable_from_column(left_column);
 
     left_column_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
@@ -135,6 +159,25 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& base_c
     return;
   }
 
+  if (!mapped_chunk_offsets) {
+    auto scanned = false;
+    resolve_compressed_vector_type(*base_column.attribute_vector(), [&](const auto& attribute_vector) {
+      using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+
+      if constexpr (is_fixed_size_byte_aligned_vector<AttributeVectorType>::value) {
+        _scan_attribute_vector_in_blocks(attribute_vector.data(), base_column.null_value_id(), search_value_id,
+                                         chunk_id, matches_out);
+        scanned = true;
+      } else if constexpr (std::is_same_v<AttributeVectorType, SimdBp128Vector>) {
+        _scan_simd_bp128_vector(attribute_vector, base_column.null_value_id(), search_value_id, chunk_id,
+                                matches_out);
+        scanned = true;
+      }
+    });
+
+    if (scanned) return;
+  }
+
   left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
     this->_with_operator_for_dict_column_scan(_predicate_condition, [&](auto comparator) {
       this->_unary_scan_with_value(comparator, left_it, left_end, search_value_id, chunk_id, matches_out);
@@ -142,6 +185,104 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& base_c
   });
 }
 
+void SingleColumnTableScanImpl::_scan_simd_bp128_vector(const SimdBp128Vector& attribute_vector,
+                                                        const ValueID null_value_id, const ValueID search_value_id,
+                                                        const ChunkID chunk_id, PosList& matches_out) const {
+  /**
+   * Each predicate is reduced to lower <= value_id < upper && value_id != excluded. Except for NotEquals, NULLs
+   * (null_value_id) are outside of the range anyway and excluded is set to null_value_id.
+   */
+  auto lower = ValueID{0u};
+  auto upper = null_value_id;
+  auto excluded = null_value_id;
+
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      lower = search_value_id;
+      upper = ValueID{search_value_id + 1u};
+      break;
+
+    case PredicateCondition::NotEquals:
+      excluded = search_value_id;
+      break;
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      upper = search_value_id;
+      break;
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      lower = search_value_id;
+      break;
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+
+  attribute_vector.scan_blocks(lower, upper, excluded, [&](const size_t first_index, const auto& matches) {
+    for (auto word_index = size_t{0u}; word_index < matches.size(); ++word_index) {
+      auto word = matches[word_index];
+
+      while (word != 0u) {
+        const auto chunk_offset = static_cast<ChunkOffset>(first_index + word_index * 64u + __builtin_ctzll(word));
+        matches_out.push_back(RowID{chunk_id, chunk_offset});
+        word &= word - 1u;
+      }
+    }
+  });
+}
+
+template <typename T>
+void SingleColumnTableScanImpl::_scan_value_column_in_blocks(const ValueColumn<T>& column, const ChunkID chunk_id,
+                                                             PosList& matches_out) {
+  const auto& values = column.values();
+  const auto nullable = column.is_nullable();
+  const auto right_value = type_cast<T>(_right_value);
+
+  // The values of a ValueColumn are stored in a tbb::concurrent_vector, which is not contiguous. Thus, each block is
+  // copied into a contiguous buffer first.
+  std::array<T, SCAN_BLOCK_SIZE> value_buffer;
+  std::array<bool, SCAN_BLOCK_SIZE> null_value_buffer;
+
+  with_comparator(_predicate_condition, [&](auto comparator) {
+    const auto predicate = [&](const T& value) { return comparator(value, right_value); };
+
+    for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += SCAN_BLOCK_SIZE) {
+      const auto block_size = std::min(SCAN_BLOCK_SIZE, values.size() - block_begin);
+
+      std::copy_n(values.cbegin() + block_begin, block_size, value_buffer.begin());
+      if (nullable) {
+        std::copy_n(column.null_values().cbegin() + block_begin, block_size, null_value_buffer.begin());
+      }
+
+      _unary_scan_block(predicate, value_buffer.data(), nullable ? null_value_buffer.data() : nullptr,
+                        static_cast<ChunkOffset>(block_begin), block_size, chunk_id, matches_out);
+    }
+  });
+}
+
+template <typename UnsignedIntType>
+void SingleColumnTableScanImpl::_scan_attribute_vector_in_blocks(const pmr_vector<UnsignedIntType>& attribute_vector,
+                                                                 const ValueID null_value_id,
+                                                                 const ValueID search_value_id, const ChunkID chunk_id,
+                                                                 PosList& matches_out) {
+  // After the early outs, search_value_id is a valid value ID and thus fits into the attribute vector's type
+  DebugAssert(search_value_id <= null_value_id, "Search value ID should be a valid value ID");
+
+  const auto typed_search_value_id = static_cast<UnsignedIntType>(search_value_id);
+  const auto typed_null_value_id = static_cast<UnsignedIntType>(null_value_id);
+
+  _with_operator_for_dict_column_scan(_predicate_condition, [&](auto comparator) {
+    // NULLs are encoded as null_value_id in the attribute vector. Using & instead of && avoids a branch.
+    const auto predicate = [&](const UnsignedIntType value_id) {
+      return comparator(value_id, typed_search_value_id) & (value_id != typed_null_value_id);
+    };
+
+    _unary_scan_contiguous(predicate, attribute_vector.data(), attribute_vector.size(), chunk_id, matches_out);
+  });
+}
+
 ValueID SingleColumnTableScanImpl::_get_search_value_id(const BaseDictionaryColumn& column) const {
   switch (_predicate_condition) {
     case PredicateCondition::Equals:
@@ -13,6 +13,11 @@
 
 namespace opossum {
 
+class SimdBp128Vector;
+
+template <typename T>
+class ValueColumn;
+
 /**
  * @brief Compares one column to a constant value
  *
@@ -38,6 +43,10 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
   using BaseSingleColumnTableScanImpl::handle_column;
 
  private:
+  // Scans an entire numeric ValueColumn block-wise using _unary_scan_block
+  template <typename T>
+  void _scan_value_column_in_blocks(const ValueColumn<T>& column, const ChunkID chunk_id, PosList& matches_out);
+
   /**
    * @defgroup Methods used for handling dictionary columns
    * @{
@@ -49,6 +58,22 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   bool _right_value_matches_none(const BaseDictionaryColumn& column, const ValueID search_value_id) const;
 
+  /**
+   * Scans the entire attribute vector of a dictionary column whose value IDs are stored in a FixedSizeByteAlignedVector
+   * without iterators, using _unary_scan_contiguous.
+   */
+  template <typename UnsignedIntType>
+  void _scan_attribute_vector_in_blocks(const pmr_vector<UnsignedIntType>& attribute_vector,
+                                        const ValueID null_value_id, const ValueID search_value_id,
+                                        const ChunkID chunk_id, PosList& matches_out);
+
+  /**
+   * Scans the entire attribute vector of a dictionary column whose value IDs are stored in a SimdBp128Vector. The
+   * predicate is evaluated on the packed blocks without decompressing them into memory first.
+   */
+  void _scan_simd_bp128_vector(const SimdBp128Vector& attribute_vector, const ValueID null_value_id,
+                               const ValueID search_value_id, const ChunkID chunk_id, PosList& matches_out) const;
+
   template <typename Functor>
   void _with_operator_for_dict_column_scan(const PredicateCondition predicate_condition, const Functor& func) const {
     switch (predicate_condition) {
@@ -0,0 +1,166 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/sort_utils.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * For a dictionary-encoded column, returns the offsets of all rows that can be among the first k rows of the chunk
+ * according to this column. The value IDs are counted and visited in sort order until k rows are covered, only rows
+ * with one of these value IDs are candidates. Returns std::nullopt if no rows can be skipped this way.
+ */
+std::optional<ChunkOffsetsList> dictionary_candidates(const BaseColumn& column, const OrderByMode order_by_mode,
+                                                      const size_t k) {
+  const auto dictionary_column = dynamic_cast<const BaseDictionaryColumn*>(&column);
+  if (!dictionary_column) return std::nullopt;
+
+  const auto null_value_id = dictionary_column->null_value_id();
+  if (static_cast<size_t>(null_value_id) != dictionary_column->unique_values_count()) return std::nullopt;
+
+  // Value IDs are ordered like their values, the NULL value ID is the last one
+  auto value_id_counts = std::vector<size_t>(null_value_id + 1);
+  resolve_compressed_vector_type(*dictionary_column->attribute_vector(), [&](const auto& attribute_vector) {
+    for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend(); ++value_id_it) {
+      ++value_id_counts[*value_id_it];
+    }
+  });
+
+  auto is_candidate = std::vector<bool>(null_value_id + 1, false);
+  auto covered_row_count = size_t{0};
+  const auto visit = [&](const ValueID value_id) {
+    if (covered_row_count >= k) return;
+    is_candidate[value_id] = true;
+    covered_row_count += value_id_counts[value_id];
+  };
+
+  if (nulls_first(order_by_mode)) visit(null_value_id);
+  if (is_descending(order_by_mode)) {
+    for (auto value_id = null_value_id; value_id > 0; --value_id) visit(ValueID{value_id - 1});
+  } else {
+    for (ValueID value_id{0}; value_id < null_value_id; ++value_id) visit(value_id);
+  }
+  if (!nulls_first(order_by_mode)) visit(null_value_id);
+
+  if (covered_row_count == column.size()) return std::nullopt;
+
+  auto candidates = ChunkOffsetsList{};
+  candidates.reserve(covered_row_count);
+  resolve_compressed_vector_type(*dictionary_column->attribute_vector(), [&](const auto& attribute_vector) {
+    auto chunk_offset = ChunkOffset{0};
+    for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+         ++value_id_it, ++chunk_offset) {
+      if (is_candidate[*value_id_it]) candidates.emplace_back(ChunkOffsetMapping{chunk_offset, chunk_offset});
+    }
+  });
+
+  return candidates;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression, const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "TopK needs at least one column to sort by");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopK>(copied_input_left, _sort_definitions, _row_count_expression->deep_copy(),
+                                _output_chunk_size);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto& table_in = *input_table_left();
+
+  const auto num_rows_expression_result =
+      ExpressionEvaluator{}.evaluate_expression_to_result<int64_t>(*_row_count_expression);
+  Assert(num_rows_expression_result->size() == 1, "Expected exactly one row for TopK");
+  Assert(!num_rows_expression_result->is_null(0), "Expected non-null for TopK");
+
+  const auto signed_num_rows = num_rows_expression_result->value(0);
+  Assert(signed_num_rows >= 0, "Can't TopK to a negative number of Rows");
+
+  const auto k = static_cast<size_t>(signed_num_rows);
+
+  // 1. Select the first k rows of each chunk in parallel
+  std::vector<NormalizedKeyRun> runs(table_in.chunk_count());
+
+  if (k > 0) {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(table_in.chunk_count());
+
+    for (ChunkID chunk_id{0}; chunk_id < table_in.chunk_count(); ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        const auto& primary_definition = _sort_definitions.front();
+        const auto candidates =
+            dictionary_candidates(*table_in.get_chunk(chunk_id)->get_column(primary_definition.column),
+                                  primary_definition.order_by_mode, k);
+
+        auto& run = runs[chunk_id];
+        run = create_normalized_key_run(table_in, chunk_id, _sort_definitions, candidates ? &*candidates : nullptr);
+
+        if (run.keys.size() > k) {
+          std::nth_element(run.keys.begin(), run.keys.begin() + k, run.keys.end());
+          run.keys.resize(k);
+        }
+      }));
+      jobs.back()->schedule();
+    }
+
+    CurrentScheduler::wait_for_tasks(jobs);
+  }
+
+  // 2. Order the selected rows of all chunks and keep the first k
+  std::vector<NormalizedKey> keys;
+  for (const auto& run : runs) keys.insert(keys.end(), run.keys.begin(), run.keys.end());
+
+  const auto output_row_count = std::min(k, keys.size());
+  std::partial_sort(keys.begin(), keys.begin() + output_row_count, keys.end());
+
+  auto row_ids = PosList(output_row_count);
+  std::transform(keys.begin(), keys.begin() + output_row_count, row_ids.begin(),
+                 [](const auto& key) { return key.row_id; });
+
+  // 3. Materialize the result
+  return materialize_rows(table_in, row_ids, _output_chunk_size);
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+}  // namespace opossum
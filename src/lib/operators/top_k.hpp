@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "sort.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first k rows of its input in the order given by the sort columns, i.e., the same result as
+ * a Limit on top of a Sort. Instead of sorting the entire input, each chunk only selects its k smallest rows (by their
+ * normalized keys, see sort/sort_utils.hpp) in its own JobTask. The selected rows of all chunks are then sorted to
+ * obtain the result. Ties are broken by the position in the input, as in Sort.
+ *
+ * If the primary sort column of a chunk is dictionary-encoded, the chunk's value IDs are counted first to determine
+ * which value IDs can make it into the first k rows. Normalized keys are only built for the rows with these value IDs.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression,
+       const size_t output_chunk_size = Chunk::MAX_SIZE);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+  const size_t _output_chunk_size;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #include "validate.hpp"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,16 +11,12 @@
 #include "storage/reference_column.hpp"
 #include "utils/assert.hpp"
 
-namespace opossum {
-
 namespace {
 
-bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
-                    const MvccColumns& columns) {
-  const auto row_tid = columns.tids[chunk_offset].load();
-  const auto begin_cid = columns.begin_cids[chunk_offset];
-  const auto end_cid = columns.end_cids[chunk_offset];
+using namespace opossum;  // NOLINT
 
+bool is_row_visible(const TransactionID our_tid, const CommitID snapshot_commit_id, const TransactionID row_tid,
+                    const CommitID begin_cid, const CommitID end_cid) {
   // Taken from: https://github.com/hyrise/hyrise/blob/master/docs/documentation/queryexecution/tx.rst
   // auto own_insert = (our_tid == row_tid) && !(snapshot_commit_id >= begin_cid) && !(snapshot_commit_id >= end_cid);
   // auto past_insert = (our_tid != row_tid) && (snapshot_commit_id >= begin_cid) && !(snapshot_commit_id >= end_cid);
@@ -28,10 +26,63 @@ bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset c
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+bool is_row_visible(const TransactionID our_tid, const CommitID snapshot_commit_id, const ChunkOffset chunk_offset,
+                    const MvccColumns& columns) {
+  return is_row_visible(our_tid, snapshot_commit_id, columns.tids[chunk_offset].load(),
+                        columns.begin_cids[chunk_offset], columns.end_cids[chunk_offset]);
+}
+
+/**
+ * Appends the visible rows of a chunk to pos_list. The MVCC columns are copied block-wise into contiguous buffers (they
+ * are stored in tbb::concurrent_vectors), so that the visibility of a block can be evaluated without branches into a
+ * bitmap. Only the set bits of the bitmap are visited to build the pos_list.
+ */
+void append_visible_rows(const TransactionID our_tid, const CommitID snapshot_commit_id, const ChunkID chunk_id,
+                         const ChunkOffset chunk_size, const MvccColumns& columns, PosList& pos_list) {
+  constexpr auto BLOCK_SIZE = ChunkOffset{1024};
+  constexpr auto BITS_PER_WORD = ChunkOffset{64};
+
+  std::array<TransactionID, BLOCK_SIZE> tids;
+  std::array<CommitID, BLOCK_SIZE> begin_cids;
+  std::array<CommitID, BLOCK_SIZE> end_cids;
+  std::array<uint64_t, BLOCK_SIZE / BITS_PER_WORD> visible_rows;
+
+  auto tid_it = columns.tids.cbegin();
+  auto begin_cid_it = columns.begin_cids.cbegin();
+  auto end_cid_it = columns.end_cids.cbegin();
+
+  for (auto block_begin = ChunkOffset{0}; block_begin < chunk_size; block_begin += BLOCK_SIZE) {
+    const auto block_size = std::min(BLOCK_SIZE, chunk_size - block_begin);
+
+    for (auto index = ChunkOffset{0}; index < block_size; ++index, ++tid_it, ++begin_cid_it, ++end_cid_it) {
+      tids[index] = tid_it->load();
+      begin_cids[index] = *begin_cid_it;
+      end_cids[index] = *end_cid_it;
+    }
+
+    visible_rows.fill(0u);
+    for (auto index = ChunkOffset{0}; index < block_size; ++index) {
+      const auto visible = is_row_visible(our_tid, snapshot_commit_id, tids[index], begin_cids[index], end_cids[index]);
+      visible_rows[index / BITS_PER_WORD] |= static_cast<uint64_t>(visible) << (index % BITS_PER_WORD);
+    }
+
+    for (auto word_index = ChunkOffset{0}; word_index * BITS_PER_WORD < block_size; ++word_index) {
+      auto word = visible_rows[word_index];
+      while (word != 0u) {
+        const auto chunk_offset = block_begin + word_index * BITS_PER_WORD + __builtin_ctzll(word);
+        pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+        word &= word - 1u;
+      }
+    }
+  }
+}
+
 }  // namespace
 
+namespace opossum {
+
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
-    : AbstractReadOnlyOperator(OperatorType::Validate, in) {}
+    : AbstractChunkwiseOperator(OperatorType::Validate, in) {}
 
 const std::string Validate::name() const { return "Validate"; }
 
@@ -53,70 +104,89 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto in_table = input_table_left();
   auto output = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
 
+  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    const auto output_columns = _on_execute_chunk(in_table, chunk_id, transaction_context);
+    if (!output_columns.empty()) {
+      output->append_chunk(output_columns);
+    }
+  }
+  return output;
+}
+
+ChunkColumns Validate::_on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                         const std::shared_ptr<TransactionContext>& transaction_context) {
+  DebugAssert(transaction_context != nullptr, "Validate requires a valid TransactionContext.");
+
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = in_table->get_chunk(chunk_id);
+  // The summary of the MVCC columns does not know about rows that are locked by this transaction (e.g., for a
+  // Delete). Those are invisible to us, so the summary can only be used if we have not modified any rows.
+  const auto all_rows_visible_fast_path = !transaction_context->has_read_write_operators();
 
-    ChunkColumns output_columns;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(ColumnID{0}));
+  const auto chunk_in = in_table->get_chunk(chunk_id);
 
-    // If the columns in this chunk reference a column, build a poslist for a reference column.
-    if (ref_col_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+  ChunkColumns output_columns;
+  auto pos_list_out = std::make_shared<PosList>();
+  auto referenced_table = std::shared_ptr<const Table>();
+  const auto ref_col_in = std::dynamic_pointer_cast<const ReferenceColumn>(chunk_in->get_column(ColumnID{0}));
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_col_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC columns");
+  // If the columns in this chunk reference a column, build a poslist for a reference column.
+  if (ref_col_in) {
+    DebugAssert(chunk_in->references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
 
-      for (auto row_id : *ref_col_in->pos_list()) {
-        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+    // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+    referenced_table = ref_col_in->referenced_table();
+    DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC columns");
 
-        auto mvcc_columns = referenced_chunk->get_scoped_mvcc_columns_lock();
+    for (auto row_id : *ref_col_in->pos_list()) {
+      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
-        if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns)) {
-          pos_list_out->emplace_back(row_id);
-        }
-      }
+      auto mvcc_columns = referenced_chunk->get_scoped_mvcc_columns_lock();
 
-      // Construct the actual ReferenceColumn objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id));
-        const auto referenced_column_id = column->referenced_column_id();
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
-        output_columns.push_back(ref_col_out);
+      if ((all_rows_visible_fast_path && mvcc_columns->all_rows_visible(snapshot_commit_id)) ||
+          is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns)) {
+        pos_list_out->emplace_back(row_id);
       }
+    }
 
-      // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
-    } else {
-      referenced_table = in_table;
-      DebugAssert(chunk_in->has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
-      const auto mvcc_columns = chunk_in->get_scoped_mvcc_columns_lock();
-
-      // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-      for (auto i = 0u; i < chunk_size; i++) {
-        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_columns)) {
-          pos_list_out->emplace_back(RowID{chunk_id, i});
-        }
-      }
+    // Construct the actual ReferenceColumn objects and add them to the chunk.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      const auto column = std::static_pointer_cast<const ReferenceColumn>(chunk_in->get_column(column_id));
+      const auto referenced_column_id = column->referenced_column_id();
+      auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, pos_list_out);
+      output_columns.push_back(ref_col_out);
+    }
 
-      // Create actual ReferenceColumn objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
-        output_columns.push_back(ref_col_out);
+    // Otherwise we have a Value- or DictionaryColumn and simply iterate over all rows to build a poslist.
+  } else {
+    referenced_table = in_table;
+    DebugAssert(chunk_in->has_mvcc_columns(), "Trying to use Validate on a table that has no MVCC columns");
+    const auto mvcc_columns = chunk_in->get_scoped_mvcc_columns_lock();
+
+    // Generate pos_list_out. If the summary of the MVCC columns shows that all rows are visible, the per-row
+    // information does not need to be looked at.
+    const auto chunk_size = chunk_in->size();
+    if (all_rows_visible_fast_path && mvcc_columns->all_rows_visible(snapshot_commit_id)) {
+      pos_list_out->reserve(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        pos_list_out->emplace_back(RowID{chunk_id, chunk_offset});
       }
+    } else {
+      pos_list_out->reserve(chunk_size - std::min(chunk_size, mvcc_columns->invalidated_row_count.load()));
+      append_visible_rows(our_tid, snapshot_commit_id, chunk_id, chunk_size, *mvcc_columns, *pos_list_out);
     }
 
-    if (!pos_list_out->empty() > 0) {
-      output->append_chunk(output_columns);
+    // Create actual ReferenceColumn objects.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      auto ref_col_out = std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list_out);
+      output_columns.push_back(ref_col_out);
     }
   }
-  return output;
+
+  if (pos_list_out->empty()) return {};
+  return output_columns;
 }
 
 }  // namespace opossum
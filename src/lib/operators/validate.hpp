@@ -4,7 +4,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -16,7 +16,7 @@ namespace opossum {
  *
  * Assumption: Validate happens before joins.
  */
-class Validate : public AbstractReadOnlyOperator {
+class Validate : public AbstractChunkwiseOperator {
  public:
   explicit Validate(const std::shared_ptr<AbstractOperator>& in);
 
@@ -25,6 +25,8 @@ class Validate : public AbstractReadOnlyOperator {
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
+  ChunkColumns _on_execute_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                 const std::shared_ptr<TransactionContext>& transaction_context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
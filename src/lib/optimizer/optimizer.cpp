@@ -14,6 +14,7 @@
 #include "strategy/join_detection_rule.hpp"
 #include "strategy/predicate_pushdown_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
+#include "strategy/top_k_rule.hpp"
 #include "utils/performance_warning.hpp"
 
 /**
@@ -96,6 +97,7 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   final_batch.add_rule(std::make_shared<ChunkPruningRule>());
   final_batch.add_rule(std::make_shared<ConstantCalculationRule>());
   final_batch.add_rule(std::make_shared<IndexScanRule>());
+  final_batch.add_rule(std::make_shared<TopKRule>());
   optimizer->add_rule_batch(final_batch);
 
   return optimizer;
@@ -8,7 +8,10 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
@@ -32,16 +35,20 @@ std::string IndexScanRule::name() const { return "Index Scan Rule"; }
 
 bool IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   if (node->type == LQPNodeType::Predicate) {
-    const auto& child = node->left_input();
+    const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+    const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate);
 
-    if (child->type == LQPNodeType::StoredTable) {
-      const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
-      const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
+    const auto stored_table_node =
+        predicate && !predicate->arguments.empty()
+            ? lqp_find_referenced_stored_table_node(node->left_input(), *predicate->arguments[0])
+            : nullptr;
+
+    if (stored_table_node) {
       const auto table = StorageManager::get().get_table(stored_table_node->table_name);
 
       const auto index_infos = table->get_indexes();
       for (const auto& index_info : index_infos) {
-        if (_is_index_scan_applicable(index_info, predicate_node)) {
+        if (_is_index_scan_applicable(index_info, predicate_node, *stored_table_node)) {
           predicate_node->scan_type = ScanType::IndexScan;
         }
       }
@@ -52,10 +59,11 @@ bool IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
 }
 
 bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
-                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
+                                              const std::shared_ptr<PredicateNode>& predicate_node,
+                                              const StoredTableNode& stored_table_node) const {
   if (!_is_single_column_index(index_info)) return false;
 
-  if (index_info.type != ColumnIndexType::GroupKey) return false;
+  if (index_info.type != ColumnIndexType::GroupKey && index_info.type != ColumnIndexType::Table) return false;
 
   const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
   if (!operator_predicates) return false;
@@ -66,16 +74,27 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   // Currently, we do not support two-column predicates
   if (is_column_id(operator_predicate.value)) return false;
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+  const auto& column_expression = *predicate_node->left_input()->column_expressions()[operator_predicate.column_id];
+  const auto& column_reference = static_cast<const LQPColumnExpression&>(column_expression).column_reference;
+  if (index_info.column_ids[0] != column_reference.original_column_id()) return false;
+
+  const auto is_reference_input = predicate_node->left_input().get() != &stored_table_node;
 
-  const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
+  const auto row_count_table = stored_table_node.derive_statistics_from(nullptr, nullptr)->row_count();
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
 
+  const auto row_count_input = predicate_node->left_input()->get_statistics()->row_count();
+  if (row_count_input == 0.0f) return false;
+
   const auto row_count_predicate =
       predicate_node->derive_statistics_from(predicate_node->left_input(), nullptr)->row_count();
-  const float selectivity = row_count_predicate / row_count_table;
+  const float selectivity = row_count_predicate / row_count_input;
+
+  if (selectivity > INDEX_SCAN_SELECTIVITY_THRESHOLD) return false;
 
-  return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
+  // The index returns the matches of the entire stored table, each of them is then looked up in the input. This only
+  // pays off if there are fewer expected matches in the stored table than input rows that a TableScan would compare.
+  return !is_reference_input || selectivity * row_count_table <= row_count_input;
 }
 
 inline bool IndexScanRule::_is_single_column_index(const IndexInfo& index_info) const {
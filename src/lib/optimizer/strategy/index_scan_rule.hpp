@@ -12,17 +12,22 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
- * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
- * for being executed by IndexScans. If the expected selectivity of the predicate falls below a certain threshold, the
- * ScanType of the PredicateNode is set to IndexScan.
+ * This optimizer rule finds PredicateNodes on columns of StoredTableNodes. The PredicateNode may directly follow the
+ * StoredTableNode or sit above nodes that only forward its rows (e.g., other predicates, validates or joins). These
+ * PredicateNodes are candidates for being executed by IndexScans. If the expected selectivity of the predicate falls
+ * below a certain threshold, the ScanType of the PredicateNode is set to IndexScan. If the PredicateNode does not
+ * directly follow the StoredTableNode, the expected number of index matches must also not exceed the number of input
+ * rows. As the rule is applied to every PredicateNode, chains of
+ * predicates (i.e. the conjuncts of a WHERE clause) and the branches of a UnionNode (i.e. the disjuncts) can each use
+ * their own IndexScan.
  *
  * Note:
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
- * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * and ART indexes. Currently, only GroupKeyIndexes and TableIndexes are supported.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -31,8 +36,8 @@ class IndexScanRule : public AbstractRule {
   bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
  protected:
-  bool _is_index_scan_applicable(const IndexInfo& index_info,
-                                 const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_index_scan_applicable(const IndexInfo& index_info, const std::shared_ptr<PredicateNode>& predicate_node,
+                                 const StoredTableNode& stored_table_node) const;
   inline bool _is_single_column_index(const IndexInfo& index_info) const;
 };
 
@@ -0,0 +1,26 @@
+#include "top_k_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+
+namespace opossum {
+
+std::string TopKRule::name() const { return "TopK Rule"; }
+
+bool TopKRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (node->type == LQPNodeType::Limit) {
+    const auto& input = node->left_input();
+
+    if (input->type == LQPNodeType::Sort && input->output_count() == 1) {
+      const auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+      limit_node->limit_type = LimitType::TopK;
+    }
+  }
+
+  return _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule finds LimitNodes whose input is a SortNode, i.e., ORDER BY ... LIMIT k. The LimitType of these
+ * LimitNodes is set to TopK, so that the LQPTranslator replaces both nodes by a single TopK operator that does not
+ * need to sort the entire input.
+ *
+ * Note:
+ * The SortNode must not have other outputs than the LimitNode, since its fully sorted result would be needed there.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -7,6 +7,7 @@
 
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
+#include "resource_group_manager.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
@@ -26,6 +27,8 @@ bool AbstractTask::is_done() const { return _done; }
 
 bool AbstractTask::is_stealable() const { return _stealable; }
 
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
 bool AbstractTask::is_scheduled() const { return _is_scheduled; }
 
 std::string AbstractTask::description() const {
@@ -56,7 +59,25 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
   _done_callback = done_callback;
 }
 
+void AbstractTask::set_resource_group(const std::shared_ptr<ResourceGroup>& resource_group) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the ResourceGroup after the Task was scheduled");
+
+  _resource_group = resource_group;
+}
+
+const std::shared_ptr<ResourceGroup>& AbstractTask::resource_group() const { return _resource_group; }
+
 void AbstractTask::schedule(NodeID preferred_node_id) {
+  // Tasks scheduled by a Task, e.g., its JobTasks, count towards the budget of the same ResourceGroup. This has to
+  // happen before the Task is marked as scheduled, as its predecessors may already be running and read the group in
+  // _on_predecessor_done() once they see that it is scheduled.
+  if (!_resource_group && CurrentScheduler::is_set()) {
+    const auto worker = Worker::get_this_thread_worker();
+    if (worker && worker->_current_task && worker->_current_task->_resource_group) {
+      _resource_group = worker->_current_task->_resource_group;
+    }
+  }
+
   _mark_as_scheduled();
 
   if (CurrentScheduler::is_set()) {
@@ -94,8 +115,13 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
+  if (_holds_resource_group_slot) _execution_start = std::chrono::steady_clock::now();
+
   _on_execute();
 
+  // Release the capacity before the successors become ready, so that they can use it
+  _release_resource_group_slot();
+
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
   }
@@ -119,10 +145,22 @@ void AbstractTask::_on_predecessor_done() {
   auto new_predecessor_count = --_pending_predecessors;  // atomically decrement
   if (new_predecessor_count == 0) {
     if (CurrentScheduler::is_set()) {
+      // A Task that is not scheduled yet is enqueued by the Scheduler once it is. Until then, its ResourceGroup might
+      // still be changed by schedule().
+      if (!_is_scheduled) return;
+
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::Highest));
+      const auto task = shared_from_this();
+      if (_resource_group &&
+          !ResourceGroupManager::get().try_admit_task(task, CURRENT_NODE_ID, SchedulePriority::Highest)) {
+        // The ResourceGroupManager enqueues the task once its ResourceGroup has capacity for it
+        return;
+      }
+
+      // The successor is executed next by this worker, unless another one steals it
+      worker->push_ready_task(task, SchedulePriority::Highest);
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
@@ -138,4 +176,11 @@ void AbstractTask::_on_predecessor_done() {
   }
 }
 
+void AbstractTask::_release_resource_group_slot() {
+  if (!_holds_resource_group_slot) return;
+
+  _holds_resource_group_slot = false;
+  ResourceGroupManager::get().release_task(*this, std::chrono::steady_clock::now() - _execution_start);
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -12,6 +13,7 @@
 
 namespace opossum {
 
+class ResourceGroup;
 class Worker;
 
 /**
@@ -20,6 +22,7 @@ class Worker;
  * Derive and implement logic in _on_execute()
  */
 class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
+  friend class ResourceGroupManager;
   friend class Worker;
 
  public:
@@ -47,6 +50,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  SchedulePriority priority() const;
+
   /**
    * Description for debugging purposes
    */
@@ -79,6 +84,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The ResourceGroup whose budget the Task uses, see ResourceGroupManager. If none is set when the Task is scheduled,
+   * it gets the ResourceGroup of the Task that schedules it, if any.
+   */
+  void set_resource_group(const std::shared_ptr<ResourceGroup>& resource_group);
+  const std::shared_ptr<ResourceGroup>& resource_group() const;
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -133,6 +145,12 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void _on_predecessor_done();
 
+  /**
+   * Returns the capacity admitted to this Task by the ResourceGroupManager, if it holds any. Called when the Task
+   * finished or blocks.
+   */
+  void _release_resource_group_slot();
+
   TaskID _id = INVALID_TASK_ID;
   NodeID _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
@@ -140,6 +158,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
 
+  std::shared_ptr<ResourceGroup> _resource_group;
+  std::atomic_bool _is_admission_requested{false};
+  bool _holds_resource_group_slot{false};
+  std::chrono::steady_clock::time_point _execution_start;
+
   // For dependencies
   std::atomic_uint _pending_predecessors{0};
   std::vector<std::weak_ptr<AbstractTask>> _predecessors;
@@ -9,6 +9,7 @@
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
 #include "processing_unit.hpp"
+#include "resource_group_manager.hpp"
 #include "task_queue.hpp"
 #include "topology.hpp"
 
@@ -102,15 +103,20 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
+  // Tasks that exceed the budget of their ResourceGroup are enqueued by the ResourceGroupManager later
+  if (task->resource_group() && !ResourceGroupManager::get().try_admit_task(task, preferred_node_id, priority)) return;
+
   // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
-      preferred_node_id = worker->queue()->node_id();
-    } else {
-      // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
-      preferred_node_id = NodeID{0};
+      // Tasks scheduled by a running task, e.g., JobTasks, are kept on the Worker's deque for cache locality
+      worker->push_ready_task(task, priority);
+      return;
     }
+
+    // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
+    preferred_node_id = NodeID{0};
   }
 
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
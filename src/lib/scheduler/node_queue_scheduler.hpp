@@ -56,18 +56,15 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Each Worker owns a lock-free WorkStealingDeque. Tasks that become ready on a Worker, i.e., the successors of the task
+ * it executed and the jobs scheduled by it, are pushed to its own deque. The Worker executes the most recently pushed
+ * task first, because its data is most likely still in the Worker's caches. Before a Worker gives up the active worker
+ * token (e.g., to wait for its jobs), it moves the remaining tasks of its deque to the TaskQueue of its node.
+ *
+ * A Worker first takes a task from its own deque, then from the TaskQueue of its node. If both are empty, it steals the
+ * oldest task from the deque of another Worker of the same node. Only then it steals from other nodes, ordered by their
+ * distance as reported by the Topology. Accessing a remote node is ~1.6 times slower than accessing a local node. [1]
+ * Tasks that are not stealable are never pushed to a deque and stay in the TaskQueue of their node.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
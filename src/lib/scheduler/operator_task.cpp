@@ -6,6 +6,7 @@
 
 #include "concurrency/transaction_manager.hpp"
 
+#include "operators/abstract_chunkwise_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 
@@ -13,6 +14,25 @@
 #include "scheduler/processing_unit.hpp"
 #include "scheduler/worker.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Counts how many operators use each operator of the plan as their input
+void count_consumers(const std::shared_ptr<AbstractOperator>& op,
+                     std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
+  // Each operator is only visited once, so that inputs of diamonds are not counted twice
+  if (!consumer_counts.emplace(op, 0).second) return;
+
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+    count_consumers(input, consumer_counts);
+    ++consumer_counts[input];
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
                            SchedulePriority priority, bool stealable)
@@ -26,13 +46,19 @@ const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_o
     const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries);
+
+  // Without cleaning up temporaries, the intermediate results might still be needed, so nothing is pipelined
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_counts;
+  if (cleanup_temporaries == CleanupTemporaries::Yes) count_consumers(op, consumer_counts);
+
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, consumer_counts, cleanup_temporaries);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
     std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts,
     CleanupTemporaries cleanup_temporaries) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
@@ -40,13 +66,23 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
   const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
+  // The inputs of the task are the inputs of the first operator of its pipeline
+  auto first_op = op;
+  auto pipeline = _pipeline_ending_with(op, consumer_counts);
+  if (pipeline.size() > 1) {
+    task->_pipeline = std::move(pipeline);
+    first_op = task->_pipeline.front();
+  }
+
+  if (auto left = first_op->mutable_input_left()) {
+    auto subtree_root =
+        OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, consumer_counts, cleanup_temporaries);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
+  if (auto right = first_op->mutable_input_right()) {
+    auto subtree_root =
+        OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, consumer_counts, cleanup_temporaries);
     subtree_root->set_as_predecessor_of(task);
   }
 
@@ -56,6 +92,25 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
   return task;
 }
 
+std::vector<std::shared_ptr<AbstractChunkwiseOperator>> OperatorTask::_pipeline_ending_with(
+    const std::shared_ptr<AbstractOperator>& op,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
+  auto pipeline = std::vector<std::shared_ptr<AbstractChunkwiseOperator>>{};
+
+  auto chunkwise_op = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(op);
+  while (chunkwise_op && chunkwise_op->can_be_pipelined()) {
+    pipeline.insert(pipeline.begin(), chunkwise_op);
+
+    const auto input = chunkwise_op->mutable_input_left();
+    const auto consumer_count_iter = consumer_counts.find(input);
+    if (consumer_count_iter == consumer_counts.end() || consumer_count_iter->second != 1) break;
+
+    chunkwise_op = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(input);
+  }
+
+  return pipeline;
+}
+
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
 void OperatorTask::_on_execute() {
@@ -82,7 +137,11 @@ void OperatorTask::_on_execute() {
     }
   }
 
-  _op->execute();
+  if (!_pipeline.empty()) {
+    AbstractChunkwiseOperator::execute_pipeline(_pipeline);
+  } else {
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
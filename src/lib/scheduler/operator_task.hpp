@@ -8,6 +8,7 @@
 
 namespace opossum {
 
+class AbstractChunkwiseOperator;
 class AbstractOperator;
 
 /**
@@ -21,6 +22,11 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   *
+   * If temporaries are cleaned up, i.e., the intermediate results are not needed after the execution, chains of
+   * AbstractChunkwiseOperators (e.g., Validate followed by TableScans) are combined into a single task that executes
+   * them morsel-wise, see AbstractChunkwiseOperator::execute_pipeline(). Only the last operator of such a chain has an
+   * output after the execution.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
       const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
@@ -39,10 +45,22 @@ class OperatorTask : public AbstractTask {
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts,
       CleanupTemporaries cleanup_temporaries);
 
+  /**
+   * Returns the longest chain of AbstractChunkwiseOperators that ends with op and in which each operator but the last
+   * one has exactly one consumer. The chain is empty if op cannot be pipelined.
+   */
+  static std::vector<std::shared_ptr<AbstractChunkwiseOperator>> _pipeline_ending_with(
+      const std::shared_ptr<AbstractOperator>& op,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts);
+
  private:
   std::shared_ptr<AbstractOperator> _op;
   CleanupTemporaries _cleanup_temporaries;
+
+  // If not empty, the operators (ending with _op) that this task executes morsel-wise
+  std::vector<std::shared_ptr<AbstractChunkwiseOperator>> _pipeline;
 };
 }  // namespace opossum
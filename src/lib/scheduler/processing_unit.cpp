@@ -3,6 +3,7 @@
 #include <functional>
 #include <memory>
 
+#include "task_queue.hpp"
 #include "uid_allocator.hpp"
 #include "worker.hpp"
 
@@ -90,6 +91,7 @@ void ProcessingUnit::shutdown() {
     _shutdown_flag = true;
   }
   _hibernation_cv.notify_all();
+  _queue->unpark_all_workers();
 }
 
 bool ProcessingUnit::shutdown_flag() const { return _shutdown_flag; }
@@ -0,0 +1,24 @@
+#include "resource_group.hpp"
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ResourceGroup::ResourceGroup(const std::string& name, const uint32_t weight, const size_t max_concurrent_tasks)
+    : _name(name), _weight(weight), _max_concurrent_tasks(max_concurrent_tasks) {
+  Assert(weight > 0, "The weight of a ResourceGroup must be positive");
+}
+
+const std::string& ResourceGroup::name() const { return _name; }
+
+uint32_t ResourceGroup::weight() const { return _weight; }
+
+size_t ResourceGroup::max_concurrent_tasks() const { return _max_concurrent_tasks; }
+
+size_t ResourceGroup::num_active_tasks() const { return _num_active_tasks; }
+
+size_t ResourceGroup::num_waiting_tasks() const { return _num_waiting_tasks; }
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * A ResourceGroup limits the share of the Scheduler's Workers that the tasks of a query or of a session can use. All
+ * tasks of an SQLPipeline get the ResourceGroup it was built with and tasks scheduled by a task, e.g., JobTasks, get
+ * the ResourceGroup of that task. Tasks without a ResourceGroup are not restricted.
+ *
+ * - max_concurrent_tasks is the number of the group's tasks that may be enqueued or running at the same time. Further
+ *   tasks wait in the group until one of these finished. 0 means unlimited.
+ * - weight is the group's share of the Workers relative to other groups when the ResourceGroupManager has to choose
+ *   which waiting task to release next. A group with weight 4 gets four times the execution time of a group with
+ *   weight 1.
+ *
+ * E.g., dashboards may get a group with weight 8 and batch reports a group with weight 1 that may only use half of the
+ * CPUs, so that the short dashboard queries do not queue behind hundreds of tasks of a single report.
+ */
+class ResourceGroup {
+  friend class ResourceGroupManager;
+
+ public:
+  explicit ResourceGroup(const std::string& name, const uint32_t weight = 1, const size_t max_concurrent_tasks = 0);
+
+  const std::string& name() const;
+  uint32_t weight() const;
+  size_t max_concurrent_tasks() const;
+
+  // Number of tasks of this group that are enqueued or running
+  size_t num_active_tasks() const;
+
+  // Number of tasks of this group that are ready, but wait until the group or the Scheduler has capacity for them
+  size_t num_waiting_tasks() const;
+
+ private:
+  struct WaitingTask {
+    std::shared_ptr<AbstractTask> task;
+    NodeID preferred_node_id;
+    SchedulePriority priority;
+  };
+
+  const std::string _name;
+  const uint32_t _weight;
+  const size_t _max_concurrent_tasks;
+
+  std::atomic<size_t> _num_active_tasks{0};
+  std::atomic<size_t> _num_waiting_tasks{0};
+
+  // The following members are guarded by the mutex of the ResourceGroupManager
+  std::deque<WaitingTask> _waiting_tasks;
+
+  // Execution time (in nanoseconds) of the group's tasks divided by its weight, used for weighted fair queuing
+  uint64_t _virtual_time{0};
+};
+
+}  // namespace opossum
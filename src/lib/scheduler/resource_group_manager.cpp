@@ -0,0 +1,255 @@
+#include "resource_group_manager.hpp"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "abstract_task.hpp"
+#include "current_scheduler.hpp"
+#include "task_queue.hpp"
+#include "worker.hpp"
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Returns the resident set size of this process in bytes
+size_t resident_memory_usage() {
+#ifdef __linux__
+  std::ifstream statm("/proc/self/statm");
+  auto total_pages = size_t{0};
+  auto resident_pages = size_t{0};
+  if (statm >> total_pages >> resident_pages) return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+
+  // Fall back to the peak resident set size, which macOS reports in bytes
+  auto usage = rusage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<size_t>(usage.ru_maxrss);
+}
+
+}  // namespace
+
+namespace opossum {
+
+ResourceGroupManager& ResourceGroupManager::get() {
+  static ResourceGroupManager instance;
+  return instance;
+}
+
+void ResourceGroupManager::reset() {
+  auto& manager = get();
+
+  {
+    std::lock_guard<std::mutex> lock(manager._mutex);
+    for (const auto& group : manager._waiting_groups) {
+      group->_num_waiting_tasks = 0;
+      group->_waiting_tasks.clear();
+    }
+    manager._waiting_groups.clear();
+    manager._max_active_tasks = 0;
+    manager._num_active_tasks = 0;
+    manager._virtual_time = 0;
+  }
+
+  manager._max_memory_usage = 0;
+  manager._max_queued_tasks = 0;
+
+  std::lock_guard<std::mutex> lock(manager._query_admission_mutex);
+  manager._num_running_queries = 0;
+}
+
+void ResourceGroupManager::set_max_active_tasks(const size_t max_active_tasks) {
+  auto admitted_tasks = std::vector<ResourceGroup::WaitingTask>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_active_tasks = max_active_tasks;
+    admitted_tasks = _take_admissible_waiting_tasks();
+  }
+
+  for (const auto& admitted_task : admitted_tasks) _enqueue(admitted_task);
+}
+
+size_t ResourceGroupManager::max_active_tasks() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _max_active_tasks;
+}
+
+size_t ResourceGroupManager::num_active_tasks() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _num_active_tasks;
+}
+
+bool ResourceGroupManager::try_admit_task(const std::shared_ptr<AbstractTask>& task, const NodeID preferred_node_id,
+                                          const SchedulePriority priority) {
+  const auto& group = task->resource_group();
+  DebugAssert(group, "Only tasks with a ResourceGroup need to be admitted");
+
+  // A task that becomes ready before it is scheduled is offered both by the Scheduler and by its predecessor
+  if (task->_is_admission_requested.exchange(true)) return false;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Tasks of a group are admitted in the order in which they became ready
+  if (group->_waiting_tasks.empty() && _has_capacity_for(*group)) {
+    _activate(*task, *group);
+    return true;
+  }
+
+  if (group->_waiting_tasks.empty()) {
+    // A group that has been idle must not have saved up virtual time that would let it monopolize the Workers
+    group->_virtual_time = std::max(group->_virtual_time, _virtual_time);
+    _waiting_groups.emplace_back(group);
+  }
+
+  group->_waiting_tasks.push_back({task, preferred_node_id, priority});
+  ++group->_num_waiting_tasks;
+  return false;
+}
+
+void ResourceGroupManager::release_task(const AbstractTask& task, const std::chrono::nanoseconds execution_time) {
+  auto admitted_tasks = std::vector<ResourceGroup::WaitingTask>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& group = *task.resource_group();
+    DebugAssert(group._num_active_tasks > 0 && _num_active_tasks > 0, "Released more tasks than were admitted");
+    --group._num_active_tasks;
+    --_num_active_tasks;
+    group._virtual_time += static_cast<uint64_t>(std::max(execution_time.count(), int64_t{0})) / group._weight;
+
+    admitted_tasks = _take_admissible_waiting_tasks();
+  }
+
+  // Enqueueing a task might execute it right away, so the mutex must not be held
+  for (const auto& admitted_task : admitted_tasks) _enqueue(admitted_task);
+}
+
+void ResourceGroupManager::set_max_memory_usage(const size_t max_memory_usage) {
+  _max_memory_usage = max_memory_usage;
+}
+
+size_t ResourceGroupManager::max_memory_usage() const { return _max_memory_usage; }
+
+void ResourceGroupManager::set_max_queued_tasks(const size_t max_queued_tasks) {
+  _max_queued_tasks = max_queued_tasks;
+}
+
+size_t ResourceGroupManager::max_queued_tasks() const { return _max_queued_tasks; }
+
+bool ResourceGroupManager::is_overloaded() const {
+  const auto max_queued_tasks = _max_queued_tasks.load();
+  if (max_queued_tasks > 0 && CurrentScheduler::is_set()) {
+    auto num_queued_tasks = size_t{0};
+    for (const auto& queue : CurrentScheduler::get()->queues()) {
+      num_queued_tasks += queue->size();
+    }
+    if (num_queued_tasks >= max_queued_tasks) return true;
+  }
+
+  const auto max_memory_usage = _max_memory_usage.load();
+  return max_memory_usage > 0 && resident_memory_usage() > max_memory_usage;
+}
+
+void ResourceGroupManager::admit_query() {
+  std::unique_lock<std::mutex> lock(_query_admission_mutex);
+
+  if (_num_running_queries > 0 && is_overloaded()) {
+    // Do not block the CPU of a Worker, the running queries need it to finish
+    if (auto worker = Worker::get_this_thread_worker()) {
+      lock.unlock();
+      worker->yield_processing_unit();
+      lock.lock();
+    }
+
+    // The load changes without notification, so it is checked periodically
+    while (_num_running_queries > 0 && is_overloaded()) {
+      _query_admission_condition_variable.wait_for(lock, QUERY_ADMISSION_CHECK_INTERVAL);
+    }
+  }
+
+  ++_num_running_queries;
+}
+
+void ResourceGroupManager::finish_query() {
+  {
+    std::lock_guard<std::mutex> lock(_query_admission_mutex);
+    DebugAssert(_num_running_queries > 0, "finish_query() called more often than admit_query()");
+    --_num_running_queries;
+  }
+  _query_admission_condition_variable.notify_all();
+}
+
+size_t ResourceGroupManager::num_running_queries() const {
+  std::lock_guard<std::mutex> lock(_query_admission_mutex);
+  return _num_running_queries;
+}
+
+bool ResourceGroupManager::_has_capacity_for(const ResourceGroup& group) const {
+  if (_max_active_tasks > 0 && _num_active_tasks >= _max_active_tasks) return false;
+  return group._max_concurrent_tasks == 0 || group._num_active_tasks < group._max_concurrent_tasks;
+}
+
+void ResourceGroupManager::_activate(AbstractTask& task, ResourceGroup& group) {
+  ++group._num_active_tasks;
+  ++_num_active_tasks;
+  task._holds_resource_group_slot = true;
+}
+
+std::vector<ResourceGroup::WaitingTask> ResourceGroupManager::_take_admissible_waiting_tasks() {
+  auto admitted_tasks = std::vector<ResourceGroup::WaitingTask>{};
+
+  while (true) {
+    // Pick the waiting group that has been served least relative to its weight
+    auto next_group_iter = _waiting_groups.end();
+    for (auto group_iter = _waiting_groups.begin(); group_iter != _waiting_groups.end(); ++group_iter) {
+      if (!_has_capacity_for(**group_iter)) continue;
+      if (next_group_iter != _waiting_groups.end() &&
+          (*next_group_iter)->_virtual_time <= (*group_iter)->_virtual_time) {
+        continue;
+      }
+      next_group_iter = group_iter;
+    }
+    if (next_group_iter == _waiting_groups.end()) break;
+
+    auto& group = **next_group_iter;
+    admitted_tasks.emplace_back(std::move(group._waiting_tasks.front()));
+    group._waiting_tasks.pop_front();
+    --group._num_waiting_tasks;
+
+    _activate(*admitted_tasks.back().task, group);
+    _virtual_time = std::max(_virtual_time, group._virtual_time);
+
+    if (group._waiting_tasks.empty()) _waiting_groups.erase(next_group_iter);
+  }
+
+  return admitted_tasks;
+}
+
+void ResourceGroupManager::_enqueue(const ResourceGroup::WaitingTask& waiting_task) {
+  const auto& task = waiting_task.task;
+
+  if (!CurrentScheduler::is_set()) {
+    task->execute();
+    return;
+  }
+
+  auto preferred_node_id = waiting_task.preferred_node_id;
+  if (preferred_node_id == CURRENT_NODE_ID) {
+    // The task is released by a task that just finished on this Worker, whose data it might share
+    if (auto worker = Worker::get_this_thread_worker()) {
+      worker->push_ready_task(task, waiting_task.priority);
+      return;
+    }
+    preferred_node_id = NodeID{0};
+  }
+
+  CurrentScheduler::get()->queues()[preferred_node_id]->push(task, static_cast<uint32_t>(waiting_task.priority));
+}
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "resource_group.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * The ResourceGroupManager controls which work is admitted to the Scheduler.
+ *
+ * TASK ADMISSION
+ * When a task that has a ResourceGroup becomes ready, the Scheduler asks try_admit_task() whether it may be enqueued.
+ * This is the case if neither its group's max_concurrent_tasks nor max_active_tasks (which covers the tasks of all
+ * groups) are reached. Otherwise, the task waits in its group. Whenever a task finishes, release_task() enqueues
+ * waiting tasks for the freed capacity. If multiple groups are waiting, it picks the one with the smallest virtual
+ * time, i.e., the execution time of the group's tasks divided by the group's weight (weighted fair queuing).
+ *
+ * A task that blocks, e.g., to wait for its JobTasks, releases its capacity, so that the tasks it waits for cannot be
+ * held back by it.
+ *
+ * QUERY ADMISSION
+ * Before an SQLPipeline or a prepared statement of the server is executed, a QueryAdmission calls admit_query(),
+ * which blocks while the system is overloaded, i.e., while the process uses more memory than max_memory_usage or more
+ * tasks than max_queued_tasks wait in the TaskQueues of the Scheduler. Queries that already run are not affected. To
+ * guarantee progress, a query is always admitted if no other query is running.
+ *
+ * All limits are disabled (0) by default.
+ */
+class ResourceGroupManager : private Noncopyable {
+ public:
+  // Interval in which a query that waits for admission checks whether the system is still overloaded
+  static constexpr auto QUERY_ADMISSION_CHECK_INTERVAL = std::chrono::milliseconds(1);
+
+  static ResourceGroupManager& get();
+  static void reset();
+
+  void set_max_active_tasks(const size_t max_active_tasks);
+  size_t max_active_tasks() const;
+
+  // Number of tasks with a ResourceGroup that are enqueued or running
+  size_t num_active_tasks() const;
+
+  /**
+   * Returns true if the caller has to enqueue the ready task right away. Otherwise, the task is kept until
+   * release_task() enqueues it on preferred_node_id with the given priority, or it has already been offered before.
+   */
+  bool try_admit_task(const std::shared_ptr<AbstractTask>& task, const NodeID preferred_node_id,
+                      const SchedulePriority priority);
+
+  /**
+   * Called once an admitted task finished or blocks. Charges its execution time to its ResourceGroup and enqueues
+   * waiting tasks.
+   */
+  void release_task(const AbstractTask& task, const std::chrono::nanoseconds execution_time);
+
+  void set_max_memory_usage(const size_t max_memory_usage);
+  size_t max_memory_usage() const;
+
+  void set_max_queued_tasks(const size_t max_queued_tasks);
+  size_t max_queued_tasks() const;
+
+  // Returns whether a query would currently have to wait before it is admitted, unless no other query is running
+  bool is_overloaded() const;
+
+  /**
+   * Blocks until the query may be executed. Each call must be followed by a call to finish_query(). When called from a
+   * Worker, e.g., by a server session, another Worker takes over its CPU while it waits.
+   */
+  void admit_query();
+  void finish_query();
+
+  size_t num_running_queries() const;
+
+ private:
+  ResourceGroupManager() = default;
+
+  bool _has_capacity_for(const ResourceGroup& group) const;
+
+  void _activate(AbstractTask& task, ResourceGroup& group);
+
+  // Takes the waiting tasks for which there is capacity now out of their groups. Requires _mutex to be locked.
+  std::vector<ResourceGroup::WaitingTask> _take_admissible_waiting_tasks();
+
+  static void _enqueue(const ResourceGroup::WaitingTask& waiting_task);
+
+  mutable std::mutex _mutex;
+  size_t _max_active_tasks{0};
+  size_t _num_active_tasks{0};
+
+  // Groups with waiting tasks, each one only once
+  std::vector<std::shared_ptr<ResourceGroup>> _waiting_groups;
+
+  // Virtual time of the group that was last picked, groups that start waiting do not fall behind it
+  uint64_t _virtual_time{0};
+
+  std::atomic<size_t> _max_memory_usage{0};
+  std::atomic<size_t> _max_queued_tasks{0};
+
+  mutable std::mutex _query_admission_mutex;
+  std::condition_variable _query_admission_condition_variable;
+  size_t _num_running_queries{0};
+};
+
+// Holds the admission of a query for as long as it executes, even if the execution throws
+class QueryAdmission final : private Noncopyable {
+ public:
+  QueryAdmission() { ResourceGroupManager::get().admit_query(); }
+  ~QueryAdmission() { ResourceGroupManager::get().finish_query(); }
+};
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "abstract_task.hpp"
+#include "work_stealing_deque.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -12,18 +13,33 @@ TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
 bool TaskQueue::empty() const { return _num_tasks == 0; }
 
+size_t TaskQueue::size() const { return _num_tasks; }
+
 NodeID TaskQueue::node_id() const { return _node_id; }
 
 void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
-  DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
-
   // Someone else was first to enqueue this task? No problem!
   if (!task->try_mark_as_enqueued()) return;
 
+  _enqueue(task, priority);
+}
+
+void TaskQueue::requeue(const std::shared_ptr<AbstractTask>& task, uint32_t priority) { _enqueue(task, priority); }
+
+void TaskQueue::_enqueue(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
+  DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
+
   task->set_node_id(_node_id);
   _queues[priority].push(task);
 
   _num_tasks++;
+
+  // Parked workers increment _num_parked_workers before checking empty() under the _parking_mutex, so either they see
+  // the new task or we see them and notify them after they started waiting.
+  if (_num_parked_workers > 0) {
+    std::lock_guard<std::mutex> lock(_parking_mutex);
+    _parking_cv.notify_one();
+  }
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull(SchedulePriority min_priority) {
@@ -58,7 +74,54 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
       }
     }
   }
+
+  // Only stealable tasks are added to the deques of Workers
+  return steal_from_worker_deques();
+}
+
+void TaskQueue::add_worker_deque(const std::shared_ptr<WorkStealingDeque>& deque) {
+  std::lock_guard<std::mutex> lock(_worker_deques_mutex);
+  _worker_deques.emplace_back(deque);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal_from_worker_deques() {
+  std::lock_guard<std::mutex> lock(_worker_deques_mutex);
+  for (const auto& deque : _worker_deques) {
+    if (auto task = deque->steal()) return task;
+  }
   return nullptr;
 }
 
+void TaskQueue::park_worker(std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(_parking_mutex);
+
+  _num_parked_workers++;
+
+  const auto generation = _unpark_all_generation;
+  _parking_cv.wait_for(lock, timeout, [&]() {
+    return !empty() || _num_pending_unparks > 0 || _unpark_all_generation != generation;
+  });
+
+  if (_num_pending_unparks > 0) _num_pending_unparks--;
+  _num_parked_workers--;
+}
+
+void TaskQueue::unpark_worker() {
+  if (_num_parked_workers == 0) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_parking_mutex);
+    _num_pending_unparks++;
+  }
+  _parking_cv.notify_one();
+}
+
+void TaskQueue::unpark_all_workers() {
+  {
+    std::lock_guard<std::mutex> lock(_parking_mutex);
+    _unpark_all_generation++;
+  }
+  _parking_cv.notify_all();
+}
+
 }  // namespace opossum
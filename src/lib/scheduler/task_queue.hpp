@@ -4,16 +4,22 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class WorkStealingDeque;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds a queue of AbstractTasks, usually one of these exists per node. Additionally, it knows the WorkStealingDeques
+ * of the Workers of its node, so that tasks can be stolen from them.
  */
 class TaskQueue {
  public:
@@ -23,10 +29,18 @@ class TaskQueue {
 
   bool empty() const;
 
+  // Returns the number of tasks in the queue, which might be outdated by the time it is used
+  size_t size() const;
+
   NodeID node_id() const;
 
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
+  /**
+   * Adds a task that was already marked as enqueued, e.g., when moving it from the deque of a Worker to this queue
+   */
+  void requeue(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
+
   /**
    * Returns a Tasks that is ready to be executed and removes it from the queue
    *
@@ -35,14 +49,53 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> pull(SchedulePriority min_priority = SchedulePriority::Lowest);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues or from the deque of
+   * one of the Workers of this node
    */
   std::shared_ptr<AbstractTask> steal();
 
+  /**
+   * Makes the deque of a Worker pulling from this queue available to steal()
+   */
+  void add_worker_deque(const std::shared_ptr<WorkStealingDeque>& deque);
+
+  /**
+   * Returns a Task from the deque of one of the Workers of this node, e.g., for idle Workers of the same node
+   */
+  std::shared_ptr<AbstractTask> steal_from_worker_deques();
+
+  /**
+   * Blocks the calling Worker until a task is pushed to this queue, unpark_worker() or unpark_all_workers() is called
+   * or the timeout expires. Every push() wakes at most one parked Worker, so that exactly as many Workers wake up as
+   * tasks became ready.
+   */
+  void park_worker(std::chrono::milliseconds timeout);
+
+  /**
+   * Wakes one parked Worker, if there is any, e.g., when a task that it could steal was added to a Worker's deque
+   */
+  void unpark_worker();
+
+  /**
+   * Wakes all parked Workers, e.g., when the Scheduler shuts down
+   */
+  void unpark_all_workers();
+
  private:
+  void _enqueue(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
+
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
   std::atomic_uint _num_tasks{0};
+
+  std::mutex _parking_mutex;
+  std::condition_variable _parking_cv;
+  std::atomic_uint _num_parked_workers{0};
+  uint32_t _num_pending_unparks{0};
+  uint64_t _unpark_all_generation{0};
+
+  std::mutex _worker_deques_mutex;
+  std::vector<std::shared_ptr<WorkStealingDeque>> _worker_deques;
 };
 
 }  // namespace opossum
@@ -4,7 +4,13 @@
 #include <numa.h>
 #endif
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+#include <unistd.h>
+
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <sstream>
@@ -27,7 +33,10 @@ Topology& Topology::get() {
   return instance;
 }
 
-Topology::Topology() { _init_default_topology(); }
+Topology::Topology() {
+  _detect_cache_info();
+  _init_default_topology();
+}
 
 void TopologyNode::print(std::ostream& stream) const {
   stream << "Number of Node CPUs: " << cpus.size() << ", CPUIDs: [";
@@ -40,6 +49,12 @@ void TopologyNode::print(std::ostream& stream) const {
   stream << "]";
 }
 
+void TopologyCacheInfo::print(std::ostream& stream) const {
+  stream << "Cache line: " << cache_line_size << "B, L1d: " << l1_data_cache_size << "B, L2: " << l2_cache_size
+         << "B, L3: " << l3_cache_size << "B, Page: " << page_size << "B, L1 dTLB: " << l1_data_tlb_entry_count
+         << " entries, L2 TLB: " << l2_tlb_entry_count << " entries";
+}
+
 void Topology::use_default_topology() { Topology::get()._init_default_topology(); }
 
 void Topology::use_numa_topology(uint32_t max_num_cores) { Topology::get()._init_numa_topology(max_num_cores); }
@@ -170,6 +185,28 @@ const std::vector<TopologyNode>& Topology::nodes() { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+std::vector<NodeID> Topology::nodes_by_distance(NodeID node_id) const {
+  DebugAssert(node_id < _nodes.size(), "node_id is out of bounds");
+
+  auto node_ids = std::vector<NodeID>{};
+  node_ids.reserve(_nodes.size() - 1);
+  for (auto offset = size_t{1}; offset < _nodes.size(); ++offset) {
+    node_ids.emplace_back(static_cast<NodeID>((node_id + offset) % _nodes.size()));
+  }
+
+#if HYRISE_NUMA_SUPPORT
+  if (!_fake_numa_topology) {
+    std::stable_sort(node_ids.begin(), node_ids.end(), [&](const auto& left, const auto& right) {
+      return numa_distance(node_id, left) < numa_distance(node_id, right);
+    });
+  }
+#endif
+
+  return node_ids;
+}
+
+const TopologyCacheInfo& Topology::cache_info() const { return _cache_info; }
+
 boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_id) {
   DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
   return &_memory_resources[static_cast<size_t>(node_id)];
@@ -182,6 +219,78 @@ void Topology::print(std::ostream& stream) const {
     _nodes[node_idx].print(stream);
     stream << std::endl;
   }
+  _cache_info.print(stream);
+  stream << std::endl;
+}
+
+void Topology::_detect_cache_info() {
+  // Caches: Use sysconf where available (glibc) and let sysfs override its values, as it is more reliable, e.g., in
+  // virtualized environments where sysconf reports zero.
+  const auto update = [](size_t& value, const long detected_value) {  // NOLINT(runtime/int)
+    if (detected_value > 0) value = static_cast<size_t>(detected_value);
+  };
+
+#ifdef _SC_LEVEL1_DCACHE_LINESIZE
+  update(_cache_info.cache_line_size, sysconf(_SC_LEVEL1_DCACHE_LINESIZE));
+  update(_cache_info.l1_data_cache_size, sysconf(_SC_LEVEL1_DCACHE_SIZE));
+  update(_cache_info.l2_cache_size, sysconf(_SC_LEVEL2_CACHE_SIZE));
+  update(_cache_info.l3_cache_size, sysconf(_SC_LEVEL3_CACHE_SIZE));
+#endif
+  update(_cache_info.page_size, sysconf(_SC_PAGESIZE));
+
+  for (auto index = 0; index < 8; ++index) {
+    const auto path = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+
+    auto level = 0;
+    auto type = std::string{};
+    auto size = std::string{};
+    if (!(std::ifstream{path + "level"} >> level) || !(std::ifstream{path + "type"} >> type) ||
+        !(std::ifstream{path + "size"} >> size) || size.empty()) {
+      break;
+    }
+    if (type == "Instruction") continue;
+
+    // Sizes are reported as, e.g., "32K"
+    auto size_in_bytes = std::stol(size);
+    if (size.back() == 'K') size_in_bytes *= 1024;
+    if (size.back() == 'M') size_in_bytes *= 1024 * 1024;
+
+    if (level == 1) update(_cache_info.l1_data_cache_size, size_in_bytes);
+    if (level == 2) update(_cache_info.l2_cache_size, size_in_bytes);
+    if (level == 3) update(_cache_info.l3_cache_size, size_in_bytes);
+  }
+
+  // TLBs: Neither sysconf nor sysfs provide TLB sizes, so we query them using cpuid.
+#if defined(__x86_64__) || defined(__i386__)
+  auto eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
+
+  __get_cpuid(0, &eax, &ebx, &ecx, &edx);
+  const auto max_leaf = eax;
+  const auto is_amd = ebx == 0x68747541;  // "Auth" of "AuthenticAMD"
+
+  if (!is_amd && max_leaf >= 0x18) {
+    // Intel: Deterministic Address Translation Parameters, one sub-leaf per TLB
+    __get_cpuid_count(0x18, 0, &eax, &ebx, &ecx, &edx);
+    const auto max_sub_leaf = eax;
+    for (auto sub_leaf = 0u; sub_leaf <= max_sub_leaf; ++sub_leaf) {
+      __get_cpuid_count(0x18, sub_leaf, &eax, &ebx, &ecx, &edx);
+      const auto tlb_type = edx & 0x1F;  // 1: data TLB, 3: unified TLB
+      const auto tlb_level = (edx >> 5) & 0x7;
+      const auto supports_4k_pages = ebx & 0x1;
+      const auto entry_count = ((ebx >> 16) & 0xFFFF) * ecx;
+
+      if (!supports_4k_pages || entry_count == 0) continue;
+      if (tlb_level == 1 && tlb_type == 1) _cache_info.l1_data_tlb_entry_count = entry_count;
+      if (tlb_level == 2 && (tlb_type == 1 || tlb_type == 3)) _cache_info.l2_tlb_entry_count = entry_count;
+    }
+  } else if (is_amd && __get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) && eax >= 0x80000006) {
+    // AMD: L1 and L2 TLB information for 4KB pages
+    __get_cpuid(0x80000005, &eax, &ebx, &ecx, &edx);
+    if (((ebx >> 16) & 0xFF) > 0) _cache_info.l1_data_tlb_entry_count = (ebx >> 16) & 0xFF;
+    __get_cpuid(0x80000006, &eax, &ebx, &ecx, &edx);
+    if (((ebx >> 16) & 0xFFF) > 0) _cache_info.l2_tlb_entry_count = (ebx >> 16) & 0xFFF;
+  }
+#endif
 }
 
 void Topology::_clear() {
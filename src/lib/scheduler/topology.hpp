@@ -32,6 +32,25 @@ struct TopologyNode final {
   std::vector<TopologyCpu> cpus;
 };
 
+/**
+ * Sizes of the data caches and data TLBs of the first CPU. They are detected once, when the Topology is created, and
+ * are used by operators that adapt their data structures to the memory hierarchy (e.g., the radix partitioning of
+ * JoinHash). If a value cannot be detected, the default below is kept.
+ */
+struct TopologyCacheInfo final {
+  void print(std::ostream& stream = std::cout) const;
+
+  size_t cache_line_size{64};
+  size_t l1_data_cache_size{32 * 1024};
+  size_t l2_cache_size{256 * 1024};
+  size_t l3_cache_size{8 * 1024 * 1024};
+
+  size_t page_size{4 * 1024};
+  // Number of entries for 4KB pages in the first level data TLB and in the second level (shared) TLB
+  size_t l1_data_tlb_entry_count{64};
+  size_t l2_tlb_entry_count{1536};
+};
+
 /**
  * Topology is a singleton that encapsulates the Machine Architecture, i.e. how many Nodes/Cores there are.
  * It is initialized with the actual system topology by default, but can be newly initialized with a custom topology
@@ -84,6 +103,15 @@ class Topology final {
 
   size_t num_cpus() const;
 
+  /**
+   * Returns the ids of all nodes except node_id, ordered by their NUMA distance from node_id, e.g., to determine the
+   * order in which Workers steal tasks from other nodes. Nodes with the same distance (and all nodes of a fake-NUMA
+   * topology) are ordered round-robin, starting after node_id, so that not all nodes prefer the same victim.
+   */
+  std::vector<NodeID> nodes_by_distance(NodeID node_id) const;
+
+  const TopologyCacheInfo& cache_info() const;
+
   boost::container::pmr::memory_resource* get_memory_resource(int node_id);
 
   void print(std::ostream& stream = std::cout) const;
@@ -96,12 +124,15 @@ class Topology final {
   void _init_non_numa_topology(uint32_t max_num_cores = 0);
   void _init_fake_numa_topology(uint32_t max_num_workers = 0, uint32_t workers_per_node = 1);
 
+  void _detect_cache_info();
+
   void _clear();
   void _create_memory_resources();
 
   std::vector<TopologyNode> _nodes;
   size_t _num_cpus{0};
   bool _fake_numa_topology{false};
+  TopologyCacheInfo _cache_info;
 
   static const int _number_of_hardware_nodes;
 
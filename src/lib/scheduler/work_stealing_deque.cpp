@@ -0,0 +1,130 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Moves the task out of the pointer that was removed from the deque
+std::shared_ptr<AbstractTask> take_task(std::shared_ptr<AbstractTask>* task_pointer) {
+  auto task = std::move(*task_pointer);
+  delete task_pointer;
+  return task;
+}
+
+}  // namespace
+
+WorkStealingDeque::Buffer::Buffer(size_t capacity)
+    : _capacity(capacity), _slots(std::make_unique<std::atomic<std::shared_ptr<AbstractTask>*>[]>(capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+}
+
+size_t WorkStealingDeque::Buffer::capacity() const { return _capacity; }
+
+std::shared_ptr<AbstractTask>* WorkStealingDeque::Buffer::get(int64_t index) const {
+  return _slots[static_cast<size_t>(index) & (_capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::put(int64_t index, std::shared_ptr<AbstractTask>* task) {
+  _slots[static_cast<size_t>(index) & (_capacity - 1)].store(task, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  const auto* buffer = _buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    delete buffer->get(index);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity()) - 1) {
+    buffer = _grow(*buffer, top, bottom);
+  }
+
+  buffer->put(bottom, new std::shared_ptr<AbstractTask>(task));
+
+  // Make the task visible to thieves before they can see the new bottom
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  // Reserve the bottom task before looking at top, so that thieves cannot take it without us noticing
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task_pointer = buffer->get(bottom);
+
+  if (top == bottom) {
+    // This is the last task, so we race against thieves for it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task_pointer = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!task_pointer) return nullptr;
+  }
+
+  return take_task(task_pointer);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  // The pointer must not be dereferenced before the CAS succeeded, because the owner or another thief might take it
+  auto* task_pointer = _buffer.load(std::memory_order_acquire)->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  return take_task(task_pointer);
+}
+
+size_t WorkStealingDeque::size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0u;
+}
+
+bool WorkStealingDeque::empty() const { return size() == 0u; }
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(const Buffer& buffer, int64_t top, int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer.capacity() * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer.get(index));
+  }
+
+  auto* new_buffer_pointer = new_buffer.get();
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(new_buffer_pointer, std::memory_order_release);
+  return new_buffer_pointer;
+}
+
+}  // namespace opossum
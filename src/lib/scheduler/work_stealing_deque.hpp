@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque of ready tasks as proposed by Chase and Lev ("Dynamic Circular Work-Stealing Deque",
+ * SPAA 2005), using the memory orderings of Lê et al. ("Correct and Efficient Work-Stealing for Weak Memory Models",
+ * PPoPP 2013).
+ *
+ * Each Worker owns one deque. Only the owning Worker calls push() and pop(), which operate on the bottom of the deque,
+ * so that it executes the task it pushed most recently (whose data is most likely still in its caches) next. All
+ * other Workers may call steal(), which takes the oldest task from the top of the deque. Owner and thieves only
+ * synchronize (via a CAS on top) when they compete for the last task.
+ *
+ * Each task is stored in a separately allocated shared_ptr that is only accessed by the thread that successfully
+ * removed it from the deque. When the deque is full, the owner replaces the circular buffer by one of twice the size.
+ * Replaced buffers are kept until the deque is destroyed, because thieves might still read from them.
+ */
+class WorkStealingDeque final : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(size_t initial_capacity = 64);
+  ~WorkStealingDeque();
+
+  /**
+   * Adds a task to the bottom of the deque. Must only be called by the owner.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Removes the task at the bottom of the deque or returns nullptr if the deque is empty. Must only be called by the
+   * owner.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes the task at the top of the deque. Returns nullptr if the deque is empty or if another thread removed the
+   * task concurrently. May be called by any thread.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Number of tasks in the deque. Only a snapshot if other threads access the deque concurrently.
+   */
+  size_t size() const;
+
+  bool empty() const;
+
+ private:
+  // Circular buffer of pointers to tasks, its capacity is a power of two
+  class Buffer final {
+   public:
+    explicit Buffer(size_t capacity);
+
+    size_t capacity() const;
+    std::shared_ptr<AbstractTask>* get(int64_t index) const;
+    void put(int64_t index, std::shared_ptr<AbstractTask>* task);
+
+   private:
+    const size_t _capacity;
+    std::unique_ptr<std::atomic<std::shared_ptr<AbstractTask>*>[]> _slots;
+  };
+
+  Buffer* _grow(const Buffer& buffer, int64_t top, int64_t bottom);
+
+  // top and bottom are modified by different threads and therefore placed on different cache lines
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // Owns the current and all replaced buffers, only accessed by the owner
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
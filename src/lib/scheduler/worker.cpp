@@ -4,6 +4,7 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -14,6 +15,8 @@
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "topology.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace {
 
@@ -26,16 +29,33 @@ thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
 
 namespace opossum {
 
+// Before parking, an idle worker yields this many times to pick up tasks that become ready right away (e.g., the
+// successors of the task it just executed) without the latency of a wakeup
+static constexpr size_t MAX_SPIN_ITERATIONS = 100;
+
+// Parked workers are only woken by tasks pushed to their own queue. They wake up after this duration to steal tasks
+// from other nodes.
+static constexpr auto MAX_PARKING_DURATION = std::chrono::milliseconds(10);
+
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
 Worker::Worker(const std::weak_ptr<ProcessingUnit>& processing_unit, const std::shared_ptr<TaskQueue>& queue,
                WorkerID id, CpuID cpu_id, SchedulePriority min_priority)
-    : _processing_unit(processing_unit), _queue(queue), _id(id), _cpu_id(cpu_id), _min_priority(min_priority) {}
+    : _processing_unit(processing_unit),
+      _queue(queue),
+      _deque(std::make_shared<WorkStealingDeque>()),
+      _id(id),
+      _cpu_id(cpu_id),
+      _min_priority(min_priority) {
+  _queue->add_worker_deque(_deque);
+}
 
 WorkerID Worker::id() const { return _id; }
 
 std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
+std::shared_ptr<WorkStealingDeque> Worker::deque() const { return _deque; }
+
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
 std::weak_ptr<ProcessingUnit> Worker::processing_unit() const { return _processing_unit; }
@@ -55,17 +75,27 @@ void Worker::operator()() {
 
   DebugAssert(static_cast<bool>(processing_unit), "No processing unit");
 
+  // Queues of the other nodes, closest first
+  auto victim_queues = std::vector<std::shared_ptr<TaskQueue>>{};
+  for (const auto node_id : Topology::get().nodes_by_distance(_queue->node_id())) {
+    victim_queues.emplace_back(scheduler->queues()[node_id]);
+  }
+
+  auto idle_iterations = size_t{0};
+
   while (!processing_unit->shutdown_flag()) {
     // Hibernate if this is not the active worker.
     {
       auto this_worker_is_active = processing_unit->try_acquire_active_worker_token(_id);
       if (!this_worker_is_active) {
+        _flush_deque();
         processing_unit->hibernate_calling_worker();
         continue;  // Re-try to become the active worker
       }
     }
 
-    auto task = _queue->pull(_min_priority);
+    auto task = _deque->pop();
+    if (!task) task = _queue->pull(_min_priority);
 
     // TODO(all): this might shutdown the worker and leave non-ready tasks in the queue.
     // Figure out how we want to deal with that later.
@@ -78,29 +108,33 @@ void Worker::operator()() {
         continue;  // Re-try to become the active worker
       }
 
-      // Simple work stealing without explicitly transferring data between nodes.
-      auto work_stealing_successful = false;
-      for (auto& queue : scheduler->queues()) {
-        if (queue == _queue) {
-          continue;
-        }
-
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          work_stealing_successful = true;
-          break;
-        }
+      // Work stealing without explicitly transferring data between nodes. Steal from the deques of the other Workers of
+      // this node first, then from the closest other nodes.
+      task = _queue->steal_from_worker_deques();
+      for (auto victim_queue_iter = victim_queues.cbegin(); !task && victim_queue_iter != victim_queues.cend();
+           ++victim_queue_iter) {
+        task = (*victim_queue_iter)->steal();
       }
 
-      // Sleep iff there is no ready task in our queue and work stealing was not successful.
+      auto work_stealing_successful = static_cast<bool>(task);
+      if (work_stealing_successful) task->set_node_id(_queue->node_id());
+
+      // Spin, then park iff there is no ready task in our queue and work stealing was not successful.
       if (!work_stealing_successful) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (idle_iterations < MAX_SPIN_ITERATIONS) {
+          ++idle_iterations;
+          std::this_thread::yield();
+        } else {
+          _queue->park_worker(MAX_PARKING_DURATION);
+        }
         continue;
       }
     }
 
+    idle_iterations = 0;
+    _current_task = task;
     task->execute();
+    _current_task = nullptr;
 
     // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
     // Scheduler to determine whether all tasks finished
@@ -110,6 +144,45 @@ void Worker::operator()() {
   processing_unit->yield_active_worker_token(_id);
 }
 
+void Worker::push_ready_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  DebugAssert(get_this_thread_worker().get() == this, "Tasks must only be pushed to the deque of the calling Worker");
+
+  if (!task->is_stealable() || priority > _min_priority) {
+    _queue->push(task, static_cast<uint32_t>(priority));
+    return;
+  }
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _deque->push(task);
+
+  // This Worker executes the most recent task itself, so another one is only woken up to steal the older tasks
+  if (_deque->size() > 1) _queue->unpark_worker();
+}
+
+void Worker::yield_processing_unit() {
+  DebugAssert(get_this_thread_worker().get() == this, "Only the Worker itself can yield its processing unit");
+
+  auto processing_unit = _processing_unit.lock();
+  DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
+
+  // Releasing the capacity might admit tasks to this Worker's deque, so this happens before it is flushed
+  if (_current_task) _current_task->_release_resource_group_slot();
+
+  _flush_deque();
+  processing_unit->yield_active_worker_token(_id);
+  processing_unit->wake_or_create_worker();
+}
+
+void Worker::_flush_deque() {
+  // Tasks in the deque are executed before all tasks in the TaskQueue, except for JobTasks
+  while (auto task = _deque->pop()) {
+    _queue->requeue(task, static_cast<uint32_t>(std::min(task->priority(), SchedulePriority::Highest)));
+  }
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
@@ -9,7 +9,9 @@
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
+class WorkStealingDeque;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
@@ -31,11 +33,27 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
+  std::shared_ptr<WorkStealingDeque> deque() const;
   std::weak_ptr<ProcessingUnit> processing_unit() const;
   CpuID cpu_id() const;
 
   void operator()();
 
+  /**
+   * Adds a task that became ready on this Worker's thread (e.g., a successor of the task it executed or a job spawned
+   * by it) to the Worker's own deque, from which the Worker takes the most recently added task first. Tasks that are
+   * not stealable or that this Worker must not execute because of their priority are pushed to the TaskQueue instead.
+   * Must only be called on this Worker's thread.
+   */
+  void push_ready_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority);
+
+  /**
+   * Must be called on this Worker's thread before the task it executes blocks, e.g., to wait for other tasks or for the
+   * admission of a query. Moves the tasks of the deque to the TaskQueue, releases the ResourceGroup capacity of the
+   * blocking task and hands off the active worker token, so that another Worker can execute tasks on this CPU.
+   */
+  void yield_processing_unit();
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -46,11 +64,7 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
      * This method blocks the calling thread (worker) until all tasks have been completed.
      * It hands off the active worker token so that another worker can execute tasks while the calling worker is blocked.
      */
-    auto processing_unit = _processing_unit.lock();
-    DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
-
-    processing_unit->yield_active_worker_token(_id);
-    processing_unit->wake_or_create_worker();
+    yield_processing_unit();
 
     for (auto& task : tasks) {
       task->_join_without_replacement_worker();
@@ -64,11 +78,21 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  /**
+   * Moves all tasks from the deque to the TaskQueue. Called before the Worker gives up the active worker token, so that
+   * the tasks can be pulled by the Workers of this node, including the one that only executes JobTasks.
+   */
+  void _flush_deque();
+
   std::weak_ptr<ProcessingUnit> _processing_unit;
   std::shared_ptr<TaskQueue> _queue;
+  std::shared_ptr<WorkStealingDeque> _deque;
   WorkerID _id;
   CpuID _cpu_id;
   SchedulePriority _min_priority;
+
+  // The task this Worker executes, used by tasks scheduled from within it
+  std::shared_ptr<AbstractTask> _current_task;
 };
 
 }  // namespace opossum
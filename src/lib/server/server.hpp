@@ -9,7 +9,8 @@ namespace opossum {
 
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  Server(boost::asio::io_service& io_service, uint16_t port,
+         const SessionResourceGroupConfig& session_resource_group_config = {});
 
   uint16_t get_port_number();
 
@@ -20,6 +21,7 @@ class Server {
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   boost::asio::ip::tcp::socket _socket;
+  const SessionResourceGroupConfig _session_resource_group_config;
 };
 
 }  // namespace opossum
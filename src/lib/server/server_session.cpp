@@ -173,7 +173,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true, _resource_group));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -215,7 +215,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
     _prepared_statements.erase(statement_it);
   }
 
-  return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(parse_info.query)) >> then >>
+  auto task = std::make_shared<CreatePipelineTask>(parse_info.query, false, _resource_group);
+  return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<CreatePipelineResult> result) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
            _prepared_statements.insert(std::make_pair(prepared_statement_name, result->sql_pipeline));
@@ -292,7 +293,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
 
   query_plan->set_transaction_context(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(query_plan)) >> then >>
+  auto task = std::make_shared<ExecuteServerPreparedStatementTask>(query_plan, _resource_group);
+  return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table)
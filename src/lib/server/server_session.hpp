@@ -8,20 +8,37 @@
 
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
+#include "scheduler/resource_group.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "task_runner.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+/**
+ * Configures the ResourceGroup that each session gets, see ResourceGroup. The limits for all sessions together, i.e.,
+ * max_active_tasks, max_queued_tasks, and max_memory_usage, are set in the ResourceGroupManager.
+ */
+struct SessionResourceGroupConfig {
+  uint32_t weight = 1;
+  size_t max_concurrent_tasks = 0;
+};
+
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
-  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
-      : _connection(connection), _task_runner(task_runner) {}
+  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner,
+                             const SessionResourceGroupConfig& resource_group_config = {})
+      : _connection(connection),
+        _task_runner(task_runner),
+        _resource_group(std::make_shared<ResourceGroup>("session", resource_group_config.weight,
+                                                        resource_group_config.max_concurrent_tasks)) {}
 
   boost::future<void> start();
 
+  // All tasks of the session's statements belong to this group, so that one session cannot monopolize the Workers
+  const std::shared_ptr<ResourceGroup>& resource_group() const { return _resource_group; }
+
  protected:
   boost::future<void> _perform_session_startup();
 
@@ -38,6 +55,7 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
 
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
+  const std::shared_ptr<ResourceGroup> _resource_group;
 
   std::shared_ptr<TransactionContext> _transaction;
   std::unordered_map<std::string, std::shared_ptr<SQLPipeline>> _prepared_statements;
@@ -0,0 +1,224 @@
+#include "normalize_sql_literals.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+// Returns the position after the next occurrence of @param terminator, or the end of @param sql if there is none
+size_t find_end(const std::string& sql, const size_t begin, const std::string& terminator) {
+  const auto terminator_position = sql.find(terminator, begin);
+  return terminator_position == std::string::npos ? sql.size() : terminator_position + terminator.size();
+}
+
+// Parses a number the way the SQLParser and the SQLTranslator do, returns std::nullopt if it is out of range
+std::optional<AllTypeVariant> parse_number(const std::string& token) {
+  errno = 0;
+
+  if (token.find('.') != std::string::npos) {
+    const auto value = std::strtod(token.c_str(), nullptr);
+    if (errno == ERANGE) return std::nullopt;
+    return AllTypeVariant{static_cast<decltype(hsql::Expr::fval)>(value)};
+  }
+
+  const auto value = std::strtoll(token.c_str(), nullptr, 10);
+  if (errno == ERANGE) return std::nullopt;
+
+  if (static_cast<int32_t>(value) == value) return AllTypeVariant{static_cast<int32_t>(value)};
+  return AllTypeVariant{static_cast<int64_t>(value)};
+}
+
+bool is_column_reference(const hsql::Expr* expr) { return expr && expr->type == hsql::kExprColumnRef; }
+
+bool is_value_placeholder(const hsql::Expr* expr) { return expr && expr->type == hsql::kExprParameter; }
+
+size_t count_scan_value_placeholders(const hsql::SelectStatement& select);
+
+size_t count_scan_value_placeholders(const hsql::Expr& expr) {
+  if (expr.type == hsql::kExprOperator) {
+    switch (expr.opType) {
+      case hsql::kOpEquals:
+      case hsql::kOpNotEquals:
+      case hsql::kOpLess:
+      case hsql::kOpLessEq:
+      case hsql::kOpGreater:
+      case hsql::kOpGreaterEq:
+      case hsql::kOpLike:
+      case hsql::kOpNotLike:
+        if ((is_column_reference(expr.expr) && is_value_placeholder(expr.expr2)) ||
+            (is_value_placeholder(expr.expr) && is_column_reference(expr.expr2))) {
+          return 1;
+        }
+        break;
+
+      case hsql::kOpBetween:
+        if (is_column_reference(expr.expr) && expr.exprList) {
+          auto count = size_t{0};
+          for (const auto* bound : *expr.exprList) {
+            count += is_value_placeholder(bound) ? 1 : count_scan_value_placeholders(*bound);
+          }
+          return count;
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  // Placeholders are only counted by the predicate they are an argument of, all others are not scan values
+  auto count = size_t{0};
+  if (expr.expr) count += count_scan_value_placeholders(*expr.expr);
+  if (expr.expr2) count += count_scan_value_placeholders(*expr.expr2);
+  if (expr.exprList) {
+    for (const auto* argument : *expr.exprList) count += count_scan_value_placeholders(*argument);
+  }
+  if (expr.select) count += count_scan_value_placeholders(*expr.select);
+  return count;
+}
+
+size_t count_scan_value_placeholders(const hsql::TableRef& table_ref) {
+  switch (table_ref.type) {
+    case hsql::kTableSelect:
+      return count_scan_value_placeholders(*table_ref.select);
+
+    case hsql::kTableJoin:
+      return count_scan_value_placeholders(*table_ref.join->left) +
+             count_scan_value_placeholders(*table_ref.join->right);
+
+    case hsql::kTableCrossProduct: {
+      auto count = size_t{0};
+      for (const auto* table : *table_ref.list) count += count_scan_value_placeholders(*table);
+      return count;
+    }
+
+    default:
+      return 0;
+  }
+}
+
+size_t count_scan_value_placeholders(const hsql::SelectStatement& select) {
+  auto count = size_t{0};
+  if (select.fromTable) count += count_scan_value_placeholders(*select.fromTable);
+  if (select.whereClause) count += count_scan_value_placeholders(*select.whereClause);
+  return count;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = NormalizedSQL{};
+  normalized_sql.sql.reserve(sql.size());
+
+  auto position = size_t{0};
+  while (position < sql.size()) {
+    const auto character = sql[position];
+    auto token_end = position + 1;
+    auto literal = std::optional<AllTypeVariant>{};
+
+    if (character == '?') {
+      // Mixing the placeholders of the statement with those for its literals would mix up their ValuePlaceholderIDs
+      return std::nullopt;
+    } else if (sql.compare(position, 2, "--") == 0) {
+      token_end = find_end(sql, position, "\n");
+    } else if (sql.compare(position, 2, "/*") == 0) {
+      token_end = find_end(sql, position + 2, "*/");
+    } else if (character == '"' || character == '`') {
+      token_end = find_end(sql, position + 1, std::string(1, character));
+    } else if (character == '\'') {
+      // Quotes within a string are escaped by doubling them
+      token_end = find_end(sql, position + 1, "'");
+      while (token_end < sql.size() && sql[token_end] == '\'') token_end = find_end(sql, token_end + 1, "'");
+
+      const auto is_terminated = token_end - position >= 2 && sql[token_end - 1] == '\'';
+      if (is_terminated) {
+        auto value = sql.substr(position + 1, token_end - position - 2);
+        if (value.find_first_of("'\\") == std::string::npos) literal = std::move(value);
+      }
+    } else if (is_digit(character)) {
+      while (token_end < sql.size() && is_digit(sql[token_end])) ++token_end;
+      if (token_end < sql.size() && sql[token_end] == '.') {
+        ++token_end;
+        while (token_end < sql.size() && is_digit(sql[token_end])) ++token_end;
+      }
+
+      // Skip numbers that are part of something else, e.g., `1e5` or `.5`
+      const auto is_separate = (position == 0 || sql[position - 1] != '.') &&
+                               (token_end == sql.size() ||
+                                (!is_identifier_character(sql[token_end]) && sql[token_end] != '.'));
+
+      // The SQLParser turns `-5` into a unary minus applied to 5, which would become `-?`. Such a placeholder is not a
+      // scan value, so negative numbers (and, as it is not told apart, subtrahends as in `a - 5`) are left as they are.
+      auto is_negated = false;
+      if (position > 0) {
+        const auto previous_character_position = sql.find_last_not_of(" \t\r\n", position - 1);
+        is_negated = previous_character_position != std::string::npos && sql[previous_character_position] == '-';
+      }
+
+      if (is_separate && !is_negated) literal = parse_number(sql.substr(position, token_end - position));
+    } else if (is_identifier_character(character)) {
+      // Digits within identifiers (e.g., `t1`) are not literals
+      while (token_end < sql.size() && is_identifier_character(sql[token_end])) ++token_end;
+    }
+
+    if (literal) {
+      normalized_sql.sql += '?';
+      normalized_sql.literals.emplace_back(std::move(*literal));
+    } else {
+      normalized_sql.sql.append(sql, position, token_end - position);
+    }
+    position = token_end;
+  }
+
+  if (normalized_sql.literals.empty() ||
+      normalized_sql.literals.size() > std::numeric_limits<ValuePlaceholderID::base_type>::max()) {
+    return std::nullopt;
+  }
+
+  return normalized_sql;
+}
+
+bool value_placeholders_are_scan_values(const hsql::SQLStatement& statement, const size_t num_placeholders) {
+  auto num_scan_value_placeholders = size_t{0};
+
+  switch (statement.type()) {
+    case hsql::kStmtSelect:
+      num_scan_value_placeholders =
+          count_scan_value_placeholders(static_cast<const hsql::SelectStatement&>(statement));
+      break;
+
+    case hsql::kStmtDelete: {
+      const auto& delete_statement = static_cast<const hsql::DeleteStatement&>(statement);
+      if (delete_statement.expr) num_scan_value_placeholders = count_scan_value_placeholders(*delete_statement.expr);
+    } break;
+
+    case hsql::kStmtUpdate: {
+      const auto& update = static_cast<const hsql::UpdateStatement&>(statement);
+      if (update.where) num_scan_value_placeholders = count_scan_value_placeholders(*update.where);
+    } break;
+
+    default:
+      break;
+  }
+
+  return num_scan_value_placeholders == num_placeholders;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "SQLParser.h"
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+/**
+ * An SQL string whose literals were replaced by value placeholders, e.g., "SELECT * FROM t WHERE a = 5 AND b = 'x'"
+ * becomes "SELECT * FROM t WHERE a = ? AND b = ?" with the literals [5, "x"]. Statements that only differ in their
+ * literals have the same normalized SQL string, so that they can share a plan in the SQLQueryCache.
+ */
+struct NormalizedSQL {
+  std::string sql;
+
+  // Indexed by the ValuePlaceholderID of the placeholder that replaced the literal
+  std::vector<AllTypeVariant> literals;
+};
+
+/**
+ * Replaces the integer, float and string literals in @param sql by value placeholders. The literals get the same type
+ * and value as when the SQLTranslator translates them. Literals that would need further processing (e.g., negative
+ * numbers, strings with escaped characters) stay in the string.
+ *
+ * @return std::nullopt if there is no literal to replace or if @param sql already contains value placeholders
+ */
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql);
+
+/**
+ * Whether the plan of @param statement does not depend on the values of its @param num_placeholders value
+ * placeholders. This is the case if each one is compared to a column in a WHERE clause (e.g., `a > ?`,
+ * `b BETWEEN ? AND ?`), where it becomes the value of a scan. In other places, e.g., in the SELECT list or in the
+ * LIMIT clause, the value of a literal affects the plan or the names of the output columns.
+ */
+bool value_placeholders_are_scan_values(const hsql::SQLStatement& statement, const size_t num_placeholders);
+
+}  // namespace opossum
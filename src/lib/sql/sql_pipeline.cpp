@@ -7,6 +7,7 @@
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "scheduler/resource_group_manager.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -15,6 +16,7 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
                          const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<PreparedStatementCache>& prepared_statements,
+                         const std::shared_ptr<ResourceGroup>& resource_group,
                          const CleanupTemporaries cleanup_temporaries)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
@@ -74,7 +76,7 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
         statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
-        prepared_statements, cleanup_temporaries);
+        prepared_statements, resource_group, cleanup_temporaries);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -195,6 +197,8 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   _result_tables.reserve(_sql_pipeline_statements.size());
 
+  const auto query_admission = QueryAdmission{};
+
   for (auto& pipeline_statement : _sql_pipeline_statements) {
     pipeline_statement->get_result_table();
     if (_transaction_context && _transaction_context->aborted()) {
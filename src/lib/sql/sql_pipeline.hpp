@@ -46,7 +46,7 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-              const CleanupTemporaries cleanup_temporaries);
+              const std::shared_ptr<ResourceGroup>& resource_group, const CleanupTemporaries cleanup_temporaries);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -70,7 +70,8 @@ class SQLPipeline : public Noncopyable {
   // get_result_tables().back()
   std::shared_ptr<const Table> get_result_table();
 
-  // Executes all tasks, waits for them to finish, and returns the resulting tables
+  // Executes all tasks, waits for them to finish, and returns the resulting tables. The execution only starts once the
+  // ResourceGroupManager admits the query, see ResourceGroupManager::admit_query().
   const std::vector<std::shared_ptr<const Table>>& get_result_tables();
 
   // Returns the TransactionContext that was passed to the SQLPipelineStatement, or nullptr if none was passed in.
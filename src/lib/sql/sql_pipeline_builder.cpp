@@ -33,6 +33,11 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group) {
+  _resource_group = resource_group;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
@@ -44,7 +49,8 @@ SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements, _cleanup_temporaries};
+  return {_sql,      _transaction_context, _use_mvcc,      lqp_translator,
+          optimizer, _prepared_statements, _resource_group, _cleanup_temporaries};
 }
 
 SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
@@ -52,8 +58,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
-          optimizer, _prepared_statements,  _cleanup_temporaries};
+  return {_sql,      std::move(parsed_sql), _use_mvcc,       _transaction_context, lqp_translator,
+          optimizer, _prepared_statements,  _resource_group, _cleanup_temporaries};
 }
 
 }  // namespace opossum
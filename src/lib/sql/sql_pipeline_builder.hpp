@@ -11,6 +11,7 @@
 namespace opossum {
 
 class Optimizer;
+class ResourceGroup;
 
 /**
  * Interface for the configured execution of SQL.
@@ -28,6 +29,7 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
  *  - No JIT operators
+ *  - No ResourceGroup, i.e., the tasks of the query are not restricted
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -43,6 +45,12 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_prepared_statement_cache(const std::shared_ptr<PreparedStatementCache>& prepared_statements);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * Executes the tasks of the query within the budget of the ResourceGroup. Pass the same ResourceGroup for all queries
+   * of a session to give it a per-session budget.
+   */
+  SQLPipelineBuilder& with_resource_group(const std::shared_ptr<ResourceGroup>& resource_group);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -69,6 +77,7 @@ class SQLPipelineBuilder final {
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
+  std::shared_ptr<ResourceGroup> _resource_group;
   CleanupTemporaries _cleanup_temporaries{true};
 };
 
@@ -4,18 +4,79 @@
 
 #include <iomanip>
 #include <utility>
+#include <vector>
 
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
 #include "create_sql_parser_error_message.hpp"
 #include "expression/value_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "normalize_sql_literals.hpp"
+#include "operators/operator_scan_predicate.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/base_column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Collects the scans on ValuePlaceholders in the LQP, together with the row counts the optimizer estimated for them
+std::vector<SQLQueryPlan::PlaceholderScan> collect_placeholder_scans(
+    const std::shared_ptr<AbstractLQPNode>& lqp,
+    const std::unordered_map<ValuePlaceholderID, ParameterID>& parameter_ids) {
+  auto value_placeholder_ids = std::unordered_map<ParameterID, ValuePlaceholderID>{};
+  for (const auto& [value_placeholder_id, parameter_id] : parameter_ids) {
+    value_placeholder_ids.emplace(parameter_id, value_placeholder_id);
+  }
+
+  auto placeholder_scans = std::vector<SQLQueryPlan::PlaceholderScan>{};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::Predicate) return LQPVisitation::VisitInputs;
+
+    const auto& predicate = *std::static_pointer_cast<PredicateNode>(node)->predicate;
+    const auto operator_scan_predicates = OperatorScanPredicate::from_expression(predicate, *node->left_input());
+    if (!operator_scan_predicates) return LQPVisitation::VisitInputs;
+
+    const auto input_statistics = node->left_input()->get_statistics();
+
+    for (const auto& operator_scan_predicate : *operator_scan_predicates) {
+      if (!is_parameter_id(operator_scan_predicate.value)) continue;
+
+      // LIKE is estimated with a magic number, no matter the value
+      const auto predicate_condition = operator_scan_predicate.predicate_condition;
+      if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+        continue;
+      }
+
+      // Correlated parameters of subselects are not ValuePlaceholders
+      const auto value_placeholder_id_iter =
+          value_placeholder_ids.find(boost::get<ParameterID>(operator_scan_predicate.value));
+      if (value_placeholder_id_iter == value_placeholder_ids.end()) continue;
+
+      const auto& column_statistics = input_statistics->column_statistics()[operator_scan_predicate.column_id];
+      const auto estimate = column_statistics->estimate_predicate_with_value_placeholder(predicate_condition);
+
+      placeholder_scans.push_back({value_placeholder_id_iter->second, predicate_condition, column_statistics,
+                                   input_statistics->row_count(),
+                                   estimate.selectivity * input_statistics->row_count()});
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  return placeholder_scans;
+}
+
+}  // namespace
+
 namespace opossum {
 
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
@@ -24,6 +85,7 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<PreparedStatementCache>& prepared_statements,
+                                           const std::shared_ptr<ResourceGroup>& resource_group,
                                            const CleanupTemporaries cleanup_temporaries)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
@@ -34,6 +96,7 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
       _prepared_statements(prepared_statements),
+      _resource_group(resource_group),
       _cleanup_temporaries(cleanup_temporaries) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
@@ -155,7 +218,19 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     }
   };
 
-  if (const auto cached_plan = SQLQueryCache<SQLQueryPlan>::get().try_get(_sql_string)) {
+  // Statements that scan by literals share the plan of statements that only differ in these literals
+  auto normalized_sql = std::optional<NormalizedSQL>{};
+  if (statement->isType(hsql::kStmtSelect) || statement->isType(hsql::kStmtDelete) ||
+      statement->isType(hsql::kStmtUpdate)) {
+    normalized_sql = normalize_sql_literals(_sql_string);
+  }
+  auto uses_parameterized_plan = false;
+
+  auto cached_plan = SQLQueryCache<SQLQueryPlan>::get().try_get(_sql_string);
+  // Empty plans mark normalized SQL strings that cannot be parameterized (see _get_parameterized_plan())
+  if (cached_plan && cached_plan->tree_roots().empty()) cached_plan = std::nullopt;
+
+  if (cached_plan) {
     // Handle query plan if statement has been cached
     auto& plan = *cached_plan;
 
@@ -200,6 +275,24 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     _query_plan->append_plan(*plan);
     _query_plan->tree_roots().front()->set_parameters(parameters);
 
+    done = std::chrono::high_resolution_clock::now();
+  } else if (const auto parameterized_plan =
+                 normalized_sql ? _get_parameterized_plan(*normalized_sql) : std::nullopt) {
+    // Handle query plan if the literals of the statement are the values of the plan's ValuePlaceholders
+    assert_same_mvcc_mode(*parameterized_plan);
+    _parameter_ids = parameterized_plan->parameter_ids();
+
+    std::unordered_map<ParameterID, AllTypeVariant> parameters;
+    for (auto value_placeholder_id = ValuePlaceholderID{0}; value_placeholder_id < normalized_sql->literals.size();
+         ++value_placeholder_id) {
+      parameters.emplace(_parameter_ids.at(value_placeholder_id), normalized_sql->literals[value_placeholder_id]);
+    }
+
+    // As for prepared statements, the parameters must not be set in the plan in the cache
+    _query_plan->append_plan(parameterized_plan->deep_copy());
+    _query_plan->tree_roots().front()->set_parameters(parameters);
+    uses_parameterized_plan = true;
+
     done = std::chrono::high_resolution_clock::now();
   } else {
     // "Normal" mode in which the query plan is created
@@ -221,8 +314,9 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
     _prepared_statements->set(prepared_statement->name, *_query_plan);
   }
 
-  // Cache newly created plan for the according sql statement (only if not already cached)
-  if (!_metrics->query_plan_cache_hit) {
+  // Cache newly created plan for the according sql statement (only if not already cached). Parameterized plans are
+  // cached by their normalized SQL string instead.
+  if (!_metrics->query_plan_cache_hit && !uses_parameterized_plan) {
     SQLQueryCache<SQLQueryPlan>::get().set(_sql_string, *_query_plan);
   }
 
@@ -231,6 +325,65 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
   return _query_plan;
 }
 
+std::optional<SQLQueryPlan> SQLPipelineStatement::_get_parameterized_plan(const NormalizedSQL& normalized_sql) {
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+
+  auto plan = cache.try_get(normalized_sql.sql);
+  const auto cache_hit = plan.has_value();
+  if (!cache_hit) {
+    plan = _create_parameterized_plan(normalized_sql);
+    if (!plan) {
+      // Whether a statement can be parameterized only depends on its normalized SQL string. An empty plan is cached,
+      // so that the next statement with the same normalized SQL string is not parsed again to find out.
+      cache.set(normalized_sql.sql, SQLQueryPlan{_cleanup_temporaries});
+      return std::nullopt;
+    }
+    cache.set(normalized_sql.sql, *plan);
+  }
+
+  if (plan->tree_roots().empty()) return std::nullopt;
+
+  // Parameter sniffing: If the literals are far more or less selective than the optimizer assumed for the
+  // placeholders, this statement gets a plan that is optimized for its literals
+  if (!plan->fits_parameter_values(normalized_sql.literals)) return std::nullopt;
+
+  _metrics->query_plan_cache_hit = cache_hit;
+  return plan;
+}
+
+std::optional<SQLQueryPlan> SQLPipelineStatement::_create_parameterized_plan(const NormalizedSQL& normalized_sql) {
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  hsql::SQLParserResult parser_result;
+  hsql::SQLParser::parseSQLString(normalized_sql.sql, &parser_result);
+
+  // E.g., literals in the SELECT list or the LIMIT clause cannot be replaced by placeholders, or not everywhere
+  if (!parser_result.isValid() || parser_result.size() != 1 ||
+      !value_placeholders_are_scan_values(*parser_result.getStatement(0), normalized_sql.literals.size())) {
+    return std::nullopt;
+  }
+
+  SQLTranslator sql_translator{_use_mvcc};
+  const auto unoptimized_lqp = sql_translator.translate_parser_result(parser_result).front();
+  const auto& parameter_ids = sql_translator.value_placeholders();
+
+  const auto translated = std::chrono::high_resolution_clock::now();
+  _metrics->translate_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(translated - started);
+
+  const auto optimized_lqp = _optimizer->optimize(unoptimized_lqp);
+
+  const auto optimized = std::chrono::high_resolution_clock::now();
+  _metrics->optimize_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(optimized - translated);
+
+  auto plan = SQLQueryPlan{_cleanup_temporaries};
+  plan.add_tree_by_root(_lqp_translator->translate_node(optimized_lqp));
+  plan.set_parameter_ids(parameter_ids);
+  plan.set_placeholder_scans(collect_placeholder_scans(optimized_lqp, parameter_ids));
+  if (_use_mvcc == UseMvcc::Yes) plan.set_transaction_context(_transaction_context);
+
+  return plan;
+}
+
 const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_tasks() {
   if (!_tasks.empty()) {
     return _tasks;
@@ -242,6 +395,9 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
 
   const auto& root = query_plan->tree_roots().front();
   _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries);
+  if (_resource_group) {
+    for (const auto& task : _tasks) task->set_resource_group(_resource_group);
+  }
   return _tasks;
 }
 
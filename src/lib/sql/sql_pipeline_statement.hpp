@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
@@ -12,6 +13,9 @@
 
 namespace opossum {
 
+class ResourceGroup;
+struct NormalizedSQL;
+
 using PreparedStatementCache = SQLQueryCache<SQLQueryPlan>;
 
 // Holds relevant information about the execution of an SQLPipelineStatement.
@@ -38,6 +42,12 @@ struct SQLPipelineStatementMetrics {
  *
  * E.g: calling sql_pipeline_statement.get_result_table() will result in the following "call stack"
  * get_result_table -> get_tasks -> get_query_plan -> get_optimized_logical_plan -> get_parsed_sql
+ *
+ * Query plans are cached in the SQLQueryCache by their SQL string. Statements whose literals are all compared to
+ * columns in WHERE clauses (e.g., `SELECT * FROM t WHERE a = 5`) instead share a plan that has value placeholders in
+ * place of the literals (see normalize_sql_literals()), unless the literals are far more or less selective than the
+ * optimizer assumed for the placeholders. As the optimizer does not know the literals of such a plan, it cannot prune
+ * chunks by them (see ChunkPruningRule).
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -47,6 +57,7 @@ class SQLPipelineStatement : public Noncopyable {
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<PreparedStatementCache>& prepared_statements,
+                       const std::shared_ptr<ResourceGroup>& resource_group,
                        const CleanupTemporaries cleanup_temporaries);
 
   // Returns the raw SQL string.
@@ -64,7 +75,7 @@ class SQLPipelineStatement : public Noncopyable {
   // For now, this always uses the optimized LQP.
   const std::shared_ptr<SQLQueryPlan>& get_query_plan();
 
-  // Returns all task sets that need to be executed for this query.
+  // Returns all task sets that need to be executed for this query. They use the budget of the ResourceGroup, if any.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
@@ -77,6 +88,12 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
  private:
+  // Returns the plan for the normalized SQL string from the cache, or creates and caches it. Returns std::nullopt if
+  // the statement cannot use such a plan or if the plan is a bad fit for the literals of the statement. For normalized
+  // SQL strings that cannot be parameterized, an empty plan is cached.
+  std::optional<SQLQueryPlan> _get_parameterized_plan(const NormalizedSQL& normalized_sql);
+  std::optional<SQLQueryPlan> _create_parameterized_plan(const NormalizedSQL& normalized_sql);
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -106,6 +123,8 @@ class SQLPipelineStatement : public Noncopyable {
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
   std::unordered_map<ValuePlaceholderID, ParameterID> _parameter_ids;
 
+  const std::shared_ptr<ResourceGroup> _resource_group;
+
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
 };
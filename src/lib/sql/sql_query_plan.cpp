@@ -1,10 +1,13 @@
 #include "sql_query_plan.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
+#include "statistics/base_column_statistics.hpp"
 
 namespace opossum {
 
@@ -40,6 +43,7 @@ SQLQueryPlan SQLQueryPlan::deep_copy() const {
   }
 
   new_plan._parameter_ids = _parameter_ids;
+  new_plan._placeholder_scans = _placeholder_scans;
 
   return new_plan;
 }
@@ -58,4 +62,33 @@ const std::unordered_map<ValuePlaceholderID, ParameterID>& SQLQueryPlan::paramet
   return _parameter_ids;
 }
 
+void SQLQueryPlan::set_placeholder_scans(const std::vector<PlaceholderScan>& placeholder_scans) {
+  _placeholder_scans = placeholder_scans;
+}
+
+const std::vector<SQLQueryPlan::PlaceholderScan>& SQLQueryPlan::placeholder_scans() const { return _placeholder_scans; }
+
+bool SQLQueryPlan::fits_parameter_values(const std::vector<AllTypeVariant>& values) const {
+  for (const auto& placeholder_scan : _placeholder_scans) {
+    DebugAssert(placeholder_scan.value_placeholder_id < values.size(), "No value for ValuePlaceholder");
+    const auto& value = values[placeholder_scan.value_placeholder_id];
+
+    // Values that cannot be compared to the column are left to the scan to handle
+    if (variant_is_null(value)) continue;
+    const auto value_is_string = data_type_from_all_type_variant(value) == DataType::String;
+    if (value_is_string != (placeholder_scan.column_statistics->data_type() == DataType::String)) continue;
+
+    const auto estimate =
+        placeholder_scan.column_statistics->estimate_predicate_with_value(placeholder_scan.predicate_condition, value);
+    const auto row_count = estimate.selectivity * placeholder_scan.input_row_count;
+
+    // Add one row to both, so that an estimation of zero rows is not infinitely far off
+    const auto smaller_row_count = std::min(row_count, placeholder_scan.estimated_row_count) + 1.0f;
+    const auto larger_row_count = std::max(row_count, placeholder_scan.estimated_row_count) + 1.0f;
+    if (larger_row_count > smaller_row_count * MAX_PLACEHOLDER_SCAN_ESTIMATION_ERROR) return false;
+  }
+
+  return true;
+}
+
 }  // namespace opossum
@@ -9,6 +9,7 @@
 
 namespace opossum {
 
+class BaseColumnStatistics;
 class TransactionContext;
 
 // The SQLQueryPlan holds the operator trees that were generated from an SQL query.
@@ -18,6 +19,19 @@ class TransactionContext;
 // When caching a query (through prepared statements or automatically) its SQLQueryPlan object is cached.
 class SQLQueryPlan {
  public:
+  // A scan whose value is a ValuePlaceholder, as the optimizer estimated it
+  struct PlaceholderScan {
+    ValuePlaceholderID value_placeholder_id;
+    PredicateCondition predicate_condition;
+    std::shared_ptr<const BaseColumnStatistics> column_statistics;
+    float input_row_count;
+    float estimated_row_count;
+  };
+
+  // Factor by which the row count estimated for the values of a placeholder scan may differ from the estimation the
+  // plan was optimized with, see fits_parameter_values()
+  static constexpr auto MAX_PLACEHOLDER_SCAN_ESTIMATION_ERROR = 100.0f;
+
   explicit SQLQueryPlan(CleanupTemporaries cleanup_temporaries);
 
   // Add a new operator tree to the query plan by adding the root operator.
@@ -42,6 +56,14 @@ class SQLQueryPlan {
   void set_parameter_ids(const std::unordered_map<ValuePlaceholderID, ParameterID>& parameter_ids);
   const std::unordered_map<ValuePlaceholderID, ParameterID>& parameter_ids() const;
 
+  void set_placeholder_scans(const std::vector<PlaceholderScan>& placeholder_scans);
+  const std::vector<PlaceholderScan>& placeholder_scans() const;
+
+  // The optimizer does not know the values of ValuePlaceholders and estimates scans on them with magic numbers. Returns
+  // false if, for the given values (indexed by ValuePlaceholderID), the row count of a placeholder scan is estimated to
+  // be far off that, so that the plan might be a bad fit for them.
+  bool fits_parameter_values(const std::vector<AllTypeVariant>& values) const;
+
  protected:
   // Should we delete temporary result tables once they are not needed anymore?
   CleanupTemporaries _cleanup_temporaries;
@@ -49,6 +71,7 @@ class SQLQueryPlan {
   // Root nodes of all operator trees that this plan contains.
   std::vector<std::shared_ptr<AbstractOperator>> _roots;
   std::unordered_map<ValuePlaceholderID, ParameterID> _parameter_ids;
+  std::vector<PlaceholderScan> _placeholder_scans;
 };
 
 }  // namespace opossum
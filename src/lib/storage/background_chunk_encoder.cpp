@@ -0,0 +1,89 @@
+#include "background_chunk_encoder.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_selector.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool chunk_is_completed(const Chunk& chunk, const uint32_t max_chunk_size) {
+  if (chunk.size() != max_chunk_size) return false;
+
+  if (chunk.has_mvcc_columns()) {
+    auto mvcc_columns = chunk.get_scoped_mvcc_columns_lock();
+
+    for (const auto begin_cid : mvcc_columns->begin_cids) {
+      if (begin_cid == MvccColumns::MAX_COMMIT_ID) return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+BackgroundChunkEncoder::BackgroundChunkEncoder() = default;
+
+BackgroundChunkEncoder::~BackgroundChunkEncoder() = default;
+
+size_t BackgroundChunkEncoder::encode_completed_chunks() {
+  std::lock_guard<std::mutex> lock(_encode_mutex);
+
+  auto tasks = std::vector<std::shared_ptr<ChunkCompressionTask>>{};
+
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    // The table might have been dropped in the meantime
+    if (!StorageManager::get().has_table(table_name)) continue;
+
+    const auto table = StorageManager::get().get_table(table_name);
+    const auto data_types = table->column_data_types();
+
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->is_mutable() && chunk_is_completed(*chunk, table->max_chunk_size())) chunk_ids.push_back(chunk_id);
+    }
+    if (chunk_ids.empty()) continue;
+
+    // The accesses of the chunks are only known if they have a ChunkAccessCounter
+    auto access_count_sum = uint64_t{0};
+    auto counted_chunk_count = uint64_t{0};
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (const auto access_counter = table->get_chunk(chunk_id)->access_counter()) {
+        access_count_sum += access_counter->counter();
+        ++counted_chunk_count;
+      }
+    }
+
+    for (const auto chunk_id : chunk_ids) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto access_counter = chunk->access_counter();
+      const auto is_frequently_accessed =
+          !access_counter || access_counter->counter() * counted_chunk_count >= access_count_sum;
+
+      const auto chunk_encoding_spec =
+          EncodingSelector::select_chunk_encoding(*chunk, data_types, is_frequently_accessed);
+      tasks.emplace_back(std::make_shared<ChunkCompressionTask>(table_name, chunk_id, chunk_encoding_spec,
+                                                                SchedulePriority::Lowest));
+    }
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  return tasks.size();
+}
+
+void BackgroundChunkEncoder::start(const std::chrono::milliseconds interval) {
+  _encoder_thread = std::make_unique<PausableLoopThread>(interval, [this](size_t) { encode_completed_chunks(); });
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct PausableLoopThread;
+
+/**
+ * The BackgroundChunkEncoder encodes the chunks of all tables in the StorageManager once they are completed (see
+ * ChunkCompressionTask), so that they do not have to be encoded manually.
+ *
+ * The encoding of each column is chosen by the EncodingSelector. A chunk counts as frequently accessed unless its
+ * ChunkAccessCounter reports fewer accesses than the average of the table's chunks. Each chunk is encoded by a
+ * ChunkCompressionTask with SchedulePriority::Lowest, so that the encoding does not delay queries.
+ *
+ * Chunks that are not mutable anymore, e.g., because they have been encoded by a ChunkCompressionTask before, are
+ * skipped. Chunks must not be encoded manually while the BackgroundChunkEncoder is running.
+ */
+class BackgroundChunkEncoder : private Noncopyable {
+ public:
+  BackgroundChunkEncoder();
+  ~BackgroundChunkEncoder();
+
+  /**
+   * Encodes all completed and still mutable chunks and returns their number once they are encoded.
+   */
+  size_t encode_completed_chunks();
+
+  /**
+   * Calls encode_completed_chunks() in a background thread after every interval.
+   */
+  void start(const std::chrono::milliseconds interval);
+
+ private:
+  std::mutex _encode_mutex;
+  std::unique_ptr<PausableLoopThread> _encoder_thread;
+};
+
+}  // namespace opossum
@@ -34,7 +34,11 @@ Chunk::Chunk(const ChunkColumns& columns, const std::shared_ptr<MvccColumns>& mv
 
 bool Chunk::is_mutable() const { return _is_mutable; }
 
-void Chunk::mark_immutable() { _is_mutable = false; }
+void Chunk::mark_immutable() {
+  _is_mutable = false;
+
+  if (has_mvcc_columns()) get_scoped_mvcc_columns_lock()->compute_summary();
+}
 
 void Chunk::replace_column(size_t column_id, const std::shared_ptr<BaseColumn>& column) {
   std::atomic_store(&_columns.at(column_id), column);
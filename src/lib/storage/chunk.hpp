@@ -50,6 +50,7 @@ class Chunk : private Noncopyable {
   // returns whether new rows can be appended to this Chunk
   bool is_mutable() const;
 
+  // Also computes the summary of the MvccColumns, see MvccColumns::compute_summary()
   void mark_immutable();
 
   // Atomically replaces the current column at column_id with the passed column
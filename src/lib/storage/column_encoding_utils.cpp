@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 
+#include "storage/delta_column/delta_encoder.hpp"
 #include "storage/dictionary_column/dictionary_encoder.hpp"
 #include "storage/frame_of_reference/frame_of_reference_encoder.hpp"
 #include "storage/run_length_column/run_length_encoder.hpp"
@@ -24,7 +25,9 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseColumnE
     {EncodingType::Dictionary, std::make_shared<DictionaryEncoder<EncodingType::Dictionary>>()},
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
-    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()}};
+    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
+    {EncodingType::Delta, std::make_shared<DeltaEncoder>()},
+    {EncodingType::FrontCodedDictionary, std::make_shared<DictionaryEncoder<EncodingType::FrontCodedDictionary>>()}};
 
 }  // namespace
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storage/column_iterables/any_column_iterable.hpp"
+#include "storage/delta_column/delta_column_iterable.hpp"
 #include "storage/dictionary_column/dictionary_column_iterable.hpp"
 #include "storage/encoding_type.hpp"
 
@@ -54,6 +55,16 @@ auto create_iterable_from_column(const FrameOfReferenceColumn<T>& column) {
   return erase_type_from_iterable_if_debug(FrameOfReferenceIterable<T>{column});
 }
 
+template <typename T>
+auto create_iterable_from_column(const DeltaColumn<T>& column) {
+  return erase_type_from_iterable_if_debug(DeltaColumnIterable<T>{column});
+}
+
+template <typename T>
+auto create_iterable_from_column(const FrontCodedDictionaryColumn<T>& column) {
+  return erase_type_from_iterable_if_debug(DictionaryColumnIterable<T, FrontCodedStringVector>{column});
+}
+
 /**
  * This function must be forward-declared because ReferenceColumnIterable
  * includes this file leading to a circular dependency
@@ -0,0 +1,204 @@
+#include "delta_column.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <memory>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+namespace {
+
+/**
+ * @brief Reconstructs the values of a block from its unpacked deltas
+ *
+ * Adds min_delta to each delta and calculates the inclusive prefix sum starting from base. The values are calculated
+ * modulo 2^32 or 2^64 respectively, so that they wrap around exactly as they did when the deltas were calculated.
+ * With SSE2, the prefix sum of each register is calculated in log2(lanes) shift-and-add steps, the last lane is then
+ * carried over into the next register.
+ */
+void prefix_sum(const uint32_t* deltas, const uint32_t base, const uint32_t min_delta, uint32_t* out) {
+  static constexpr auto block_size = SimdBp128Packing::block_size;
+
+#ifdef __SSE2__
+  const auto min_delta_reg = _mm_set1_epi32(static_cast<int32_t>(min_delta));
+  auto carry_reg = _mm_set1_epi32(static_cast<int32_t>(base));
+
+  for (auto index = 0u; index < block_size; index += 4u) {
+    auto reg = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + index)), min_delta_reg);
+    reg = _mm_add_epi32(reg, _mm_slli_si128(reg, 4));
+    reg = _mm_add_epi32(reg, _mm_slli_si128(reg, 8));
+    reg = _mm_add_epi32(reg, carry_reg);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), reg);
+
+    carry_reg = _mm_shuffle_epi32(reg, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+#else
+  auto sum = base;
+  for (auto index = 0u; index < block_size; ++index) {
+    sum += deltas[index] + min_delta;
+    out[index] = sum;
+  }
+#endif
+}
+
+void prefix_sum(const uint32_t* deltas, const uint64_t base, const uint64_t min_delta, uint64_t* out) {
+  static constexpr auto block_size = SimdBp128Packing::block_size;
+
+#ifdef __SSE2__
+  const auto zero_reg = _mm_setzero_si128();
+  const auto min_delta_reg = _mm_set1_epi64x(static_cast<int64_t>(min_delta));
+  auto carry_reg = _mm_set1_epi64x(static_cast<int64_t>(base));
+
+  const auto prefix_sum_of_pair = [&](__m128i reg, uint64_t* pair_out) {
+    reg = _mm_add_epi64(reg, min_delta_reg);
+    reg = _mm_add_epi64(reg, _mm_slli_si128(reg, 8));
+    reg = _mm_add_epi64(reg, carry_reg);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pair_out), reg);
+
+    carry_reg = _mm_shuffle_epi32(reg, _MM_SHUFFLE(3, 2, 3, 2));
+  };
+
+  // Each register of four 32-bit deltas is widened into two registers of two 64-bit deltas
+  for (auto index = 0u; index < block_size; index += 4u) {
+    const auto reg = _mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + index));
+    prefix_sum_of_pair(_mm_unpacklo_epi32(reg, zero_reg), out + index);
+    prefix_sum_of_pair(_mm_unpackhi_epi32(reg, zero_reg), out + index + 2u);
+  }
+#else
+  auto sum = base;
+  for (auto index = 0u; index < block_size; ++index) {
+    sum += deltas[index] + min_delta;
+    out[index] = sum;
+  }
+#endif
+}
+
+}  // namespace
+
+template <typename T, typename U>
+DeltaColumn<T, U>::DeltaColumn(pmr_vector<T> block_first_values, pmr_vector<T> block_min_deltas,
+                               pmr_vector<uint8_t> block_bit_sizes, pmr_vector<uint128_t> packed_deltas,
+                               pmr_vector<bool> null_values)
+    : BaseEncodedColumn{data_type_from_type<T>()},
+      _block_first_values{std::move(block_first_values)},
+      _block_min_deltas{std::move(block_min_deltas)},
+      _block_bit_sizes{std::move(block_bit_sizes)},
+      _packed_deltas{std::move(packed_deltas)},
+      _null_values{std::move(null_values)},
+      _block_offsets{_block_bit_sizes.get_allocator()} {
+  DebugAssert(_block_first_values.size() == _block_bit_sizes.size() &&
+                  _block_min_deltas.size() == _block_bit_sizes.size(),
+              "All blocks need a first value, a minimum delta and a bit size.");
+
+  _block_offsets.reserve(_block_bit_sizes.size());
+  auto offset = uint32_t{0u};
+  for (const auto bit_size : _block_bit_sizes) {
+    _block_offsets.push_back(offset);
+    offset += bit_size;
+  }
+
+  DebugAssert(offset == _packed_deltas.size(), "Each block must occupy as many 128-bit words as its bit size.");
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& DeltaColumn<T, U>::block_first_values() const {
+  return _block_first_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& DeltaColumn<T, U>::block_min_deltas() const {
+  return _block_min_deltas;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& DeltaColumn<T, U>::block_bit_sizes() const {
+  return _block_bit_sizes;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint128_t>& DeltaColumn<T, U>::packed_deltas() const {
+  return _packed_deltas;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& DeltaColumn<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+void DeltaColumn<T, U>::decode_block(const size_t block_index, std::array<T, block_size>& values) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  DebugAssert(block_index < _block_bit_sizes.size(), "Passed block index must be valid.");
+
+  auto deltas = std::array<uint32_t, block_size>{};
+  SimdBp128Packing::unpack_block(_packed_deltas.data() + _block_offsets[block_index], deltas.data(),
+                                 _block_bit_sizes[block_index]);
+
+  // The first delta of each block is zero, adding the minimum delta to it is compensated by the base
+  const auto min_delta = static_cast<UnsignedT>(_block_min_deltas[block_index]);
+  const auto base = static_cast<UnsignedT>(static_cast<UnsignedT>(_block_first_values[block_index]) - min_delta);
+
+  prefix_sum(deltas.data(), base, min_delta, reinterpret_cast<UnsignedT*>(values.data()));
+}
+
+template <typename T, typename U>
+const AllTypeVariant DeltaColumn<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  if (_null_values[chunk_offset]) {
+    return NULL_VALUE;
+  }
+
+  auto values = std::array<T, block_size>{};
+  decode_block(chunk_offset / block_size, values);
+
+  return values[chunk_offset % block_size];
+}
+
+template <typename T, typename U>
+size_t DeltaColumn<T, U>::size() const {
+  return _null_values.size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseColumn> DeltaColumn<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_block_first_values = pmr_vector<T>{_block_first_values, alloc};
+  auto new_block_min_deltas = pmr_vector<T>{_block_min_deltas, alloc};
+  auto new_block_bit_sizes = pmr_vector<uint8_t>{_block_bit_sizes, alloc};
+  auto new_packed_deltas = pmr_vector<uint128_t>{_packed_deltas, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+
+  return std::allocate_shared<DeltaColumn>(alloc, std::move(new_block_first_values), std::move(new_block_min_deltas),
+                                           std::move(new_block_bit_sizes), std::move(new_packed_deltas),
+                                           std::move(new_null_values));
+}
+
+template <typename T, typename U>
+size_t DeltaColumn<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + sizeof(T) * (_block_first_values.size() + _block_min_deltas.size()) +
+         sizeof(uint8_t) * _block_bit_sizes.size() + sizeof(uint32_t) * _block_offsets.size() +
+         sizeof(uint128_t) * _packed_deltas.size() + _null_values.size() / bits_per_byte;
+}
+
+template <typename T, typename U>
+EncodingType DeltaColumn<T, U>::encoding_type() const {
+  return EncodingType::Delta;
+}
+
+template class DeltaColumn<int32_t>;
+template class DeltaColumn<int64_t>;
+
+}  // namespace opossum
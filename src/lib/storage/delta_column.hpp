@@ -0,0 +1,97 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <array>
+#include <memory>
+#include <type_traits>
+
+#include "base_encoded_column.hpp"
+#include "storage/vector_compression/simd_bp128/oversized_types.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Column implementing delta encoding with bit-packing
+ *
+ * Delta encoding targets sorted or nearly sorted integer columns,
+ * such as timestamps or surrogate keys, whose values are too
+ * distinct for a dictionary. The column is divided into blocks of
+ * 128 values. Within each block, only the differences between
+ * consecutive values (deltas) are stored. All deltas of a block are
+ * reduced by the block’s minimum delta, so that constant strides
+ * (e.g. of increasing IDs) need zero bits, and are then bit-packed
+ * with the SIMD-BP128 packing using the minimal bit size.
+ *
+ * Blocks are decoded by unpacking the deltas and calculating their
+ * prefix sum using SIMD instructions. Thus, sequential iteration
+ * decodes each block once, while point access decodes the
+ * block containing the requested value.
+ *
+ * As in frame-of-reference encoding, the (reduced) deltas within
+ * a block must fit into 32 bits. Null values are stored in a
+ * separate vector and do not change the deltas.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
+                          enum_c<EncodingType, EncodingType::Delta>, hana::type_c<T>)>>
+class DeltaColumn : public BaseEncodedColumn {
+ public:
+  static constexpr auto block_size = 128u;
+
+  explicit DeltaColumn(pmr_vector<T> block_first_values, pmr_vector<T> block_min_deltas,
+                       pmr_vector<uint8_t> block_bit_sizes, pmr_vector<uint128_t> packed_deltas,
+                       pmr_vector<bool> null_values);
+
+  const pmr_vector<T>& block_first_values() const;
+  const pmr_vector<T>& block_min_deltas() const;
+  const pmr_vector<uint8_t>& block_bit_sizes() const;
+  const pmr_vector<uint128_t>& packed_deltas() const;
+  const pmr_vector<bool>& null_values() const;
+
+  /**
+   * @brief Decodes all values of a block
+   *
+   * For the last block, only the first size() % block_size values are valid.
+   * Null values are decoded as the preceding value.
+   */
+  void decode_block(const size_t block_index, std::array<T, block_size>& values) const;
+
+  /**
+   * @defgroup BaseColumn interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedColumn interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<T> _block_first_values;
+  const pmr_vector<T> _block_min_deltas;
+  const pmr_vector<uint8_t> _block_bit_sizes;
+  const pmr_vector<uint128_t> _packed_deltas;
+  const pmr_vector<bool> _null_values;
+
+  // Index of each block’s first element in _packed_deltas, each block occupies as many elements as its bit size
+  pmr_vector<uint32_t> _block_offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <limits>
+
+#include "storage/column_iterables.hpp"
+
+#include "storage/delta_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DeltaColumnIterable : public PointAccessibleColumnIterable<DeltaColumnIterable<T>> {
+ public:
+  explicit DeltaColumnIterable(const DeltaColumn<T>& column) : _column{column} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    auto begin = Iterator{&_column, ChunkOffset{0u}};
+    auto end = Iterator{&_column, static_cast<ChunkOffset>(_column.size())};
+
+    functor(begin, end);
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
+    auto begin = PointAccessIterator{&_column, mapped_chunk_offsets.cbegin()};
+    auto end = PointAccessIterator{mapped_chunk_offsets.cend()};
+
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _column.size(); }
+
+ private:
+  const DeltaColumn<T>& _column;
+
+ private:
+  static constexpr auto block_size = DeltaColumn<T>::block_size;
+
+  class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorValue<T>> {
+   public:
+    explicit Iterator(const DeltaColumn<T>* column, ChunkOffset chunk_offset)
+        : _column{column}, _chunk_offset{chunk_offset} {
+      // Only the begin iterator needs decoded values
+      if (_chunk_offset < _column->size()) _column->decode_block(_chunk_offset / block_size, _block_values);
+    }
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+
+      if (_chunk_offset % block_size == 0u && _chunk_offset < _column->size()) {
+        _column->decode_block(_chunk_offset / block_size, _block_values);
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto value = _block_values[_chunk_offset % block_size];
+      return ColumnIteratorValue<T>{value, _column->null_values()[_chunk_offset], _chunk_offset};
+    }
+
+   private:
+    const DeltaColumn<T>* _column;
+    ChunkOffset _chunk_offset;
+    std::array<T, block_size> _block_values{};
+  };
+
+  /**
+   * The most recently decoded block is cached, so that consecutive accesses to the same block, which are common
+   * when a sorted reference column is dereferenced, decode it only once.
+   */
+  class PointAccessIterator : public BasePointAccessColumnIterator<PointAccessIterator, ColumnIteratorValue<T>> {
+   public:
+    // Begin Iterator
+    PointAccessIterator(const DeltaColumn<T>* column, ChunkOffsetsIterator chunk_offsets_it)
+        : BasePointAccessColumnIterator<PointAccessIterator, ColumnIteratorValue<T>>{chunk_offsets_it},
+          _column{column} {}
+
+    // End Iterator
+    explicit PointAccessIterator(ChunkOffsetsIterator chunk_offsets_it)
+        : PointAccessIterator{nullptr, chunk_offsets_it} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      const auto block_index = chunk_offsets.into_referenced / block_size;
+      if (block_index != _decoded_block_index) {
+        _column->decode_block(block_index, _block_values);
+        _decoded_block_index = block_index;
+      }
+
+      const auto is_null = _column->null_values()[chunk_offsets.into_referenced];
+      const auto value = _block_values[chunk_offsets.into_referenced % block_size];
+
+      return ColumnIteratorValue<T>{value, is_null, chunk_offsets.into_referencing};
+    }
+
+   private:
+    const DeltaColumn<T>* _column;
+    mutable size_t _decoded_block_index = INVALID_BLOCK_INDEX;
+    mutable std::array<T, block_size> _block_values{};
+
+    static constexpr auto INVALID_BLOCK_INDEX = std::numeric_limits<size_t>::max();
+  };
+};
+
+}  // namespace opossum
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "storage/base_column_encoder.hpp"
+
+#include "storage/delta_column.hpp"
+#include "storage/value_column.hpp"
+#include "storage/value_column/value_column_iterable.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class DeltaEncoder : public ColumnEncoder<DeltaEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::Delta>;
+  static constexpr auto _uses_vector_compression = false;  // see base_column_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedColumn> _on_encode(const std::shared_ptr<const ValueColumn<T>>& value_column) {
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    const auto alloc = value_column->values().get_allocator();
+
+    static constexpr auto block_size = DeltaColumn<T>::block_size;
+    static_assert(block_size == SimdBp128Packing::block_size, "Each block is packed as one SIMD-BP128 block.");
+
+    const auto size = value_column->size();
+
+    // Ceiling of integer division
+    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+
+    const auto num_blocks = div_ceil(size, block_size);
+
+    auto block_first_values = pmr_vector<T>{alloc};
+    block_first_values.reserve(num_blocks);
+
+    auto block_min_deltas = pmr_vector<T>{alloc};
+    block_min_deltas.reserve(num_blocks);
+
+    auto block_bit_sizes = pmr_vector<uint8_t>{alloc};
+    block_bit_sizes.reserve(num_blocks);
+
+    auto packed_deltas = pmr_vector<uint128_t>{alloc};
+
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // Null values repeat the preceding value, so that they do not increase the deltas. Leading null values repeat the
+    // first value that is not null.
+    auto previous_value = T{0};
+
+    auto iterable = ValueColumnIterable<T>{*value_column};
+    iterable.with_iterators([&](auto column_it, auto column_end) {
+      const auto first_value_it =
+          std::find_if(column_it, column_end, [](const auto& column_value) { return !column_value.is_null(); });
+      if (first_value_it != column_end) previous_value = (*first_value_it).value();
+    });
+
+    iterable.with_iterators([&](auto column_it, auto column_end) {
+      // temporary storage to hold the values and the deltas of one block
+      auto current_value_block = std::array<T, block_size>{};
+      auto current_delta_block = std::array<uint32_t, block_size>{};
+
+      while (column_it != column_end) {
+        auto block_value_count = size_t{0u};
+        for (; block_value_count < block_size && column_it != column_end; ++block_value_count, ++column_it) {
+          const auto column_value = *column_it;
+
+          if (!column_value.is_null()) previous_value = column_value.value();
+          current_value_block[block_value_count] = previous_value;
+          null_values.push_back(column_value.is_null());
+        }
+
+        // Deltas are calculated modulo 2^n so that they cannot overflow. The minimum delta is determined on their
+        // signed interpretation, which allows decreasing values in nearly sorted columns.
+        auto min_delta = T{0};
+        for (auto index = size_t{1u}; index < block_value_count; ++index) {
+          const auto delta = static_cast<T>(static_cast<UnsignedT>(current_value_block[index]) -
+                                            static_cast<UnsignedT>(current_value_block[index - 1]));
+          min_delta = index == 1u ? delta : std::min(min_delta, delta);
+        }
+
+        // The first delta and the deltas of the unused positions of the last block are zero
+        current_delta_block.fill(0u);
+        auto max_delta = uint32_t{0u};
+
+        for (auto index = size_t{1u}; index < block_value_count; ++index) {
+          const auto reduced_delta =
+              static_cast<UnsignedT>(static_cast<UnsignedT>(current_value_block[index]) -
+                                     static_cast<UnsignedT>(current_value_block[index - 1]) -
+                                     static_cast<UnsignedT>(min_delta));
+
+          // Make sure that the reduced delta fits into uint32_t (required for bit-packing.)
+          Assert(static_cast<uint64_t>(reduced_delta) <= std::numeric_limits<uint32_t>::max(),
+                 "Deltas within a block must not differ by more than 2^32 - 1.");
+
+          current_delta_block[index] = static_cast<uint32_t>(reduced_delta);
+          max_delta = std::max(max_delta, current_delta_block[index]);
+        }
+
+        auto bit_size = uint8_t{0u};
+        while (bit_size < 32u && (max_delta >> bit_size) != 0u) ++bit_size;
+
+        block_first_values.push_back(current_value_block[0]);
+        block_min_deltas.push_back(min_delta);
+        block_bit_sizes.push_back(bit_size);
+
+        // A block packed with bit size n occupies n 128-bit words
+        const auto packed_offset = packed_deltas.size();
+        packed_deltas.resize(packed_offset + bit_size);
+        SimdBp128Packing::pack_block(current_delta_block.data(), packed_deltas.data() + packed_offset, bit_size);
+      }
+    });
+
+    return std::allocate_shared<DeltaColumn<T>>(alloc, std::move(block_first_values), std::move(block_min_deltas),
+                                                std::move(block_bit_sizes), std::move(packed_deltas),
+                                                std::move(null_values));
+  }
+};
+
+}  // namespace opossum
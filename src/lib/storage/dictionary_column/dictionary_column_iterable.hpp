@@ -6,6 +6,7 @@
 
 #include "storage/dictionary_column.hpp"
 #include "storage/fixed_string_dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
@@ -20,6 +21,9 @@ class DictionaryColumnIterable : public PointAccessibleColumnIterable<Dictionary
   explicit DictionaryColumnIterable(const FixedStringDictionaryColumn<std::string>& column)
       : _column{column}, _dictionary(column.fixed_string_dictionary()) {}
 
+  explicit DictionaryColumnIterable(const FrontCodedDictionaryColumn<std::string>& column)
+      : _column{column}, _dictionary(column.front_coded_dictionary()) {}
+
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
     resolve_compressed_vector_type(*_column.attribute_vector(), [&](const auto& vector) {
@@ -79,10 +83,10 @@ class DictionaryColumnIterable : public PointAccessibleColumnIterable<Dictionary
 
       if (is_null) return ColumnIteratorValue<T>{T{}, true, _chunk_offset};
 
-      if constexpr (std::is_same<Dictionary, FixedStringVector>::value) {
-        return ColumnIteratorValue<T>{_dictionary.get_string_at(value_id), false, _chunk_offset};
-      } else {
+      if constexpr (std::is_same<Dictionary, pmr_vector<T>>::value) {
         return ColumnIteratorValue<T>{_dictionary[value_id], false, _chunk_offset};
+      } else {
+        return ColumnIteratorValue<T>{_dictionary.get_string_at(value_id), false, _chunk_offset};
       }
     }
 
@@ -115,10 +119,10 @@ class DictionaryColumnIterable : public PointAccessibleColumnIterable<Dictionary
 
       if (is_null) return ColumnIteratorValue<T>{T{}, true, chunk_offsets.into_referencing};
 
-      if constexpr (std::is_same<Dictionary, FixedStringVector>::value) {
-        return ColumnIteratorValue<T>{_dictionary.get_string_at(value_id), false, chunk_offsets.into_referencing};
-      } else {
+      if constexpr (std::is_same<Dictionary, pmr_vector<T>>::value) {
         return ColumnIteratorValue<T>{_dictionary[value_id], false, chunk_offsets.into_referencing};
+      } else {
+        return ColumnIteratorValue<T>{_dictionary.get_string_at(value_id), false, chunk_offsets.into_referencing};
       }
     }
 
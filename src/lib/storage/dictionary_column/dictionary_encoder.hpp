@@ -8,6 +8,7 @@
 
 #include "storage/dictionary_column.hpp"
 #include "storage/fixed_string_dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 #include "storage/value_column.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
@@ -41,7 +42,8 @@ class DictionaryEncoder : public ColumnEncoder<DictionaryEncoder<Encoding>> {
           FixedStringVector{values.cbegin(), values.cend(), _calculate_fixed_string_length(values), values.size()},
           value_column);
     } else {
-      // Encode a column with a pmr_vector<T> as dictionary
+      // Encode a column with a pmr_vector<T> as dictionary. For FrontCodedDictionary, it is front-coded once it is
+      // sorted, see below.
       return _encode_dictionary_column(pmr_vector<T>{values.cbegin(), values.cend(), values.get_allocator()},
                                        value_column);
     }
@@ -117,13 +119,18 @@ class DictionaryEncoder : public ColumnEncoder<DictionaryEncoder<Encoding>> {
 
     auto encoded_attribute_vector = compress_vector(
         attribute_vector, ColumnEncoder<DictionaryEncoder<Encoding>>::vector_compression_type(), alloc, {max_value});
-    auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
     auto attribute_vector_sptr = std::shared_ptr<const BaseCompressedVector>(std::move(encoded_attribute_vector));
 
-    if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+    if constexpr (Encoding == EncodingType::FrontCodedDictionary) {
+      auto dictionary_sptr = std::allocate_shared<FrontCodedStringVector>(alloc, dictionary, alloc);
+      return std::allocate_shared<FrontCodedDictionaryColumn<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
+                                                                 ValueID{null_value_id});
+    } else if constexpr (Encoding == EncodingType::FixedStringDictionary) {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<FixedStringDictionaryColumn<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                                   ValueID{null_value_id});
     } else {
+      auto dictionary_sptr = std::allocate_shared<U>(alloc, std::move(dictionary));
       return std::allocate_shared<DictionaryColumn<T>>(alloc, dictionary_sptr, attribute_vector_sptr,
                                                        ValueID{null_value_id});
     }
@@ -0,0 +1,218 @@
+#include "encoding_selector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_value_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/delta_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+float average_run_length(const ValueColumn<T>& column) {
+  const auto& values = column.values();
+  const auto is_null = [&](const size_t index) { return column.is_nullable() && column.null_values()[index]; };
+
+  auto run_count = size_t{1u};
+  for (auto index = size_t{1u}; index < values.size(); ++index) {
+    const auto null_changes = is_null(index) != is_null(index - 1);
+    if (null_changes || (!is_null(index) && values[index] != values[index - 1])) ++run_count;
+  }
+
+  return static_cast<float>(values.size()) / static_cast<float>(run_count);
+}
+
+template <typename T>
+std::vector<T> sample_values(const ValueColumn<T>& column) {
+  const auto& values = column.values();
+  const auto stride = std::max(size_t{1u}, values.size() / EncodingSelector::SAMPLE_SIZE);
+
+  auto sample = std::vector<T>{};
+  for (auto index = size_t{0u}; index < values.size(); index += stride) {
+    if (column.is_nullable() && column.null_values()[index]) continue;
+    sample.push_back(values[index]);
+  }
+  return sample;
+}
+
+// Mirrors the FrameOfReferenceEncoder, which encodes NULLs as zero and requires the offsets to fit into uint32_t
+template <typename T>
+bool block_ranges_fit_into_uint32(const ValueColumn<T>& column) {
+  using UnsignedT = std::make_unsigned_t<T>;
+  static constexpr auto block_size = FrameOfReferenceColumn<T>::block_size;
+
+  const auto& values = column.values();
+  for (auto block_begin = size_t{0u}; block_begin < values.size(); block_begin += block_size) {
+    const auto block_end = std::min(block_begin + block_size, values.size());
+
+    auto minimum = std::numeric_limits<T>::max();
+    auto maximum = std::numeric_limits<T>::min();
+    for (auto index = block_begin; index < block_end; ++index) {
+      const auto value = column.is_nullable() && column.null_values()[index] ? T{0} : values[index];
+      minimum = std::min(minimum, value);
+      maximum = std::max(maximum, value);
+    }
+
+    const auto range = static_cast<UnsignedT>(static_cast<UnsignedT>(maximum) - static_cast<UnsignedT>(minimum));
+    if (static_cast<uint64_t>(range) > std::numeric_limits<uint32_t>::max()) return false;
+  }
+  return true;
+}
+
+// Fraction of values that are not smaller than their preceding value, ignoring NULLs
+template <typename T>
+float sorted_fraction(const ValueColumn<T>& column) {
+  const auto& values = column.values();
+
+  auto previous_value = std::optional<T>{};
+  auto comparison_count = size_t{0u};
+  auto sorted_count = size_t{0u};
+  for (auto index = size_t{0u}; index < values.size(); ++index) {
+    if (column.is_nullable() && column.null_values()[index]) continue;
+
+    if (previous_value) {
+      ++comparison_count;
+      if (values[index] >= *previous_value) ++sorted_count;
+    }
+    previous_value = values[index];
+  }
+
+  return comparison_count == 0u ? 1.0f : static_cast<float>(sorted_count) / static_cast<float>(comparison_count);
+}
+
+// Mirrors the DeltaEncoder, which requires the deltas of each block, reduced by their minimum, to fit into uint32_t
+template <typename T>
+bool delta_ranges_fit_into_uint32(const ValueColumn<T>& column) {
+  using UnsignedT = std::make_unsigned_t<T>;
+  static constexpr auto block_size = DeltaColumn<T>::block_size;
+
+  // Within 32 bits, the deltas are calculated modulo 2^32 and always fit
+  if constexpr (sizeof(T) <= sizeof(uint32_t)) return true;
+
+  const auto& values = column.values();
+  const auto is_null = [&](const size_t index) { return column.is_nullable() && column.null_values()[index]; };
+
+  // NULLs repeat the preceding value, leading NULLs the first value that is not null
+  auto previous_value = T{0};
+  for (auto index = size_t{0u}; index < values.size(); ++index) {
+    if (is_null(index)) continue;
+    previous_value = values[index];
+    break;
+  }
+
+  for (auto block_begin = size_t{0u}; block_begin < values.size(); block_begin += block_size) {
+    const auto block_end = std::min(block_begin + block_size, values.size());
+
+    auto min_delta = std::numeric_limits<T>::max();
+    auto max_delta = std::numeric_limits<T>::min();
+    for (auto index = block_begin; index < block_end; ++index) {
+      const auto value = is_null(index) ? previous_value : values[index];
+      if (index > block_begin) {
+        const auto delta = static_cast<T>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(previous_value));
+        min_delta = std::min(min_delta, delta);
+        max_delta = std::max(max_delta, delta);
+      }
+      previous_value = value;
+    }
+
+    if (block_end - block_begin < 2u) continue;
+
+    const auto range = static_cast<UnsignedT>(static_cast<UnsignedT>(max_delta) - static_cast<UnsignedT>(min_delta));
+    if (static_cast<uint64_t>(range) > std::numeric_limits<uint32_t>::max()) return false;
+  }
+  return true;
+}
+
+template <typename T>
+EncodingType select_encoding_type(const ValueColumn<T>& column) {
+  if (column.size() == 0) return EncodingType::Dictionary;
+
+  if (average_run_length(column) >= EncodingSelector::MIN_AVERAGE_RUN_LENGTH) return EncodingType::RunLength;
+
+  const auto sample = sample_values(column);
+  const auto distinct_values = std::unordered_set<T>{sample.cbegin(), sample.cend()};
+
+  if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    if (sorted_fraction(column) >= EncodingSelector::MIN_SORTED_FRACTION_FOR_DELTA &&
+        delta_ranges_fit_into_uint32(column)) {
+      return EncodingType::Delta;
+    }
+
+    const auto distinct_fraction =
+        sample.empty() ? 0.0f : static_cast<float>(distinct_values.size()) / static_cast<float>(sample.size());
+
+    if (distinct_fraction >= EncodingSelector::MIN_DISTINCT_FRACTION_FOR_FRAME_OF_REFERENCE &&
+        block_ranges_fit_into_uint32(column)) {
+      return EncodingType::FrameOfReference;
+    }
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    // The FixedStringDictionaryColumn pads all strings to the length of the longest one
+    auto max_length = size_t{0u};
+    for (const auto& value : column.values()) max_length = std::max(max_length, value.size());
+
+    auto total_length = size_t{0u};
+    for (const auto& value : distinct_values) total_length += value.size();
+
+    const auto average_length =
+        distinct_values.empty() ? 0.0f : static_cast<float>(total_length) / static_cast<float>(distinct_values.size());
+
+    if (average_length >= EncodingSelector::MIN_LENGTH_FRACTION_FOR_FIXED_STRING_DICTIONARY * max_length) {
+      return EncodingType::FixedStringDictionary;
+    }
+
+    if (average_length >= EncodingSelector::MIN_AVERAGE_LENGTH_FOR_FRONT_CODED_DICTIONARY) {
+      return EncodingType::FrontCodedDictionary;
+    }
+  }
+
+  return EncodingType::Dictionary;
+}
+
+}  // namespace
+
+ColumnEncodingSpec EncodingSelector::select_column_encoding(const DataType data_type, const BaseValueColumn& column,
+                                                            const bool is_frequently_accessed) {
+  auto encoding_type = EncodingType::Dictionary;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    encoding_type = select_encoding_type(static_cast<const ValueColumn<ColumnDataType>&>(column));
+  });
+
+  // RunLengthColumns and DeltaColumns do not use vector compression
+  if (encoding_type == EncodingType::RunLength || encoding_type == EncodingType::Delta) {
+    return ColumnEncodingSpec{encoding_type};
+  }
+
+  const auto vector_compression_type =
+      is_frequently_accessed ? VectorCompressionType::FixedSizeByteAligned : VectorCompressionType::SimdBp128;
+  return ColumnEncodingSpec{encoding_type, vector_compression_type};
+}
+
+ChunkEncodingSpec EncodingSelector::select_chunk_encoding(const Chunk& chunk, const std::vector<DataType>& data_types,
+                                                          const bool is_frequently_accessed) {
+  Assert(data_types.size() == chunk.column_count(), "Number of column types must match the chunk’s column count.");
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(chunk.get_column(column_id));
+    Assert(value_column, "All columns of the chunk need to be of type ValueColumn<T>");
+
+    chunk_encoding_spec.push_back(
+        select_column_encoding(data_types[column_id], *value_column, is_frequently_accessed));
+  }
+  return chunk_encoding_spec;
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseValueColumn;
+class Chunk;
+
+/**
+ * @brief Chooses the encoding of columns based on their content
+ *
+ * For each ValueColumn, the selector determines
+ *  - the average run length of its values,
+ *  - the number of distinct values among a sample of SAMPLE_SIZE evenly spaced values,
+ *  - for integers, the fraction of values that are not smaller than their predecessor and whether the value ranges
+ *    (FrameOfReference) or the delta ranges (Delta) of each block fit into 32 bits and
+ *  - for strings, the lengths of the strings.
+ *
+ * Columns with long runs are encoded with RunLength, (nearly) sorted integer columns with Delta. Other integer columns
+ * with mostly distinct values, where a dictionary does not save any space, are encoded with FrameOfReference. String
+ * columns whose strings have similar lengths are encoded with FixedStringDictionary, columns of other long strings
+ * (e.g. URLs or comments) with FrontCodedDictionary. All other columns are encoded with Dictionary.
+ *
+ * Frequently accessed chunks use FixedSizeByteAligned vectors, which are fast to decode. The vectors of other chunks
+ * are compressed more tightly with SimdBp128.
+ */
+class EncodingSelector {
+ public:
+  static constexpr auto SAMPLE_SIZE = 1'000u;
+
+  // RunLength is chosen if there are at least this many values per run on average
+  static constexpr auto MIN_AVERAGE_RUN_LENGTH = 8.0f;
+
+  // Delta is chosen if at least this fraction of the integers is not smaller than its predecessor
+  static constexpr auto MIN_SORTED_FRACTION_FOR_DELTA = 0.9f;
+
+  // FrameOfReference is chosen if at least this fraction of the sampled integers is distinct
+  static constexpr auto MIN_DISTINCT_FRACTION_FOR_FRAME_OF_REFERENCE = 0.5f;
+
+  // FixedStringDictionary is chosen if the average string is at least this fraction of the longest string's length
+  static constexpr auto MIN_LENGTH_FRACTION_FOR_FIXED_STRING_DICTIONARY = 0.75f;
+
+  // FrontCodedDictionary is chosen for strings that are at least this long on average, so that the saved per-string
+  // overhead outweighs the slower decoding
+  static constexpr auto MIN_AVERAGE_LENGTH_FOR_FRONT_CODED_DICTIONARY = 16.0f;
+
+  static ColumnEncodingSpec select_column_encoding(const DataType data_type, const BaseValueColumn& column,
+                                                   const bool is_frequently_accessed);
+
+  /**
+   * All columns of the chunk need to be of type ValueColumn<T>
+   */
+  static ChunkEncodingSpec select_chunk_encoding(const Chunk& chunk, const std::vector<DataType>& data_types,
+                                                 const bool is_frequently_accessed);
+};
+
+}  // namespace opossum
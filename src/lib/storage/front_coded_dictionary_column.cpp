@@ -0,0 +1,118 @@
+#include "front_coded_dictionary_column.hpp"
+
+#include <memory>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrontCodedDictionaryColumn<T>::FrontCodedDictionaryColumn(
+    const std::shared_ptr<const FrontCodedStringVector>& dictionary,
+    const std::shared_ptr<const BaseCompressedVector>& attribute_vector, const ValueID null_value_id)
+    : BaseDictionaryColumn(data_type_from_type<std::string>()),
+      _dictionary{dictionary},
+      _attribute_vector{attribute_vector},
+      _null_value_id{null_value_id},
+      _decoder{_attribute_vector->create_base_decoder()} {}
+
+template <typename T>
+const AllTypeVariant FrontCodedDictionaryColumn<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  const auto value_id = _decoder->get(chunk_offset);
+
+  if (value_id == _null_value_id) {
+    return NULL_VALUE;
+  }
+
+  return AllTypeVariant{std::move(_dictionary->get_string_at(value_id))};
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<std::string>> FrontCodedDictionaryColumn<T>::dictionary() const {
+  return _dictionary->dictionary();
+}
+
+template <typename T>
+std::shared_ptr<const FrontCodedStringVector> FrontCodedDictionaryColumn<T>::front_coded_dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+size_t FrontCodedDictionaryColumn<T>::size() const {
+  return _attribute_vector->size();
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> FrontCodedDictionaryColumn<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_attribute_vector_ptr = _attribute_vector->copy_using_allocator(alloc);
+  auto new_attribute_vector_sptr = std::shared_ptr<const BaseCompressedVector>(std::move(new_attribute_vector_ptr));
+  auto new_dictionary_ptr = std::allocate_shared<FrontCodedStringVector>(alloc, *_dictionary, alloc);
+  return std::allocate_shared<FrontCodedDictionaryColumn<T>>(alloc, new_dictionary_ptr, new_attribute_vector_sptr,
+                                                             _null_value_id);
+}
+
+template <typename T>
+size_t FrontCodedDictionaryColumn<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _dictionary->data_size() + _attribute_vector->data_size();
+}
+
+template <typename T>
+CompressedVectorType FrontCodedDictionaryColumn<T>::compressed_vector_type() const {
+  return _attribute_vector->type();
+}
+
+template <typename T>
+EncodingType FrontCodedDictionaryColumn<T>::encoding_type() const {
+  return EncodingType::FrontCodedDictionary;
+}
+
+template <typename T>
+ValueID FrontCodedDictionaryColumn<T>::lower_bound(const AllTypeVariant& value) const {
+  DebugAssert(!variant_is_null(value), "Null value passed.");
+
+  const auto typed_value = type_cast<std::string>(value);
+
+  const auto pos = _dictionary->lower_bound(typed_value);
+  if (pos == _dictionary->size()) return INVALID_VALUE_ID;
+  return static_cast<ValueID>(pos);
+}
+
+template <typename T>
+ValueID FrontCodedDictionaryColumn<T>::upper_bound(const AllTypeVariant& value) const {
+  DebugAssert(!variant_is_null(value), "Null value passed.");
+
+  const auto typed_value = type_cast<std::string>(value);
+
+  const auto pos = _dictionary->upper_bound(typed_value);
+  if (pos == _dictionary->size()) return INVALID_VALUE_ID;
+  return static_cast<ValueID>(pos);
+}
+
+template <typename T>
+size_t FrontCodedDictionaryColumn<T>::unique_values_count() const {
+  return _dictionary->size();
+}
+
+template <typename T>
+std::shared_ptr<const BaseCompressedVector> FrontCodedDictionaryColumn<T>::attribute_vector() const {
+  return _attribute_vector;
+}
+
+template <typename T>
+const ValueID FrontCodedDictionaryColumn<T>::null_value_id() const {
+  return _null_value_id;
+}
+
+template class FrontCodedDictionaryColumn<std::string>;
+
+}  // namespace opossum
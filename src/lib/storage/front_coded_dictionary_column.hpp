@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "base_dictionary_column.hpp"
+#include "front_coded_dictionary_column/front_coded_string_vector.hpp"
+#include "types.hpp"
+#include "vector_compression/base_compressed_vector.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Column implementing dictionary encoding for strings with a front-coded dictionary
+ *
+ * Targets long strings such as URLs or comments. Sorted strings often share
+ * prefixes with their predecessors, which front coding stores only once.
+ * The dictionary is kept in order, so that value IDs can be compared like
+ * the values. Uses vector compression schemes for its attribute vector.
+ */
+template <typename T>
+class FrontCodedDictionaryColumn : public BaseDictionaryColumn {
+ public:
+  explicit FrontCodedDictionaryColumn(const std::shared_ptr<const FrontCodedStringVector>& dictionary,
+                                      const std::shared_ptr<const BaseCompressedVector>& attribute_vector,
+                                      const ValueID null_value_id);
+
+  // returns the decoded dictionary as pmr_vector
+  std::shared_ptr<const pmr_vector<std::string>> dictionary() const;
+
+  // returns an underlying dictionary
+  std::shared_ptr<const FrontCodedStringVector> front_coded_dictionary() const;
+
+  /**
+   * @defgroup BaseColumn interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedColumn interface
+   * @{
+   */
+  CompressedVectorType compressed_vector_type() const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseDictionaryColumn interface
+   * @{
+   */
+  EncodingType encoding_type() const final;
+
+  ValueID lower_bound(const AllTypeVariant& value) const final;
+  ValueID upper_bound(const AllTypeVariant& value) const final;
+
+  size_t unique_values_count() const final;
+
+  std::shared_ptr<const BaseCompressedVector> attribute_vector() const final;
+
+  const ValueID null_value_id() const final;
+
+  /**@}*/
+
+ protected:
+  const std::shared_ptr<const FrontCodedStringVector> _dictionary;
+  const std::shared_ptr<const BaseCompressedVector> _attribute_vector;
+  const ValueID _null_value_id;
+  const std::unique_ptr<BaseVectorDecompressor> _decoder;
+};
+
+}  // namespace opossum
@@ -0,0 +1,181 @@
+#include "front_coded_string_vector.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Lengths are stored with seven bits per byte, the highest bit marks that another byte follows
+void write_length(pmr_vector<char>& chars, size_t length) {
+  while (length >= 0x80u) {
+    chars.push_back(static_cast<char>((length & 0x7Fu) | 0x80u));
+    length >>= 7u;
+  }
+  chars.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const char*& position) {
+  auto length = size_t{0u};
+  auto shift = 0u;
+  while (true) {
+    const auto byte = static_cast<uint8_t>(*position++);
+    length |= static_cast<size_t>(byte & 0x7Fu) << shift;
+    if ((byte & 0x80u) == 0u) return length;
+    shift += 7u;
+  }
+}
+
+}  // namespace
+
+FrontCodedStringVector::FrontCodedStringVector(const pmr_vector<std::string>& strings,
+                                               const PolymorphicAllocator<char>& alloc)
+    : _chars{alloc}, _block_offsets{alloc}, _size{strings.size()} {
+  _block_offsets.reserve((_size + block_size - 1u) / block_size);
+
+  for (auto index = size_t{0u}; index < _size; ++index) {
+    const auto& string = strings[index];
+
+    if (index % block_size == 0u) {
+      _block_offsets.push_back(_chars.size());
+      write_length(_chars, string.size());
+      _chars.insert(_chars.end(), string.cbegin(), string.cend());
+      continue;
+    }
+
+    const auto& previous_string = strings[index - 1];
+    DebugAssert(previous_string < string, "Strings must be sorted and unique.");
+
+    const auto max_prefix_length = std::min(previous_string.size(), string.size());
+    const auto prefix_length = static_cast<size_t>(
+        std::mismatch(string.cbegin(), string.cbegin() + max_prefix_length, previous_string.cbegin()).first -
+        string.cbegin());
+
+    write_length(_chars, prefix_length);
+    write_length(_chars, string.size() - prefix_length);
+    _chars.insert(_chars.end(), string.cbegin() + prefix_length, string.cend());
+  }
+
+  _chars.shrink_to_fit();
+}
+
+FrontCodedStringVector::FrontCodedStringVector(pmr_vector<char> chars, pmr_vector<size_t> block_offsets,
+                                               const size_t size)
+    : _chars{std::move(chars)}, _block_offsets{std::move(block_offsets)}, _size{size} {
+  Assert(_block_offsets.size() == (_size + block_size - 1u) / block_size, "Each block needs an offset.");
+  Assert(std::all_of(_block_offsets.cbegin(), _block_offsets.cend(),
+                     [&](const auto offset) { return offset < _chars.size(); }),
+         "Block offsets must point into the characters.");
+}
+
+FrontCodedStringVector::FrontCodedStringVector(const FrontCodedStringVector& other,
+                                               const PolymorphicAllocator<char>& alloc)
+    : _chars{other._chars, alloc}, _block_offsets{other._block_offsets, alloc}, _size{other._size} {}
+
+template <typename Functor>
+void FrontCodedStringVector::_decode_block(const size_t block_index, const Functor& functor) const {
+  const auto block_begin = block_index * block_size;
+  const auto block_end = std::min(block_begin + block_size, _size);
+
+  const auto* position = _chars.data() + _block_offsets[block_index];
+  auto string = std::string{};
+
+  for (auto index = block_begin; index < block_end; ++index) {
+    if (index == block_begin) {
+      const auto length = read_length(position);
+      string.assign(position, length);
+      position += length;
+    } else {
+      const auto prefix_length = read_length(position);
+      const auto suffix_length = read_length(position);
+      string.resize(prefix_length);
+      string.append(position, suffix_length);
+      position += suffix_length;
+    }
+
+    if (!functor(index, std::as_const(string))) return;
+  }
+}
+
+template <typename Predicate>
+size_t FrontCodedStringVector::_partition_point(const Predicate& is_greater_than_value) const {
+  // The first string of each block is stored completely and can be compared without decoding
+  const auto first_string_of_block = [&](const size_t block_index) {
+    const auto* position = _chars.data() + _block_offsets[block_index];
+    const auto length = read_length(position);
+    return std::string_view{position, length};
+  };
+
+  // Find the first block whose first string is greater than the value, the result lies in the block before it
+  auto block_low = size_t{0u};
+  auto block_high = _block_offsets.size();
+  while (block_low < block_high) {
+    const auto block_middle = block_low + (block_high - block_low) / 2u;
+    if (is_greater_than_value(first_string_of_block(block_middle))) {
+      block_high = block_middle;
+    } else {
+      block_low = block_middle + 1u;
+    }
+  }
+
+  if (block_low == 0u) return 0u;
+
+  auto result = std::min(block_low * block_size, _size);
+  _decode_block(block_low - 1u, [&](const size_t pos, const std::string& string) {
+    if (!is_greater_than_value(std::string_view{string})) return true;
+    result = pos;
+    return false;
+  });
+  return result;
+}
+
+std::string FrontCodedStringVector::get_string_at(const size_t pos) const {
+  DebugAssert(pos < _size, "Passed position must be valid.");
+
+  auto result = std::string{};
+  _decode_block(pos / block_size, [&](const size_t index, const std::string& string) {
+    if (index < pos) return true;
+    result = string;
+    return false;
+  });
+  return result;
+}
+
+size_t FrontCodedStringVector::lower_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view string) { return string >= value; });
+}
+
+size_t FrontCodedStringVector::upper_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view string) { return string > value; });
+}
+
+size_t FrontCodedStringVector::size() const { return _size; }
+
+const pmr_vector<char>& FrontCodedStringVector::chars() const { return _chars; }
+
+const pmr_vector<size_t>& FrontCodedStringVector::block_offsets() const { return _block_offsets; }
+
+size_t FrontCodedStringVector::data_size() const {
+  return sizeof(*this) + _chars.size() + _block_offsets.size() * sizeof(size_t);
+}
+
+std::shared_ptr<const pmr_vector<std::string>> FrontCodedStringVector::dictionary() const {
+  auto strings = pmr_vector<std::string>{};
+  strings.reserve(_size);
+
+  for (auto block_index = size_t{0u}; block_index < _block_offsets.size(); ++block_index) {
+    _decode_block(block_index, [&](const size_t, const std::string& string) {
+      strings.emplace_back(string);
+      return true;
+    });
+  }
+
+  return std::make_shared<pmr_vector<std::string>>(std::move(strings));
+}
+
+}  // namespace opossum
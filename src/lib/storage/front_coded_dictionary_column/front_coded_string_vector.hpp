@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Immutable vector of sorted strings stored with front coding
+ *
+ * The strings are divided into blocks of block_size strings. The first string of each block is stored completely,
+ * each following string only as the length of the prefix it shares with its predecessor and the remaining suffix.
+ * All lengths are stored as variable-length integers (seven bits per byte), so that the strings of a block lie
+ * consecutively in one character vector without any per-string allocation.
+ *
+ * Because the order of the strings is preserved, lower_bound() and upper_bound() binary search the first strings of
+ * the blocks and then only decode a single block. Accessing a string decodes at most block_size strings.
+ */
+class FrontCodedStringVector {
+ public:
+  static constexpr auto block_size = 16u;
+
+  // Creates a FrontCodedStringVector from strings that are sorted and unique
+  FrontCodedStringVector(const pmr_vector<std::string>& strings, const PolymorphicAllocator<char>& alloc);
+
+  // Creates a FrontCodedStringVector from previously encoded data, e.g., when importing it from a file
+  FrontCodedStringVector(pmr_vector<char> chars, pmr_vector<size_t> block_offsets, const size_t size);
+
+  FrontCodedStringVector(const FrontCodedStringVector& other, const PolymorphicAllocator<char>& alloc);
+
+  std::string get_string_at(const size_t pos) const;
+
+  // Returns the position of the first string >= value, or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+
+  // Returns the position of the first string > value, or size() if there is none
+  size_t upper_bound(const std::string_view value) const;
+
+  // Return the number of strings
+  size_t size() const;
+
+  const pmr_vector<char>& chars() const;
+
+  // Returns the index of each block's first character in chars()
+  const pmr_vector<size_t>& block_offsets() const;
+
+  // Return the calculated size of FrontCodedStringVector in main memory
+  size_t data_size() const;
+
+  // Return the decoded strings as a vector of string
+  std::shared_ptr<const pmr_vector<std::string>> dictionary() const;
+
+ protected:
+  // Returns the position of the first string for which is_greater_than_value returns true
+  template <typename Predicate>
+  size_t _partition_point(const Predicate& is_greater_than_value) const;
+
+  // Decodes the strings of a block in order, calling functor(pos, string) for each of them until it returns false
+  template <typename Functor>
+  void _decode_block(const size_t block_index, const Functor& functor) const;
+
+  pmr_vector<char> _chars;
+  pmr_vector<size_t> _block_offsets;
+  const size_t _size;
+};
+
+}  // namespace opossum
@@ -1,46 +1,124 @@
 #include "adaptive_radix_tree_index.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "adaptive_radix_tree_nodes.hpp"
+#include "resolve_type.hpp"
 #include "storage/base_dictionary_column.hpp"
+#include "storage/create_iterable_from_column.hpp"
 #include "storage/index/base_index.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+template <typename UnsignedType>
+void append_big_endian(std::vector<uint8_t>& parts, const UnsignedType value) {
+  for (auto byte_id = sizeof(UnsignedType); byte_id > 0; --byte_id) {
+    parts.emplace_back(static_cast<uint8_t>(value >> ((byte_id - 1) * 8)));
+  }
+}
+
+// Flips the sign bit of non-negative floating point numbers and all bits of negative ones
+template <typename UnsignedType, typename FloatType>
+UnsignedType float_to_binary_comparable(FloatType value) {
+  // -0.0 and 0.0 are equal and must be encoded the same
+  if (value == FloatType{0}) value = FloatType{0};
+
+  auto bits = UnsignedType{};
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  constexpr auto sign_bit = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+  return (bits & sign_bit) ? ~bits : bits | sign_bit;
+}
+
+}  // namespace
+
 namespace opossum {
 
 AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
     : BaseIndex{get_index_type_of<AdaptiveRadixTreeIndex>()},
-      _index_column(std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())) {
-  Assert(static_cast<bool>(_index_column), "AdaptiveRadixTree only works with dictionary columns for now");
+      _index_column(index_columns.front()),
+      _dictionary_column(std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())) {
   Assert((index_columns.size() == 1), "AdaptiveRadixTree only works with a single column");
 
-  // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
-  // this value ID and its ChunkOffset (needed for bulk-inserting).
+  // For each non-NULL row, create a pair consisting of a BinaryComparable of its key and its ChunkOffset (needed for
+  // bulk-inserting).
   std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_index_column->attribute_vector()->size());
+  pairs_to_insert.reserve(_index_column->size());
 
-  resolve_compressed_vector_type(*_index_column->attribute_vector(), [&](const auto& attribute_vector) {
-    auto chunk_offset = ChunkOffset{0u};
-    auto value_id_it = attribute_vector.cbegin();
-    for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
-      pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_it}), chunk_offset);
-    }
-  });
+  if (_dictionary_column) {
+    const auto null_value_id = _dictionary_column->null_value_id();
+    resolve_compressed_vector_type(*_dictionary_column->attribute_vector(), [&](const auto& attribute_vector) {
+      auto chunk_offset = ChunkOffset{0u};
+      auto value_id_it = attribute_vector.cbegin();
+      for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
+        if (*value_id_it == null_value_id) continue;
+        pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_it}), chunk_offset);
+      }
+    });
+  } else {
+    resolve_data_and_column_type(*_index_column, [&](auto type, const auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+      iterable.for_each([&](const auto& value) {
+        if (value.is_null()) return;
+        pairs_to_insert.emplace_back(BinaryComparable(value.value()), value.chunk_offset());
+      });
+    });
+  }
+
+  if (!pairs_to_insert.empty()) {
+    _root = _bulk_insert(pairs_to_insert);
+  }
+}
+
+std::pair<BaseIndex::Iterator, BaseIndex::Iterator> AdaptiveRadixTreeIndex::prefix_range(
+    const std::string& prefix) const {
+  Assert(_index_column->data_type() == DataType::String, "Prefix ranges are only supported on string columns");
+
+  const auto range_begin = lower_bound({prefix});
+
+  // The smallest string that is larger than all strings starting with the prefix is the prefix with its last character
+  // incremented, after removing all trailing characters that cannot be incremented.
+  auto upper_prefix = prefix;
+  while (!upper_prefix.empty() && static_cast<uint8_t>(upper_prefix.back()) == std::numeric_limits<uint8_t>::max()) {
+    upper_prefix.pop_back();
+  }
+  if (upper_prefix.empty()) return {range_begin, cend()};
 
-  _root = _bulk_insert(pairs_to_insert);
+  upper_prefix.back() = static_cast<char>(static_cast<uint8_t>(upper_prefix.back()) + 1);
+  return {range_begin, lower_bound({upper_prefix})};
+}
+
+AdaptiveRadixTreeIndex::BinaryComparable AdaptiveRadixTreeIndex::_to_binary_comparable(
+    const AllTypeVariant& value) const {
+  auto binary_comparable = std::optional<BinaryComparable>{};
+  resolve_data_type(_index_column->data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    binary_comparable.emplace(type_cast<ColumnDataType>(value));
+  });
+  return *binary_comparable;
 }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
   assert(values.size() == 1);
-  ValueID value_id = _index_column->lower_bound(values[0]);
+  if (!_root) return _chunk_offsets.end();
+
+  if (!_dictionary_column) return _root->lower_bound(_to_binary_comparable(values[0]), 0);
+
+  ValueID value_id = _dictionary_column->lower_bound(values[0]);
   if (value_id == INVALID_VALUE_ID) {
     return _chunk_offsets.end();
   }
@@ -49,7 +127,11 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTy
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
   assert(values.size() == 1);
-  ValueID value_id = _index_column->upper_bound(values[0]);
+  if (!_root) return _chunk_offsets.end();
+
+  if (!_dictionary_column) return _root->upper_bound(_to_binary_comparable(values[0]), 0);
+
+  ValueID value_id = _dictionary_column->upper_bound(values[0]);
   if (value_id == INVALID_VALUE_ID) {
     return _chunk_offsets.end();
   } else {
@@ -89,7 +171,7 @@ std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
 
     // "it" points to the position after the last inserted ChunkOffset --> this is the upper_bound of the leave
     auto upper = it;
-    return std::make_shared<Leaf>(lower, upper);
+    return std::make_shared<Leaf>(lower, upper, values.front().first);
   }
 
   // radix-partition on the depths-byte into 256 partitions
@@ -133,6 +215,32 @@ AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) : _par
   }
 }
 
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(int32_t value) {
+  append_big_endian(_parts, static_cast<uint32_t>(value) ^ (uint32_t{1} << 31));
+}
+
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(int64_t value) {
+  append_big_endian(_parts, static_cast<uint64_t>(value) ^ (uint64_t{1} << 63));
+}
+
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(float value) {
+  append_big_endian(_parts, float_to_binary_comparable<uint32_t>(value));
+}
+
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(double value) {
+  append_big_endian(_parts, float_to_binary_comparable<uint64_t>(value));
+}
+
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(const std::string& value) {
+  _parts.reserve(value.size() + 2);
+  for (const auto character : value) {
+    _parts.emplace_back(static_cast<uint8_t>(character));
+    if (character == '\0') _parts.emplace_back(std::numeric_limits<uint8_t>::max());
+  }
+  _parts.emplace_back(0u);
+  _parts.emplace_back(0u);
+}
+
 size_t AdaptiveRadixTreeIndex::BinaryComparable::size() const { return _parts.size(); }
 
 uint8_t AdaptiveRadixTreeIndex::BinaryComparable::operator[](size_t position) const {
@@ -150,4 +258,13 @@ bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
   return true;
 }
 
+bool operator<(const AdaptiveRadixTreeIndex::BinaryComparable& left,
+               const AdaptiveRadixTreeIndex::BinaryComparable& right) {
+  const auto common_size = std::min(left.size(), right.size());
+  for (size_t i = 0; i < common_size; ++i) {
+    if (left[i] != right[i]) return left[i] < right[i];
+  }
+  return left.size() < right.size();
+}
+
 }  // namespace opossum
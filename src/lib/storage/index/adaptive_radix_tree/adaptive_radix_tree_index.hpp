@@ -2,6 +2,7 @@
 
 #include <iterator>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -15,8 +16,9 @@ class ARTNode;
 class BaseDictionaryColumn;
 
 /**
- * The AdaptiveRadixTreeIndex (ART) currently works on single DictionaryColumns. Conceptually it also works on
- * ValueColumns.
+ * The AdaptiveRadixTreeIndex (ART) works on single columns. For DictionaryColumns, the keys are the value IDs of the
+ * rows. For all other columns, the keys are the raw values, encoded as binary comparable byte strings (see
+ * BinaryComparable). NULL values are not indexed.
  * The ART does not compare full keys, but only partial keys in each node: On level n, the n-th byte of the full key
  * is compared.
  * In order to store the partial keys, it uses 4 different node-types, which can hold up to 4, 16, 48 and 256 partial
@@ -51,11 +53,20 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
    *This is true for unsigned values (like the ValueID), but signed values, chars and strings have to be transformed
    *in order to fulfill this property. The BinaryComparable class works as a common interface for those values.
    *The ART compares keys byte-wise, therefore we save the bytes of a BinaryComparable in a vector.
+   *
+   *Signed integers are stored big-endian with their sign bit flipped. Floating point numbers additionally have all
+   *other bits flipped if they are negative. Strings are terminated by two zero bytes, zero bytes within the string are
+   *followed by 0xFF. Thus, no key is a prefix of another key and strings are ordered like std::string.
    */
 
   class BinaryComparable {
    public:
     explicit BinaryComparable(ValueID value);
+    explicit BinaryComparable(int32_t value);
+    explicit BinaryComparable(int64_t value);
+    explicit BinaryComparable(float value);
+    explicit BinaryComparable(double value);
+    explicit BinaryComparable(const std::string& value);
 
     size_t size() const;
 
@@ -65,7 +76,16 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
     std::vector<uint8_t> _parts;
   };
 
+  /**
+   * Returns the range of all entries of a string column that start with the given prefix, e.g., to evaluate
+   * LIKE 'prefix%'.
+   */
+  std::pair<Iterator, Iterator> prefix_range(const std::string& prefix) const;
+
  private:
+  // Encodes a search value for an index that is built over raw values
+  BinaryComparable _to_binary_comparable(const AllTypeVariant& value) const;
+
   Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
 
   Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
@@ -81,11 +101,17 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const;
 
-  const std::shared_ptr<const BaseDictionaryColumn> _index_column;
+  const std::shared_ptr<const BaseColumn> _index_column;
+
+  // Set if the index is built over the value IDs of a DictionaryColumn
+  const std::shared_ptr<const BaseDictionaryColumn> _dictionary_column;
   std::vector<ChunkOffset> _chunk_offsets;
   std::shared_ptr<ARTNode> _root;
 };
 
 bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
                 const AdaptiveRadixTreeIndex::BinaryComparable& right);
+
+bool operator<(const AdaptiveRadixTreeIndex::BinaryComparable& left,
+               const AdaptiveRadixTreeIndex::BinaryComparable& right);
 }  // namespace opossum
@@ -65,8 +65,8 @@ BaseIndex::Iterator ARTNode4::_delegate_to_child(
   auto partial_key = key[depth];
   for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
     if (_partial_keys[partial_key_id] < partial_key) continue;  // key not found yet
-    if (_partial_keys[partial_key_id] == partial_key) return function(partial_key_id, key, ++depth);  // case0
     if (_children[partial_key_id] == nullptr) return end();  // no more keys available, case1b
+    if (_partial_keys[partial_key_id] == partial_key) return function(partial_key_id, key, ++depth);  // case0
     return _children[partial_key_id]->begin();               // case2
   }
   return end();  // case1a
@@ -147,16 +147,16 @@ BaseIndex::Iterator ARTNode16::_delegate_to_child(
   auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
   auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, key, ++depth);  // case0
-  }
   if (partial_key_pos >= 16) {
     return end();  // case 1a
   }
-  if (_children[partial_key_pos] != nullptr) {
-    return _children[partial_key_pos]->begin();  // case2
+  if (_children[partial_key_pos] == nullptr) {
+    return end();  // case1b
+  }
+  if (*partial_key_iterator == partial_key) {
+    return function(partial_key_pos, key, ++depth);  // case0
   }
-  return end();  // case1b
+  return _children[partial_key_pos]->begin();  // case2
 }
 
 BaseIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
@@ -179,21 +179,17 @@ BaseIndex::Iterator ARTNode16::begin() const { return _children[0]->begin(); }
 
 /**
  * _end searches the child with the largest partial key == the last child in the _children array.
- * As the _partial_keys array is filled with 255u per default, we expect the largest child at the index right in front
- * of the first entry with 255u. But 255u can also be a valid partial_key: In this case the _children array contains a
- * pointer at this index as a means to differentiate the two cases.
+ * As the _partial_keys array is filled with 255u per default and 255u can also be a valid partial_key, the children
+ * array is used to find the last child.
  */
 
 BaseIndex::Iterator ARTNode16::end() const {
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), INVALID_INDEX);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
-  if (_children[partial_key_pos] == nullptr) {
-    // there does not exist a child with partial_key 255u, we take the partial_key in front of it
-    return _children[partial_key_pos - 1]->end();
-  } else {
-    // there exists a child with partial_key 255u
-    return _children[partial_key_pos]->end();
+  for (int8_t i = _children.size() - 1; i >= 0; --i) {
+    if (_children[i] != nullptr) {
+      return _children[i]->end();
+    }
   }
+  Fail("Empty _children array in ARTNode16 should never happen");
 }
 
 /**
@@ -287,9 +283,9 @@ BaseIndex::Iterator ARTNode48::begin() const {
 }
 
 BaseIndex::Iterator ARTNode48::end() const {
-  for (uint8_t i = _index_to_child.size() - 1; i > 0; --i) {
+  for (int16_t i = _index_to_child.size() - 1; i >= 0; --i) {
     if (_index_to_child[i] != INVALID_INDEX) {
-      return _children[_index_to_child[i]]->begin();
+      return _children[_index_to_child[i]]->end();
     }
   }
   Fail("Empty _index_to_child array in ARTNode48 should never happen");
@@ -374,17 +370,22 @@ BaseIndex::Iterator ARTNode256::begin() const {
 BaseIndex::Iterator ARTNode256::end() const {
   for (int16_t i = _children.size() - 1; i >= 0; --i) {
     if (_children[i] != nullptr) {
-      return _children[i]->begin();
+      return _children[i]->end();
     }
   }
   Fail("Empty _children array in ARTNode256 should never happen");
 }
 
-Leaf::Leaf(BaseIndex::Iterator& lower, BaseIndex::Iterator& upper) : _begin(lower), _end(upper) {}
+Leaf::Leaf(BaseIndex::Iterator& lower, BaseIndex::Iterator& upper, const AdaptiveRadixTreeIndex::BinaryComparable& key)
+    : _begin(lower), _end(upper), _key(key) {}
 
-BaseIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const { return _begin; }
+BaseIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const {
+  return _key < key ? _end : _begin;
+}
 
-BaseIndex::Iterator Leaf::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const { return _end; }
+BaseIndex::Iterator Leaf::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const {
+  return key < _key ? _begin : _end;
+}
 
 BaseIndex::Iterator Leaf::begin() const { return _begin; }
 
@@ -177,22 +177,26 @@ class ARTNode256 final : public ARTNode {
  *     eg: at ChunkOffset fe, the value is 0x00000001, not 0x00000000
  *     for the last leaf, _upper_bound = _chunk_offsets.end()
  *
- * lower_bound() nets the same as begin(), upper_bound the same as end()
+ * As a leaf may be reached before all bytes of a search key have been compared, it stores its full key. lower_bound()
+ * nets the same as begin() if the leaf's key is not smaller than the search key and the same as end() otherwise.
+ * upper_bound() nets the same as begin() if the leaf's key is larger than the search key and the same as end()
+ * otherwise.
  */
 class Leaf final : public ARTNode {
   friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
 
  public:
-  explicit Leaf(Iterator& lower, Iterator& upper);
+  explicit Leaf(Iterator& lower, Iterator& upper, const AdaptiveRadixTreeIndex::BinaryComparable& key);
 
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
+  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const override;
+  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t) const override;
   Iterator begin() const override;
   Iterator end() const override;
 
  private:
   Iterator _begin;
   Iterator _end;
+  const AdaptiveRadixTreeIndex::BinaryComparable _key;
 };
 
 }  // namespace opossum
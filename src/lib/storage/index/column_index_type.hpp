@@ -10,7 +10,8 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class ColumnIndexType : uint8_t { Invalid, GroupKey, CompositeGroupKey, AdaptiveRadixTree, BTree };
+// Table refers to a TableIndex, which covers all chunks of a table and is not created per chunk
+enum class ColumnIndexType : uint8_t { Invalid, GroupKey, CompositeGroupKey, AdaptiveRadixTree, BTree, Table };
 
 class GroupKeyIndex;
 class CompositeGroupKeyIndex;
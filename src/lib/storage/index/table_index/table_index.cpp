@@ -0,0 +1,30 @@
+#include "table_index.hpp"
+
+#include "resolve_type.hpp"
+#include "table_index_impl.hpp"
+
+namespace opossum {
+
+TableIndex::TableIndex(const DataType data_type, const ColumnID column_id)
+    : _column_id(column_id), _impl(make_shared_by_data_type<BaseTableIndexImpl, TableIndexImpl>(data_type)) {}
+
+ColumnID TableIndex::column_id() const { return _column_id; }
+
+void TableIndex::insert(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                        const ChunkOffset end_offset) {
+  _impl->insert(column, chunk_id, begin_offset, end_offset);
+}
+
+void TableIndex::erase(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                       const ChunkOffset end_offset) {
+  _impl->erase(column, chunk_id, begin_offset, end_offset);
+}
+
+PosList TableIndex::lookup(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                           const std::optional<AllTypeVariant>& search_value2) const {
+  return _impl->lookup(predicate_condition, search_value, search_value2);
+}
+
+size_t TableIndex::size() const { return _impl->size(); }
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class BaseTableIndexImpl;
+
+/**
+ * A secondary index on a single column that, unlike the chunk indexes (see BaseIndex), covers all chunks of a table.
+ * It maps each non-NULL value to the RowIDs of the rows holding it, so that a lookup does not have to visit every
+ * chunk. Once created by Table::create_table_index(), it is kept up to date by Table::append(), Table::append_chunk()
+ * and the Insert operator.
+ *
+ * Entries are added when a row is written. They are not removed when the row is deleted or the inserting transaction
+ * is rolled back, but only when the chunk is replaced (see Table::replace_chunk()). A lookup thus returns a superset
+ * of the rows visible to a transaction, just like a TableScan on a stored table does, and has to be followed by a
+ * Validate.
+ *
+ * Inserts and lookups may run concurrently. The index must not be created while rows are being inserted, though.
+ */
+class TableIndex : private Noncopyable {
+ public:
+  TableIndex(const DataType data_type, const ColumnID column_id);
+
+  ColumnID column_id() const;
+
+  // Adds the rows [begin_offset, end_offset) of the indexed column of chunk chunk_id
+  void insert(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset);
+
+  // Removes the rows [begin_offset, end_offset) of the indexed column of chunk chunk_id
+  void erase(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+             const ChunkOffset end_offset);
+
+  // Returns all indexed rows for which `value <predicate_condition> search_value` holds. For Between,
+  // `search_value <= value <= search_value2` is used. The RowIDs are ordered by value.
+  PosList lookup(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                 const std::optional<AllTypeVariant>& search_value2 = std::nullopt) const;
+
+  // Number of indexed rows
+  size_t size() const;
+
+ private:
+  const ColumnID _column_id;
+  std::shared_ptr<BaseTableIndexImpl> _impl;
+};
+
+}  // namespace opossum
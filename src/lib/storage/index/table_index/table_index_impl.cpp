@@ -0,0 +1,111 @@
+#include "table_index_impl.hpp"
+
+#include <mutex>
+
+#include "resolve_type.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename DataType>
+void TableIndexImpl<DataType>::insert(const BaseColumn& column, const ChunkID chunk_id,
+                                      const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  // Rows are usually inserted into mutable chunks, whose values can be accessed directly
+  if (const auto value_column = dynamic_cast<const ValueColumn<DataType>*>(&column)) {
+    const auto& values = value_column->values();
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      if (value_column->is_null(chunk_offset)) continue;
+      _btree.insert({values[chunk_offset], RowID{chunk_id, chunk_offset}});
+    }
+    return;
+  }
+
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    const auto value = column[chunk_offset];
+    if (variant_is_null(value)) continue;
+    _btree.insert({type_cast<DataType>(value), RowID{chunk_id, chunk_offset}});
+  }
+}
+
+template <typename DataType>
+void TableIndexImpl<DataType>::erase(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                     const ChunkOffset end_offset) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    const auto value = column[chunk_offset];
+    if (variant_is_null(value)) continue;
+
+    const auto row_id = RowID{chunk_id, chunk_offset};
+    auto range = _btree.equal_range(type_cast<DataType>(value));
+    for (; range.first != range.second; ++range.first) {
+      if (!(range.first->second == row_id)) continue;
+      _btree.erase(range.first);
+      break;
+    }
+  }
+}
+
+template <typename DataType>
+PosList TableIndexImpl<DataType>::lookup(const PredicateCondition predicate_condition,
+                                         const AllTypeVariant& search_value,
+                                         const std::optional<AllTypeVariant>& search_value2) const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  auto matches = PosList{};
+  const auto append_range = [&](auto range_begin, const auto range_end) {
+    for (; range_begin != range_end; ++range_begin) matches.emplace_back(range_begin->second);
+  };
+
+  const auto value = type_cast<DataType>(search_value);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals: {
+      const auto range = _btree.equal_range(value);
+      append_range(range.first, range.second);
+      break;
+    }
+    case PredicateCondition::NotEquals:
+      append_range(_btree.begin(), _btree.lower_bound(value));
+      append_range(_btree.upper_bound(value), _btree.end());
+      break;
+    case PredicateCondition::LessThan:
+      append_range(_btree.begin(), _btree.lower_bound(value));
+      break;
+    case PredicateCondition::LessThanEquals:
+      append_range(_btree.begin(), _btree.upper_bound(value));
+      break;
+    case PredicateCondition::GreaterThan:
+      append_range(_btree.upper_bound(value), _btree.end());
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      append_range(_btree.lower_bound(value), _btree.end());
+      break;
+    case PredicateCondition::Between: {
+      Assert(search_value2, "Between needs a second search value");
+      const auto upper_value = type_cast<DataType>(*search_value2);
+      if (upper_value < value) break;
+      append_range(_btree.lower_bound(value), _btree.upper_bound(upper_value));
+      break;
+    }
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+
+  return matches;
+}
+
+template <typename DataType>
+size_t TableIndexImpl<DataType>::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _btree.size();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableIndexImpl);
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wall"
+#include <btree_map.h>
+#pragma clang diagnostic pop
+#elif __GNUC__
+#pragma GCC system_header
+#include <btree_map.h>
+#endif
+
+#include <optional>
+#include <shared_mutex>
+
+#include "all_type_variant.hpp"
+#include "storage/base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseTableIndexImpl {
+ public:
+  BaseTableIndexImpl() = default;
+  virtual ~BaseTableIndexImpl() = default;
+
+  virtual void insert(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+  virtual void erase(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                     const ChunkOffset end_offset) = 0;
+  virtual PosList lookup(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                         const std::optional<AllTypeVariant>& search_value2) const = 0;
+  virtual size_t size() const = 0;
+};
+
+/**
+ * Implementation: https://code.google.com/archive/p/cpp-btree/
+ * The B-tree is guarded by a reader-writer lock.
+ */
+template <typename DataType>
+class TableIndexImpl : public BaseTableIndexImpl {
+ public:
+  void insert(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) override;
+  void erase(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+             const ChunkOffset end_offset) override;
+  PosList lookup(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                 const std::optional<AllTypeVariant>& search_value2) const override;
+  size_t size() const override;
+
+ protected:
+  btree::btree_multimap<DataType, RowID> _btree;
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "mvcc_columns.hpp"
 
+#include <algorithm>
 #include <shared_mutex>
 
 #include "utils/assert.hpp"
@@ -37,4 +38,39 @@ void MvccColumns::print(std::ostream& stream) const {
   stream << std::endl;
 }
 
+void MvccColumns::compute_summary() {
+  auto max_begin = CommitID{0};
+  auto min_end = MAX_COMMIT_ID;
+  auto invalidated = uint32_t{0};
+
+  for (const auto begin_cid : begin_cids) max_begin = std::max(max_begin, begin_cid);
+
+  for (const auto end_cid : end_cids) {
+    min_end = std::min(min_end, end_cid);
+    if (end_cid != MAX_COMMIT_ID) ++invalidated;
+  }
+
+  max_begin_cid = max_begin;
+  min_end_cid = min_end;
+  invalidated_row_count = invalidated;
+}
+
+void MvccColumns::register_invalidated_row(const CommitID end_cid) {
+  auto current_min_end_cid = min_end_cid.load();
+  while (end_cid < current_min_end_cid && !min_end_cid.compare_exchange_weak(current_min_end_cid, end_cid)) {
+  }
+
+  ++invalidated_row_count;
+}
+
+void MvccColumns::update_max_begin_cid() {
+  auto max_begin = CommitID{0};
+  for (const auto begin_cid : begin_cids) max_begin = std::max(max_begin, begin_cid);
+  max_begin_cid = max_begin;
+}
+
+bool MvccColumns::all_rows_visible(const CommitID snapshot_commit_id) const {
+  return max_begin_cid <= snapshot_commit_id && snapshot_commit_id < min_end_cid;
+}
+
 }  // namespace opossum
@@ -43,6 +43,31 @@ struct MvccColumns {
 
   void print(std::ostream& stream = std::cout) const;
 
+  /**
+   * @defgroup Summary of the visibility information, allows Validate to skip chunks in which all rows are visible
+   *
+   * The summary is computed by compute_summary() once the chunk is marked immutable, because no rows are added to it
+   * afterwards. Until then, max_begin_cid is MAX_COMMIT_ID and the summary does not claim anything. Operators that
+   * invalidate rows (Delete and the rollback of Insert) keep it up to date by calling register_invalidated_row().
+   * If rows were still uncommitted when the summary was computed, Insert calls update_max_begin_cid() once it has
+   * committed or rolled them back.
+   * @{
+   */
+  std::atomic<CommitID> max_begin_cid{MAX_COMMIT_ID};  ///< largest begin_cid of all rows
+  std::atomic<CommitID> min_end_cid{MAX_COMMIT_ID};    ///< smallest end_cid of all rows
+  std::atomic<uint32_t> invalidated_row_count{0};      ///< number of rows with an end_cid
+
+  void compute_summary();
+
+  void register_invalidated_row(const CommitID end_cid);
+
+  // Recomputes max_begin_cid. Uncommitted rows keep it at MAX_COMMIT_ID, so that concurrent updates are safe.
+  void update_max_begin_cid();
+
+  // Returns true if all rows have been inserted before and none have been invalidated before snapshot_commit_id
+  bool all_rows_visible(const CommitID snapshot_commit_id) const;
+  /**@}*/
+
  private:
   /**
    * @brief Mutex used to manage access to MVCC columns
@@ -8,9 +8,11 @@
 #include <memory>
 
 // Include your encoded column file here!
+#include "storage/delta_column.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/fixed_string_dictionary_column.hpp"
 #include "storage/frame_of_reference_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 #include "storage/run_length_column.hpp"
 
 #include "storage/encoding_type.hpp"
@@ -31,7 +33,9 @@ constexpr auto encoded_column_for_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::Dictionary>, template_c<DictionaryColumn>),
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, template_c<RunLengthColumn>),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, template_c<FixedStringDictionaryColumn>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, template_c<FrameOfReferenceColumn>));
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, template_c<FrameOfReferenceColumn>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Delta>, template_c<DeltaColumn>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrontCodedDictionary>, template_c<FrontCodedDictionaryColumn>));
 
 /**
  * @brief Resolves the type of an encoded column.
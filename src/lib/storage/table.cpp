@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "storage/index/table_index/table_index.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_column.hpp"
@@ -91,6 +92,11 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   _chunks.back()->append(values);
+
+  if (!_table_indexes.empty()) {
+    const auto chunk_offset = static_cast<ChunkOffset>(_chunks.back()->size() - 1);
+    _add_to_table_indexes(static_cast<ChunkID>(_chunks.size() - 1), chunk_offset, chunk_offset + 1);
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -122,22 +128,25 @@ uint32_t Table::max_chunk_size() const { return _max_chunk_size; }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  // Chunks of data tables may be replaced concurrently, see replace_chunk()
+  if (_type == TableType::Data) return std::atomic_load(&_chunks[chunk_id]);
   return _chunks[chunk_id];
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  if (_type == TableType::Data) return std::atomic_load(&_chunks[chunk_id]);
   return _chunks[chunk_id];
 }
 
 ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(get_chunk(chunk_id));
 }
 
 const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(_type == TableType::Data ? std::atomic_load(&_chunks[chunk_id]) : _chunks[chunk_id]);
 }
 
 void Table::append_chunk(const ChunkColumns& columns, const std::optional<PolymorphicAllocator<Chunk>>& alloc,
@@ -166,6 +175,10 @@ void Table::append_chunk(const ChunkColumns& columns, const std::optional<Polymo
   }
 
   _chunks.emplace_back(std::make_shared<Chunk>(columns, mvcc_columns, alloc, access_counter));
+
+  if (!_table_indexes.empty()) {
+    _add_to_table_indexes(static_cast<ChunkID>(_chunks.size() - 1), ChunkOffset{0}, chunk_size);
+  }
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
@@ -187,12 +200,67 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
               "Chunk does not have the same MVCC setting as the table.");
 
   _chunks.emplace_back(chunk);
+
+  if (!_table_indexes.empty()) {
+    _add_to_table_indexes(static_cast<ChunkID>(_chunks.size() - 1), ChunkOffset{0}, chunk->size());
+  }
+}
+
+void Table::replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk) {
+  Assert(_type == TableType::Data, "Only chunks of data tables can be replaced");
+  Assert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  Assert(chunk->column_count() == column_count(), "Chunk has the wrong number of columns");
+  Assert(chunk->has_mvcc_columns() == (_use_mvcc == UseMvcc::Yes), "Chunk does not match the MVCC setting");
+
+  // Chunks must not be appended concurrently, as that might reallocate _chunks
+  const auto append_lock = acquire_append_mutex();
+  const auto old_chunk = get_chunk(chunk_id);
+  Assert(chunk->size() == old_chunk->size(), "Chunk must have the same size as the chunk it replaces");
+
+  // The old rows are removed from the TableIndexes first, so that lookups never return the replaced values
+  for (const auto& table_index : _table_indexes) {
+    table_index->erase(*old_chunk->get_column(table_index->column_id()), chunk_id, ChunkOffset{0}, old_chunk->size());
+  }
+
+  std::atomic_store(&_chunks[chunk_id], chunk);
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
 std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 
+std::shared_ptr<TableIndex> Table::create_table_index(const ColumnID column_id, const std::string& name) {
+  Assert(_type == TableType::Data, "TableIndexes can only be created on data tables");
+  Assert(column_id < column_count(), "ColumnID out of range");
+  Assert(!get_table_index(column_id), "There already is a TableIndex on this column");
+
+  const auto table_index = std::make_shared<TableIndex>(column_data_type(column_id), column_id);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+    table_index->insert(*_chunks[chunk_id]->get_column(column_id), chunk_id, ChunkOffset{0}, _chunks[chunk_id]->size());
+  }
+
+  _table_indexes.emplace_back(table_index);
+  _indexes.emplace_back(IndexInfo{{column_id}, name, ColumnIndexType::Table});
+
+  return table_index;
+}
+
+std::shared_ptr<TableIndex> Table::get_table_index(const ColumnID column_id) const {
+  const auto iter = std::find_if(_table_indexes.begin(), _table_indexes.end(),
+                                 [&](const auto& table_index) { return table_index->column_id() == column_id; });
+  return iter != _table_indexes.end() ? *iter : nullptr;
+}
+
+const std::vector<std::shared_ptr<TableIndex>>& Table::table_indexes() const { return _table_indexes; }
+
+void Table::_add_to_table_indexes(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                  const ChunkOffset end_offset) {
+  const auto& chunk = *_chunks[chunk_id];
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(*chunk.get_column(table_index->column_id()), chunk_id, begin_offset, end_offset);
+  }
+}
+
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -18,6 +18,7 @@
 
 namespace opossum {
 
+class TableIndex;
 class TableStatistics;
 
 /**
@@ -104,6 +105,15 @@ class Table : private Noncopyable {
   // Create and append a Chunk consisting of ValueColumns.
   void append_mutable_chunk();
 
+  /**
+   * Atomically replaces the chunk with the given id by a chunk of the same size whose rows are invisible to all
+   * transactions, e.g., once the rows have been garbage collected. The size must not change, as ReferenceColumns,
+   * indexes, and Validate still address the old rows by their ChunkOffset. The old rows are removed from the
+   * TableIndexes and the new ones are not added. Only supported for data tables, for which get_chunk() loads the chunk
+   * atomically.
+   */
+  void replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk);
+
   /** @} */
 
   /**
@@ -158,6 +168,17 @@ class Table : private Noncopyable {
     _indexes.emplace_back(i);
   }
 
+  /**
+   * Creates a TableIndex on the given column that covers the rows of all chunks, including the ones added later.
+   * It is registered in get_indexes() with the type ColumnIndexType::Table.
+   */
+  std::shared_ptr<TableIndex> create_table_index(const ColumnID column_id, const std::string& name = "");
+
+  // Returns the TableIndex on the given column or nullptr if there is none
+  std::shared_ptr<TableIndex> get_table_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<TableIndex>>& table_indexes() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Columns)
    */
@@ -172,5 +193,10 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  std::vector<std::shared_ptr<TableIndex>> _table_indexes;
+
+ private:
+  // Adds the rows [begin_offset, end_offset) of the given chunk to all TableIndexes
+  void _add_to_table_indexes(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset);
 };
 }  // namespace opossum
@@ -8,6 +8,7 @@ using simd_type = unsigned int __attribute__((vector_size(16)));
 #endif
 
 #include <algorithm>
+#include <array>
 
 #include "utils/assert.hpp"
 
@@ -102,10 +103,14 @@ struct Pack128Bit<bit_size, carry_over, 0u> {
 
 /**
  * @brief Unpacks 128 unsigned integers with the specified bit size
+ *
+ * Each register of four unpacked integers is passed to the sink, which either stores it (StoreSink) or evaluates
+ * a predicate on it (ScanSink).
  */
 template <uint8_t bit_size, uint8_t carry_over = 0u, uint8_t remaining_recursions = bit_size>
 struct Unpack128Bit {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Sink>
+  void operator()(const simd_type* in, Sink& sink, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {
     constexpr auto BITS_IN_WORD = 32u;
 
@@ -116,10 +121,10 @@ struct Unpack128Bit {
       const auto offset = carry_over + i * bit_size;
 #ifdef __SSE2__
       out_reg = _mm_and_si128(_mm_srli_epi32(in_reg, offset), mask);
-      _mm_storeu_si128(out++, out_reg);
+      sink(out_reg);
 #else
       out_reg = (in_reg >> offset) & mask;
-      *out++ = out_reg;
+      sink(out_reg);
 #endif
     }
 
@@ -133,13 +138,13 @@ struct Unpack128Bit {
       in_reg = _mm_load_si128(in++);
 
       out_reg = _mm_or_si128(out_reg, _mm_and_si128(_mm_slli_epi32(in_reg, NUM_FIRST_BITS), mask));
-      _mm_storeu_si128(out++, out_reg);
+      sink(out_reg);
 #else
       out_reg = in_reg >> NEXT_OFFSET;
       in_reg = *in++;
 
       out_reg = out_reg | ((in_reg << NUM_FIRST_BITS) & mask);
-      *out++ = out_reg;
+      sink(out_reg);
 #endif
     } else {
       constexpr auto LAST_RECURSION = 1u;
@@ -156,13 +161,14 @@ struct Unpack128Bit {
 
     // Calculate the new carry over
     constexpr auto NEW_CARRY_OVER = NEXT_OFFSET < BITS_IN_WORD ? bit_size - NUM_FIRST_BITS : 0u;
-    Unpack128Bit<bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, out, in_reg, out_reg, mask);
+    Unpack128Bit<bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, sink, in_reg, out_reg, mask);
   }
 };
 
 template <uint8_t bit_size, uint8_t carry_over>
 struct Unpack128Bit<bit_size, carry_over, 0u> {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Sink>
+  void operator()(const simd_type* in, Sink& sink, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {}
 };
 
@@ -171,178 +177,219 @@ void unpack_128_zeros(uint32_t* out) {
   std::fill(out, out + NUM_ZEROES, 0u);
 }
 
-}  // namespace
+struct StoreSink {
+  void operator()(const simd_type& reg) {
+#ifdef __SSE2__
+    _mm_storeu_si128(out++, reg);
+#else
+    *out++ = reg;
+#endif
+  }
 
-void SimdBp128Packing::write_meta_info(const uint8_t* in, uint128_t* out) {
-  const auto simd_in = reinterpret_cast<const simd_type*>(in);
-  auto simd_out = reinterpret_cast<simd_type*>(out);
+  simd_type* out;
+};
 
+/**
+ * @brief Evaluates lower <= value < upper && value != excluded for each register of four unpacked integers
+ *
+ * Both bounds are checked by a single unsigned comparison: value - lower wraps around for values smaller than lower,
+ * so that the difference cannot be smaller than upper - lower. Bit i of matches is set if the i-th value qualifies.
+ */
+class ScanSink {
+ public:
+  ScanSink(const uint32_t lower, const uint32_t upper, const uint32_t excluded, std::array<uint64_t, 2>& matches)
+      : _matches{matches} {
 #ifdef __SSE2__
-  const auto meta_block_info_rgtr = _mm_loadu_si128(simd_in);
-  _mm_store_si128(simd_out, meta_block_info_rgtr);
+    // SSE2 only offers signed comparisons, flipping the sign bit of both sides turns them into unsigned ones
+    _sign_bit = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+    _lower = _mm_set1_epi32(static_cast<int32_t>(lower));
+    _biased_range = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(upper - lower)), _sign_bit);
+    _excluded = _mm_set1_epi32(static_cast<int32_t>(excluded));
 #else
-  *simd_out = *simd_in;
+    _lower = simd_type{lower, lower, lower, lower};
+    _range = simd_type{upper - lower, upper - lower, upper - lower, upper - lower};
+    _excluded = simd_type{excluded, excluded, excluded, excluded};
 #endif
-}
+    _matches = {0u, 0u};
+  }
 
-void SimdBp128Packing::read_meta_info(const uint128_t* in, uint8_t* out) {
-  const auto simd_in = reinterpret_cast<const simd_type*>(in);
-  auto simd_out = reinterpret_cast<simd_type*>(out);
+  void operator()(const simd_type& values) {
+#ifdef __SSE2__
+    const auto biased_difference = _mm_xor_si128(_mm_sub_epi32(values, _lower), _sign_bit);
+    const auto in_range = _mm_cmplt_epi32(biased_difference, _biased_range);
+    const auto qualifies = _mm_andnot_si128(_mm_cmpeq_epi32(values, _excluded), in_range);
+    const auto mask = static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(qualifies)));
+#else
+    const auto qualifies = ((values - _lower) < _range) & (values != _excluded);
+    auto mask = uint64_t{0u};
+    for (auto lane = 0u; lane < 4u; ++lane) {
+      mask |= static_cast<uint64_t>(qualifies[lane] != 0) << lane;
+    }
+#endif
+
+    _matches[_register_index / 16u] |= mask << ((_register_index % 16u) * 4u);
+    ++_register_index;
+  }
+
+ private:
+  std::array<uint64_t, 2>& _matches;
+  uint32_t _register_index = 0u;
 
 #ifdef __SSE2__
-  auto meta_info_block_rgtr = _mm_load_si128(simd_in);
-  _mm_storeu_si128(simd_out, meta_info_block_rgtr);
+  simd_type _sign_bit;
+  simd_type _lower;
+  simd_type _biased_range;
+  simd_type _excluded;
 #else
-  *simd_out = *simd_in;
+  simd_type _lower;
+  simd_type _range;
+  simd_type _excluded;
 #endif
-}
+};
 
-void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size) {
+// Unpacks a block with a bit size greater than zero into the sink
+template <typename Sink>
+void unpack_block_into_sink(const uint128_t* in, Sink& sink, const uint8_t bit_size) {
   auto simd_in = reinterpret_cast<const simd_type*>(in);
-  auto simd_out = reinterpret_cast<simd_type*>(out);
 
 #ifdef __SSE2__
-  auto in_reg = _mm_setzero_si128();
+  auto in_reg = _mm_load_si128(simd_in++);
   auto out_reg = _mm_setzero_si128();
   const auto mask = _mm_set1_epi32((1ul << bit_size) - 1);
 #else
-  simd_type in_reg = {0, 0, 0, 0};
+  simd_type in_reg = *simd_in++;
   simd_type out_reg = {0, 0, 0, 0};
   unsigned int one_mask = (1ul << bit_size) - 1;
   const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
 #endif
 
   switch (bit_size) {
-    case 0u:
-      // No compression needed, since all values equal to zero.
-      return;
-
     case 1u:
-      Pack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<1u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 2u:
-      Pack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<2u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 3u:
-      Pack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<3u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 4u:
-      Pack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<4u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 5u:
-      Pack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<5u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 6u:
-      Pack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<6u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 7u:
-      Pack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<7u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 8u:
-      Pack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<8u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 9u:
-      Pack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<9u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 10u:
-      Pack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<10u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 11u:
-      Pack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<11u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 12u:
-      Pack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<12u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 13u:
-      Pack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<13u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 14u:
-      Pack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<14u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 15u:
-      Pack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<15u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 16u:
-      Pack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<16u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 17u:
-      Pack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<17u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 18u:
-      Pack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<18u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 19u:
-      Pack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<19u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 20u:
-      Pack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<20u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 21u:
-      Pack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<21u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 22u:
-      Pack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<22u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 23u:
-      Pack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<23u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 24u:
-      Pack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<24u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 25u:
-      Pack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<25u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 26u:
-      Pack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<26u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 27u:
-      Pack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<27u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 28u:
-      Pack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<28u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 29u:
-      Pack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<29u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 30u:
-      Pack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<30u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 31u:
-      Pack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<31u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 32u:
-      Pack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<32u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     default:
@@ -351,153 +398,178 @@ void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint
   }
 }
 
-void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
-  if (bit_size == 0u) {
-    unpack_128_zeros(out);
-    return;
-  }
+}  // namespace
+
+void SimdBp128Packing::write_meta_info(const uint8_t* in, uint128_t* out) {
+  const auto simd_in = reinterpret_cast<const simd_type*>(in);
+  auto simd_out = reinterpret_cast<simd_type*>(out);
+
+#ifdef __SSE2__
+  const auto meta_block_info_rgtr = _mm_loadu_si128(simd_in);
+  _mm_store_si128(simd_out, meta_block_info_rgtr);
+#else
+  *simd_out = *simd_in;
+#endif
+}
+
+void SimdBp128Packing::read_meta_info(const uint128_t* in, uint8_t* out) {
+  const auto simd_in = reinterpret_cast<const simd_type*>(in);
+  auto simd_out = reinterpret_cast<simd_type*>(out);
+
+#ifdef __SSE2__
+  auto meta_info_block_rgtr = _mm_load_si128(simd_in);
+  _mm_storeu_si128(simd_out, meta_info_block_rgtr);
+#else
+  *simd_out = *simd_in;
+#endif
+}
 
+void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size) {
   auto simd_in = reinterpret_cast<const simd_type*>(in);
   auto simd_out = reinterpret_cast<simd_type*>(out);
 
 #ifdef __SSE2__
-  auto in_reg = _mm_load_si128(simd_in++);
+  auto in_reg = _mm_setzero_si128();
   auto out_reg = _mm_setzero_si128();
   const auto mask = _mm_set1_epi32((1ul << bit_size) - 1);
 #else
-  simd_type in_reg = *simd_in++;
+  simd_type in_reg = {0, 0, 0, 0};
   simd_type out_reg = {0, 0, 0, 0};
   unsigned int one_mask = (1ul << bit_size) - 1;
   const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
 #endif
 
   switch (bit_size) {
+    case 0u:
+      // No compression needed, since all values equal to zero.
+      return;
+
     case 1u:
-      Unpack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 2u:
-      Unpack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 3u:
-      Unpack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 4u:
-      Unpack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 5u:
-      Unpack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 6u:
-      Unpack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 7u:
-      Unpack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 8u:
-      Unpack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 9u:
-      Unpack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 10u:
-      Unpack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 11u:
-      Unpack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 12u:
-      Unpack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 13u:
-      Unpack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 14u:
-      Unpack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 15u:
-      Unpack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 16u:
-      Unpack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 17u:
-      Unpack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 18u:
-      Unpack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 19u:
-      Unpack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 20u:
-      Unpack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 21u:
-      Unpack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 22u:
-      Unpack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 23u:
-      Unpack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 24u:
-      Unpack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 25u:
-      Unpack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 26u:
-      Unpack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 27u:
-      Unpack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 28u:
-      Unpack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 29u:
-      Unpack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 30u:
-      Unpack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 31u:
-      Unpack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 32u:
-      Unpack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     default:
@@ -506,4 +578,42 @@ void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const ui
   }
 }
 
+void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  if (bit_size == 0u) {
+    unpack_128_zeros(out);
+    return;
+  }
+
+  auto sink = StoreSink{reinterpret_cast<simd_type*>(out)};
+  unpack_block_into_sink(in, sink, bit_size);
+}
+
+void SimdBp128Packing::scan_block(const uint128_t* in, const uint8_t bit_size, const uint32_t lower,
+                                  const uint32_t upper, const uint32_t excluded, std::array<uint64_t, 2>& matches) {
+  static constexpr auto NO_MATCHES = std::array<uint64_t, 2>{0u, 0u};
+  static constexpr auto ALL_MATCHES = std::array<uint64_t, 2>{~uint64_t{0u}, ~uint64_t{0u}};
+
+  if (bit_size == 0u) {
+    matches = (lower == 0u && upper > 0u && excluded != 0u) ? ALL_MATCHES : NO_MATCHES;
+    return;
+  }
+
+  // All values of the block lie within [0, max_value]. If the predicate's range does not overlap with it or covers it
+  // entirely, the block does not need to be unpacked.
+  const auto max_value = (uint64_t{1u} << bit_size) - 1u;
+
+  if (lower >= upper || lower > max_value) {
+    matches = NO_MATCHES;
+    return;
+  }
+
+  if (lower == 0u && upper > max_value && excluded > max_value) {
+    matches = ALL_MATCHES;
+    return;
+  }
+
+  auto sink = ScanSink{lower, upper, excluded, matches};
+  unpack_block_into_sink(in, sink, bit_size);
+}
+
 }  // namespace opossum
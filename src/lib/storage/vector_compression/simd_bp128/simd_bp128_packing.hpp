@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 
 #include "oversized_types.hpp"
@@ -26,6 +27,16 @@ class SimdBp128Packing {
 
   static void pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size);
   static void unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+
+  /**
+   * @brief Evaluates lower <= value < upper && value != excluded for a packed block of 128 integers
+   *
+   * The integers are compared in SIMD registers while they are unpacked and are never written to memory. Bit i of
+   * matches[i / 64] is set if the i-th integer qualifies. Depending on bit_size, the block might not need to be
+   * unpacked at all (e.g., if lower >= 2^bit_size).
+   */
+  static void scan_block(const uint128_t* in, const uint8_t bit_size, const uint32_t lower, const uint32_t upper,
+                         const uint32_t excluded, std::array<uint64_t, 2>& matches);
 };
 
 }  // namespace opossum
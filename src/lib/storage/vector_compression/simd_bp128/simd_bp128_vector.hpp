@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
 #include "oversized_types.hpp"
@@ -22,6 +24,8 @@ namespace opossum {
  */
 class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
  public:
+  using Packing = SimdBp128Packing;
+
   explicit SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size);
   ~SimdBp128Vector() = default;
 
@@ -38,6 +42,44 @@ class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
 
   std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
 
+  /**
+   * @brief Evaluates lower <= value < upper && value != excluded for all values without decompressing the vector
+   *
+   * Calls functor(first_index, matches) for each block of 128 values, where bit i of matches[i / 64] is set if
+   * the value at first_index + i qualifies. See SimdBp128Packing::scan_block.
+   */
+  template <typename Functor>
+  void scan_blocks(const uint32_t lower, const uint32_t upper, const uint32_t excluded, const Functor& functor) const {
+    auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+    auto matches = std::array<uint64_t, 2>{};
+    auto data_index = size_t{0u};
+
+    for (auto meta_block_first_index = size_t{0u}; meta_block_first_index < _size;
+         meta_block_first_index += Packing::meta_block_size) {
+      Packing::read_meta_info(_data.data() + data_index++, meta_info.data());
+
+      for (auto block_index = 0u; block_index < Packing::blocks_in_meta_block; ++block_index) {
+        const auto first_index = meta_block_first_index + block_index * Packing::block_size;
+        if (first_index >= _size) return;
+
+        const auto bit_size = meta_info[block_index];
+        Packing::scan_block(_data.data() + data_index, bit_size, lower, upper, excluded, matches);
+        data_index += bit_size;
+
+        // The last block is padded with zeros, which must not be reported
+        const auto value_count = _size - first_index;
+        if (value_count < 64u) {
+          matches[0] &= (uint64_t{1u} << value_count) - 1u;
+          matches[1] = 0u;
+        } else if (value_count < Packing::block_size) {
+          matches[1] &= (uint64_t{1u} << (value_count - 64u)) - 1u;
+        }
+
+        functor(first_index, matches);
+      }
+    }
+  }
+
  private:
   friend class SimdBp128Decompressor;
 
@@ -0,0 +1,164 @@
+#include "chunk_compaction_task.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkCompactionTask::ChunkCompactionTask(const std::string& table_name, const float dead_row_threshold)
+    : _table_name{table_name}, _dead_row_threshold{dead_row_threshold} {}
+
+void ChunkCompactionTask::_on_execute() {
+  // The table might have been dropped since the task was created
+  if (!StorageManager::get().has_table(_table_name)) return;
+
+  const auto table = StorageManager::get().get_table(_table_name);
+  if (table->has_mvcc() != UseMvcc::Yes) return;
+
+  for (const auto& index_info : table->get_indexes()) {
+    if (index_info.type != ColumnIndexType::Table) return;
+  }
+
+  const auto chunk_count = table->chunk_count();
+  for (ChunkID chunk_id{0}; chunk_id + 1u < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk->size() == 0 || _is_compacted(*chunk)) continue;
+
+    const auto dead_row_count =
+        _count_dead_rows(*chunk, TransactionManager::get().oldest_active_snapshot_commit_id());
+    if (!dead_row_count || *dead_row_count == 0) continue;
+
+    if (*dead_row_count < chunk->size()) {
+      if (*dead_row_count < _dead_row_threshold * chunk->size()) continue;
+
+      if (!_move_visible_rows(table, chunk_id)) continue;
+
+      // If there are no transactions older than the one that moved the rows, they are dead right away
+      const auto remaining_dead_row_count =
+          _count_dead_rows(*chunk, TransactionManager::get().oldest_active_snapshot_commit_id());
+      if (remaining_dead_row_count != chunk->size()) continue;
+    }
+
+    _replace_by_placeholder_chunk(*table, chunk_id);
+  }
+}
+
+std::optional<ChunkOffset> ChunkCompactionTask::_count_dead_rows(const Chunk& chunk,
+                                                                  const CommitID oldest_snapshot_commit_id) {
+  const auto mvcc_columns = chunk.get_scoped_mvcc_columns_lock();
+
+  auto dead_row_count = ChunkOffset{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+    // The row has not been committed yet
+    if (mvcc_columns->begin_cids[chunk_offset] == MvccColumns::MAX_COMMIT_ID) return std::nullopt;
+
+    if (mvcc_columns->end_cids[chunk_offset] <= oldest_snapshot_commit_id) ++dead_row_count;
+  }
+
+  return dead_row_count;
+}
+
+bool ChunkCompactionTask::_move_visible_rows(const std::shared_ptr<Table>& table, const ChunkID chunk_id) const {
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  const auto chunk = table->get_chunk(chunk_id);
+
+  auto pos_list = std::make_shared<PosList>();
+  {
+    const auto mvcc_columns = chunk->get_scoped_mvcc_columns_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      // Rows inserted after the snapshot are not visible to this transaction and would be lost
+      if (mvcc_columns->begin_cids[chunk_offset] > snapshot_commit_id) return false;
+
+      if (mvcc_columns->end_cids[chunk_offset] > snapshot_commit_id) pos_list->emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  ChunkColumns columns;
+  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+    columns.push_back(std::make_shared<ReferenceColumn>(table, column_id, pos_list));
+  }
+  auto rows_to_move = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  rows_to_move->append_chunk(columns);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(rows_to_move);
+  table_wrapper->execute();
+
+  // Deleting first detects conflicts with concurrent transactions before any rows are copied
+  auto delete_op = std::make_shared<Delete>(_table_name, table_wrapper);
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+  if (delete_op->execute_failed()) {
+    transaction_context->rollback();
+    return false;
+  }
+
+  auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  if (insert->execute_failed()) {
+    transaction_context->rollback();
+    return false;
+  }
+
+  transaction_context->commit();
+  return true;
+}
+
+bool ChunkCompactionTask::_is_compacted(const Chunk& chunk) {
+  // The MVCC columns do not tell placeholders apart, as rolled back rows have the same begin and end cids. A chunk
+  // whose columns are as small as those of a placeholder is not compacted, though, even if it is not one.
+  for (const auto& column : chunk.columns()) {
+    const auto dictionary_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(column);
+    if (!dictionary_column || dictionary_column->unique_values_count() > 1 ||
+        dictionary_column->attribute_vector()->type() != CompressedVectorType::FixedSize1ByteAligned) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ChunkCompactionTask::_replace_by_placeholder_chunk(Table& table, const ChunkID chunk_id) {
+  const auto chunk_size = table.get_chunk(chunk_id)->size();
+
+  // Every row of a placeholder column refers to the single dictionary entry, which costs one byte per row
+  ChunkColumns columns;
+  for (const auto& column_definition : table.column_definitions()) {
+    resolve_data_type(column_definition.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto dictionary = std::make_shared<pmr_vector<ColumnDataType>>(1u);
+      const auto attribute_vector =
+          std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(pmr_vector<uint8_t>(chunk_size));
+      columns.push_back(std::make_shared<DictionaryColumn<ColumnDataType>>(dictionary, attribute_vector, ValueID{1}));
+    });
+  }
+
+  auto mvcc_columns = std::make_shared<MvccColumns>(chunk_size);
+  std::fill(mvcc_columns->end_cids.begin(), mvcc_columns->end_cids.end(), CommitID{0});
+
+  auto placeholder_chunk = std::make_shared<Chunk>(columns, mvcc_columns);
+  placeholder_chunk->mark_immutable();
+  table.replace_chunk(chunk_id, placeholder_chunk);
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * @brief Garbage collects the rows of a table that have been invalidated by Delete or Update
+ *
+ * A row is dead once its end_cid is not larger than TransactionManager::oldest_active_snapshot_commit_id(), because
+ * no current or future transaction can see it anymore. Rows cannot be removed from their chunk, though, as
+ * ReferenceColumns and indexes address them by their ChunkOffset. Therefore, the task compacts a chunk in two steps:
+ *
+ *  1. If the fraction of dead rows in a completed chunk (see ChunkCompressionTask) exceeds the dead_row_threshold, a
+ *     transaction moves its remaining visible rows to the end of the table, i.e., deletes and re-inserts them.
+ *     The task gives up on the chunk if that transaction conflicts with another one.
+ *  2. Once all rows of the chunk are dead, it is atomically replaced by a placeholder chunk (Table::replace_chunk()).
+ *     The placeholder has the same size, so that existing ReferenceColumns, index entries, and Validate can still
+ *     address its rows. Its rows are invisible to all transactions and each column costs one byte per row.
+ *
+ * Often, both steps happen in the same run. If older transactions still exist, step 2 happens in a later run.
+ * The chunks that have been completed by the moved rows are left to the BackgroundChunkEncoder.
+ *
+ * The last chunk, which may still receive rows, is never compacted. Neither are tables with chunk indexes, as the
+ * placeholder chunks would lack them. Queries that run without a transaction context read default values from the
+ * rows of replaced chunks.
+ */
+class ChunkCompactionTask : public AbstractTask {
+ public:
+  static constexpr auto DEFAULT_DEAD_ROW_THRESHOLD = 0.5f;
+
+  explicit ChunkCompactionTask(const std::string& table_name,
+                               const float dead_row_threshold = DEFAULT_DEAD_ROW_THRESHOLD);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  // Returns the number of dead rows, or nullopt if the chunk is not completed
+  static std::optional<ChunkOffset> _count_dead_rows(const Chunk& chunk, const CommitID oldest_snapshot_commit_id);
+
+  // Returns false if the rows could not be moved
+  bool _move_visible_rows(const std::shared_ptr<Table>& table, const ChunkID chunk_id) const;
+
+  // Returns true if the chunk has already been replaced by a placeholder chunk or is as small as one
+  static bool _is_compacted(const Chunk& chunk);
+
+  static void _replace_by_placeholder_chunk(Table& table, const ChunkID chunk_id);
+
+  const std::string _table_name;
+  const float _dead_row_threshold;
+};
+
+}  // namespace opossum
@@ -19,6 +19,14 @@ ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
     : _table_name{table_name}, _chunk_ids{chunk_ids} {}
 
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                           const ChunkEncodingSpec& chunk_encoding_spec,
+                                           const SchedulePriority priority)
+    : AbstractTask{priority},
+      _table_name{table_name},
+      _chunk_ids{chunk_id},
+      _chunk_encoding_spec{chunk_encoding_spec} {}
+
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
 
@@ -29,10 +37,17 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
+    // The chunk has been encoded or replaced (see ChunkCompactionTask) since the task was created
+    if (!chunk->is_mutable()) continue;
+
     DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    if (_chunk_encoding_spec) {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), *_chunk_encoding_spec);
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    }
   }
 }
 
@@ -1,16 +1,18 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
 class Chunk;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses a chunk of a table using the default encoding or the given ChunkEncodingSpec
  *
  * The task compresses a chunk by sequentially compressing columns.
  * From each value column, a dictionary column is created that replaces the
@@ -25,7 +27,8 @@ class Chunk;
  * compressing the chunk leads to inconsistent state. Therefore only chunks where
  * all insertion has been completed may be compressed. In other words, they need to be
  * full and all of their end-cids must be smaller than infinity. This task calls
- * those chunks “completed”.
+ * those chunks “completed”. Chunks that are not mutable anymore, e.g., because they have already been
+ * compressed, are skipped.
  *
  * Note: Reference columns are not invalidated by this task because the order in which
  *       records are stored does not change.
@@ -34,6 +37,9 @@ class ChunkCompressionTask : public AbstractTask {
  public:
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                       const ChunkEncodingSpec& chunk_encoding_spec,
+                       const SchedulePriority priority = SchedulePriority::Default);
 
  protected:
   void _on_execute() override;
@@ -49,5 +55,6 @@ class ChunkCompressionTask : public AbstractTask {
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::optional<ChunkEncodingSpec> _chunk_encoding_spec;
 };
 }  // namespace opossum
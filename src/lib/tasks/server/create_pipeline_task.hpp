@@ -2,10 +2,14 @@
 
 #include <boost/thread/future.hpp>
 
+#include <memory>
+#include <utility>
+
 #include "abstract_server_task.hpp"
 
 namespace opossum {
 
+class ResourceGroup;
 class SQLPipeline;
 
 struct CreatePipelineResult {
@@ -18,8 +22,9 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              std::shared_ptr<ResourceGroup> resource_group = nullptr)
+      : _sql(sql), _allow_load_table(allow_load_table), _resource_group(std::move(resource_group)) {}
 
  protected:
   void _on_execute() override;
@@ -32,6 +37,9 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   const std::string _sql;
   const bool _allow_load_table;
 
+  // The ResourceGroup of the session that the pipeline's tasks are executed in
+  const std::shared_ptr<ResourceGroup> _resource_group;
+
   std::string _file_name;
   std::string _table_name;
 };
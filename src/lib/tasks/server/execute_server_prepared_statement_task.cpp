@@ -3,6 +3,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/resource_group_manager.hpp"
 #include "sql/sql_query_plan.hpp"
 
 namespace opossum {
@@ -10,6 +11,12 @@ namespace opossum {
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
     const auto tasks = _prepared_plan->create_tasks();
+    if (_resource_group) {
+      for (const auto& task : tasks) task->set_resource_group(_resource_group);
+    }
+
+    // Prepared statements bypass the SQLPipeline, which admits all other queries
+    const auto query_admission = QueryAdmission{};
     CurrentScheduler::schedule_and_wait_for_tasks(tasks);
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <memory>
+#include <utility>
+
 #include "abstract_server_task.hpp"
 
 namespace opossum {
 
+class ResourceGroup;
 class SQLQueryPlan;
 class TransactionContext;
 class Table;
@@ -11,13 +15,15 @@ class Table;
 // This task takes a query plan of a prepared statement and executes it.
 class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
-  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<SQLQueryPlan> prepared_plan)
-      : _prepared_plan(std::move(prepared_plan)) {}
+  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<SQLQueryPlan> prepared_plan,
+                                              std::shared_ptr<ResourceGroup> resource_group = nullptr)
+      : _prepared_plan(std::move(prepared_plan)), _resource_group(std::move(resource_group)) {}
 
  protected:
   void _on_execute() override;
 
   std::shared_ptr<SQLQueryPlan> _prepared_plan;
+  const std::shared_ptr<ResourceGroup> _resource_group;
 };
 
 }  // namespace opossum
@@ -0,0 +1,32 @@
+#include "mapped_file_memory_resource.hpp"
+
+#include <cstdint>
+#include <memory>
+
+#include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace opossum {
+
+MappedFileMemoryResource::MappedFileMemoryResource(const std::shared_ptr<const MemoryMappedFile>& file,
+                                                   const char* data, size_t size)
+    : _file(file), _data(data), _size(size) {
+  DebugAssert(data >= file->data() && data + size <= file->data() + file->size(), "Range is not part of the file");
+}
+
+void* MappedFileMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  Assert(!_is_allocated, "MappedFileMemoryResource can only serve a single allocation");
+  Assert(bytes == _size, "MappedFileMemoryResource: Allocation does not match the mapped range");
+  Assert(reinterpret_cast<uintptr_t>(_data) % alignment == 0, "MappedFileMemoryResource: Mapped range is misaligned");
+
+  _is_allocated = true;
+  return const_cast<char*>(_data);
+}
+
+void MappedFileMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  // The mapping is released together with the last resource that references the file
+}
+
+bool MappedFileMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return this == &other; }
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <memory>
+
+namespace opossum {
+
+class MemoryMappedFile;
+
+/**
+ * Read-only memory resource for a range of a MemoryMappedFile that already holds the values of a vector. It serves a
+ * single allocation of that range, so that a vector that is constructed in place (i.e., with default-initialized
+ * elements of a trivial type) uses the mapped pages as its storage without copying or modifying them. Such a vector
+ * must not be modified. Deallocation is a no-op. The file stays mapped as long as the resource exists, which must be
+ * at least as long as the vector exists.
+ */
+class MappedFileMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  MappedFileMemoryResource(const std::shared_ptr<const MemoryMappedFile>& file, const char* data, size_t size);
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  const std::shared_ptr<const MemoryMappedFile> _file;
+  const char* const _data;
+  const size_t _size;
+  bool _is_allocated{false};
+};
+
+}  // namespace opossum
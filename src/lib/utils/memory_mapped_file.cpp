@@ -0,0 +1,49 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "Could not open file " + path + ": " + std::strerror(errno));
+
+  struct stat file_stat {};
+  const auto stat_result = ::fstat(file_descriptor, &file_stat);
+  if (stat_result != 0) ::close(file_descriptor);
+  Assert(stat_result == 0, "Could not stat file " + path + ": " + std::strerror(errno));
+  _size = static_cast<size_t>(file_stat.st_size);
+
+  // mmap() does not accept empty mappings
+  if (_size > 0) {
+    auto* const mapping = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+    if (mapping == MAP_FAILED) ::close(file_descriptor);
+    Assert(mapping != MAP_FAILED, "Could not map file " + path + ": " + std::strerror(errno));
+
+    // The whole file is going to be read, so the kernel may start reading it ahead
+    ::madvise(mapping, _size, MADV_WILLNEED);
+    _data = static_cast<const char*>(mapping);
+  }
+
+  // The mapping stays valid after the file descriptor is closed
+  ::close(file_descriptor);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) ::munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MemoryMappedFile::data() const { return _data; }
+
+size_t MemoryMappedFile::size() const { return _size; }
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Read-only, shared memory mapping of a whole file. Reading from the mapping does not require an intermediate stream
+ * buffer. The mapped pages are only valid as long as the MemoryMappedFile exists, so vectors that use them as their
+ * storage (see MappedFileMemoryResource) keep it alive through a shared_ptr.
+ */
+class MemoryMappedFile : private Noncopyable {
+ public:
+  explicit MemoryMappedFile(const std::string& path);
+  ~MemoryMappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+ private:
+  const char* _data{nullptr};
+  size_t _size{0};
+};
+
+}  // namespace opossum
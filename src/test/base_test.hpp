@@ -9,6 +9,7 @@
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/resource_group_manager.hpp"
 #include "storage/column_encoding_utils.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/numa_placement_manager.hpp"
@@ -72,6 +73,7 @@ class BaseTestWithParam : public std::conditional<std::is_same<ParamType, void>:
 
     StorageManager::reset();
     TransactionManager::reset();
+    ResourceGroupManager::reset();
   }
 };
 
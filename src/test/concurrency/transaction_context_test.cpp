@@ -108,4 +108,21 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, OldestActiveSnapshotCommitIdTracksExistingContexts) {
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), manager().last_commit_id());
+
+  auto first_context = manager().new_transaction_context();
+  manager().new_transaction_context()->commit();
+  auto second_context = manager().new_transaction_context();
+
+  ASSERT_LT(first_context->snapshot_commit_id(), second_context->snapshot_commit_id());
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), first_context->snapshot_commit_id());
+
+  first_context.reset();
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), second_context->snapshot_commit_id());
+
+  second_context.reset();
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), manager().last_commit_id());
+}
+
 }  // namespace opossum
@@ -0,0 +1,164 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/checkpoint_manager.hpp"
+#include "logging/logger.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class CheckpointManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    filesystem::remove_all(_folder);
+    _checkpoint_manager = std::make_unique<CheckpointManager>(_folder + "/checkpoints");
+
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+  }
+
+  void TearDown() override {
+    Logger::get().shutdown();
+    filesystem::remove_all(_folder);
+  }
+
+  // Simulates a restart, after which only the files in _folder are left
+  void _restart() {
+    Logger::get().shutdown();
+    StorageManager::reset();
+    TransactionManager::reset();
+    _checkpoint_manager->recover(_folder + "/" + Logger::LOG_FILE_NAME);
+  }
+
+  void _insert(const std::vector<AllTypeVariant>& values, const std::shared_ptr<TransactionContext>& context) {
+    const auto& column_definitions = StorageManager::get().get_table("table_a")->column_definitions();
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+    table->append(values);
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+  }
+
+  void _delete(const int32_t value, const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::Equals, value);
+    auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+    for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{get_table, validate, table_scan, delete_op}) {
+      op->set_transaction_context(context);
+      op->execute();
+    }
+  }
+
+  std::shared_ptr<const Table> _visible_rows() {
+    auto context = TransactionManager::get().new_transaction_context();
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    get_table->execute();
+    validate->execute();
+    return validate->get_output();
+  }
+
+  const std::string _folder = test_data_path + "checkpoint_manager_test";
+  std::unique_ptr<CheckpointManager> _checkpoint_manager;
+};
+
+TEST_F(CheckpointManagerTest, RecoverFromCheckpoint) {
+  auto context = TransactionManager::get().new_transaction_context();
+  _delete(123, context);
+  context->commit();
+
+  const auto expected = _visible_rows();
+  const auto snapshot_commit_id = _checkpoint_manager->take_checkpoint();
+  ASSERT_TRUE(_checkpoint_manager->latest_checkpoint());
+
+  _restart();
+
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), snapshot_commit_id);
+  EXPECT_EQ(StorageManager::get().get_table("table_a")->max_chunk_size(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected);
+}
+
+TEST_F(CheckpointManagerTest, UncommittedRowsAreNotInCheckpoint) {
+  auto context = TransactionManager::get().new_transaction_context();
+  _insert({1, 1.0f}, context);
+
+  const auto expected = _visible_rows();
+  _checkpoint_manager->take_checkpoint();
+  context->commit();
+
+  _restart();
+
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected);
+}
+
+TEST_F(CheckpointManagerTest, TableWithoutMvcc) {
+  // The StorageManager only accepts tables without MVCC while they do not have chunks
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String}},
+                                       TableType::Data, 2, UseMvcc::No);
+  StorageManager::get().add_table("table_b", table);
+  table->append({1, "one"});
+  table->append({2, "two"});
+  table->append({3, "three"});
+
+  _checkpoint_manager->take_checkpoint();
+  _restart();
+
+  EXPECT_TABLE_EQ_ORDERED(StorageManager::get().get_table("table_b"), table);
+}
+
+TEST_F(CheckpointManagerTest, ReplayLogAfterCheckpoint) {
+  Logger::get().setup(_folder);
+
+  auto first_context = TransactionManager::get().new_transaction_context();
+  _insert({1, 1.0f}, first_context);
+  first_context->commit();
+
+  _checkpoint_manager->take_checkpoint();
+
+  // Only the log contains these transactions
+  auto second_context = TransactionManager::get().new_transaction_context();
+  _insert({2, 2.0f}, second_context);
+  _delete(1, second_context);
+  second_context->commit();
+
+  auto rolled_back_context = TransactionManager::get().new_transaction_context();
+  _insert({3, 3.0f}, rolled_back_context);
+  rolled_back_context->rollback();
+
+  auto third_context = TransactionManager::get().new_transaction_context();
+  _insert({4, 4.0f}, third_context);
+  third_context->commit();
+
+  const auto expected = _visible_rows();
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  _restart();
+
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected);
+
+  // New transactions can modify the recovered table
+  auto context = TransactionManager::get().new_transaction_context();
+  _insert({5, 5.0f}, context);
+  context->commit();
+  EXPECT_EQ(_visible_rows()->row_count(), expected->row_count() + 1);
+}
+
+}  // namespace opossum
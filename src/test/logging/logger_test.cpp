@@ -0,0 +1,151 @@
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/logger.hpp"
+#include "logging/redo_log_record.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class LoggerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    filesystem::remove_all(_log_folder);
+    Logger::get().setup(_log_folder);
+
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void TearDown() override {
+    Logger::get().shutdown();
+    filesystem::remove_all(_log_folder);
+  }
+
+  const std::string _log_folder = test_data_path + "logger_test";
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(LoggerTest, LogsInsertAndCommit) {
+  auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values->append({42, 1.5f});
+  auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  // commit() returns after the group commit that contains the Commit record
+  EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+
+  const auto records = read_redo_log(Logger::get().log_file_path());
+  ASSERT_EQ(records.size(), 2u);
+
+  EXPECT_EQ(records[0].type, RedoLogRecordType::Value);
+  EXPECT_EQ(records[0].transaction_id, context->transaction_id());
+  EXPECT_EQ(records[0].table_name, "table_a");
+  EXPECT_EQ(records[0].row_id, (RowID{ChunkID{1}, 1u}));
+  EXPECT_EQ(records[0].values, (std::vector<AllTypeVariant>{42, 1.5f}));
+
+  EXPECT_EQ(records[1].type, RedoLogRecordType::Commit);
+  EXPECT_EQ(records[1].transaction_id, context->transaction_id());
+  EXPECT_EQ(records[1].commit_id, context->commit_id());
+}
+
+TEST_F(LoggerTest, LogsDelete) {
+  auto context = TransactionManager::get().new_transaction_context();
+
+  auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->set_transaction_context(context);
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::Equals, 123);
+  table_scan->set_transaction_context(context);
+  auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+  delete_op->set_transaction_context(context);
+
+  get_table->execute();
+  table_scan->execute();
+  delete_op->execute();
+  context->commit();
+
+  const auto records = read_redo_log(Logger::get().log_file_path());
+  ASSERT_EQ(records.size(), 2u);
+
+  EXPECT_EQ(records[0].type, RedoLogRecordType::Invalidation);
+  EXPECT_EQ(records[0].table_name, "table_a");
+  EXPECT_EQ(records[0].row_id, (RowID{ChunkID{0}, 1u}));
+  EXPECT_EQ(records[1].type, RedoLogRecordType::Commit);
+}
+
+TEST_F(LoggerTest, RolledBackAndReadOnlyTransactionsAreNotLogged) {
+  auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values->append({42, 1.5f});
+  auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->rollback();
+
+  TransactionManager::get().new_transaction_context()->commit();
+
+  Logger::get().flush();
+  EXPECT_TRUE(read_redo_log(Logger::get().log_file_path()).empty());
+}
+
+TEST_F(LoggerTest, RecordsRoundTrip) {
+  auto buffer = std::vector<char>{};
+  append_value_record(buffer, TransactionID{3}, "t", RowID{ChunkID{1}, 2u},
+                      {int32_t{1}, int64_t{2}, 3.5f, 4.5, std::string{"five"}, NullValue{}});
+  append_invalidation_record(buffer, TransactionID{4}, "u", RowID{ChunkID{5}, 6u});
+  append_commit_record(buffer, TransactionID{4}, CommitID{7});
+
+  // A record that was only partially written before a crash is ignored
+  append_commit_record(buffer, TransactionID{5}, CommitID{8});
+  buffer.resize(buffer.size() - 2);
+
+  const auto file_path = _log_folder + "/records.log";
+  {
+    auto file = std::ofstream{file_path, std::ios::binary};
+    file.write(buffer.data(), buffer.size());
+  }
+
+  const auto records = read_redo_log(file_path);
+  ASSERT_EQ(records.size(), 3u);
+
+  EXPECT_EQ(records[0].transaction_id, TransactionID{3});
+  EXPECT_EQ(records[0].row_id, (RowID{ChunkID{1}, 2u}));
+  ASSERT_EQ(records[0].values.size(), 6u);
+  EXPECT_EQ(records[0].values[0], AllTypeVariant{int32_t{1}});
+  EXPECT_EQ(records[0].values[1], AllTypeVariant{int64_t{2}});
+  EXPECT_EQ(records[0].values[2], AllTypeVariant{3.5f});
+  EXPECT_EQ(records[0].values[3], AllTypeVariant{4.5});
+  EXPECT_EQ(records[0].values[4], AllTypeVariant{std::string{"five"}});
+  EXPECT_TRUE(variant_is_null(records[0].values[5]));
+
+  EXPECT_EQ(records[1].type, RedoLogRecordType::Invalidation);
+  EXPECT_EQ(records[1].table_name, "u");
+  EXPECT_EQ(records[1].row_id, (RowID{ChunkID{5}, 6u}));
+
+  EXPECT_EQ(records[2].type, RedoLogRecordType::Commit);
+  EXPECT_EQ(records[2].commit_id, CommitID{7});
+}
+
+}  // namespace opossum
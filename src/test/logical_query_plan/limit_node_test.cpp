@@ -19,14 +19,30 @@ class LimitNodeTest : public ::testing::Test {
   std::shared_ptr<LimitNode> _limit_node;
 };
 
-TEST_F(LimitNodeTest, Description) { EXPECT_EQ(_limit_node->description(), "[Limit] 10"); }
+TEST_F(LimitNodeTest, Description) {
+  EXPECT_EQ(_limit_node->description(), "[Limit] 10");
+
+  _limit_node->limit_type = LimitType::TopK;
+  EXPECT_EQ(_limit_node->description(), "[Limit] (TopK) 10");
+}
 
 TEST_F(LimitNodeTest, Equals) {
   EXPECT_EQ(*_limit_node, *_limit_node);
   EXPECT_EQ(*LimitNode::make(value_(10)), *_limit_node);
   EXPECT_NE(*LimitNode::make(value_(11)), *_limit_node);
+
+  const auto top_k_node = LimitNode::make(value_(10));
+  top_k_node->limit_type = LimitType::TopK;
+  EXPECT_NE(*top_k_node, *_limit_node);
 }
 
-TEST_F(LimitNodeTest, Copy) { EXPECT_EQ(*_limit_node->deep_copy(), *_limit_node); }
+TEST_F(LimitNodeTest, Copy) {
+  EXPECT_EQ(*_limit_node->deep_copy(), *_limit_node);
+
+  _limit_node->limit_type = LimitType::TopK;
+  const auto copy = std::static_pointer_cast<LimitNode>(_limit_node->deep_copy());
+  EXPECT_EQ(copy->limit_type, LimitType::TopK);
+  EXPECT_EQ(*copy, *_limit_node);
+}
 
 }  // namespace opossum
@@ -17,6 +17,9 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -492,6 +495,159 @@ TEST_F(OperatorsAggregateTest, DictionarySingleAggregateCountWithNull) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/count_null.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, DictionaryTwoGroupbySum) {
+  auto table = load_table("src/test/tables/aggregateoperator/groupby_int_2gb_1agg/input.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table);
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  this->test_output(table_wrapper, {{ColumnID{2}, AggregateFunction::Sum}}, {ColumnID{0}, ColumnID{1}},
+                    "src/test/tables/aggregateoperator/groupby_int_2gb_1agg/sum.tbl", 1);
+}
+
+TEST_F(OperatorsAggregateTest, FixedStringDictionaryCountWithNull) {
+  auto table = load_table("src/test/tables/aggregateoperator/groupby_string_1gb_1agg/input_null.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table,
+                                  ChunkEncodingSpec{{EncodingType::FixedStringDictionary}, {EncodingType::Dictionary}});
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  this->test_output(table_wrapper, {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}},
+                    "src/test/tables/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl", 1, false);
+}
+
+TEST_F(OperatorsAggregateTest, FixedStringDictionaryAllNullChunk) {
+  // The dictionary of the second chunk is empty, but its NULL value id is 1
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}, {"b", DataType::Int}},
+                                       TableType::Data, 2);
+  table->append({"aaa", 1});
+  table->append({"aaa", 2});
+  table->append({NULL_VALUE, 3});
+  table->append({NULL_VALUE, 4});
+  table->append({"bb", 5});
+  ChunkEncoder::encode_all_chunks(table,
+                                  ChunkEncodingSpec{{EncodingType::FixedStringDictionary}, {EncodingType::Dictionary}});
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::String, true}, {"COUNT(b)", DataType::Long}}, TableType::Data);
+  expected_result->append({"aaa", int64_t{2}});
+  expected_result->append({NULL_VALUE, int64_t{2}});
+  expected_result->append({"bb", int64_t{1}});
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsAggregateTest, ParallelPreAggregationAndMerge) {
+  // Enough chunks for eight jobs and enough groups per job for the pre-aggregation tables to be spilled repeatedly
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto chunk_size = ChunkOffset{10'000};
+  const auto chunk_count = 32;
+  const auto group_count = 50'000;
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}},
+                                       TableType::Data, chunk_size);
+  for (auto chunk_id = 0; chunk_id < chunk_count; ++chunk_id) {
+    auto a_values = pmr_concurrent_vector<int32_t>(chunk_size);
+    auto b_values = pmr_concurrent_vector<int32_t>(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto row = static_cast<int32_t>(chunk_id * chunk_size + chunk_offset);
+      a_values[chunk_offset] = row % group_count;
+      b_values[chunk_offset] = row;
+    }
+    table->append_chunk({std::make_shared<ValueColumn<int32_t>>(std::move(a_values)),
+                         std::make_shared<ValueColumn<int32_t>>(std::move(b_values))});
+  }
+
+  // Group a contains the rows a, a + group_count, a + 2 * group_count, ...
+  auto expected_result = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int},
+                                                                        {"SUM(b)", DataType::Long, true},
+                                                                        {"MIN(b)", DataType::Int, true},
+                                                                        {"COUNT(*)", DataType::Long}},
+                                                 TableType::Data);
+  auto a_values = pmr_concurrent_vector<int32_t>{};
+  auto sum_values = pmr_concurrent_vector<int64_t>{};
+  auto count_values = pmr_concurrent_vector<int64_t>{};
+  for (auto group = 0; group < group_count; ++group) {
+    auto sum = int64_t{0};
+    auto count = int64_t{0};
+    for (auto row = int64_t{group}; row < chunk_count * chunk_size; row += group_count) {
+      sum += row;
+      ++count;
+    }
+    a_values.push_back(group);
+    sum_values.push_back(sum);
+    count_values.push_back(count);
+  }
+  auto min_values = a_values;
+  expected_result->append_chunk({std::make_shared<ValueColumn<int32_t>>(std::move(a_values)),
+                                 std::make_shared<ValueColumn<int64_t>>(std::move(sum_values)),
+                                 std::make_shared<ValueColumn<int32_t>>(std::move(min_values)),
+                                 std::make_shared<ValueColumn<int64_t>>(std::move(count_values))});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                             {ColumnID{1}, AggregateFunction::Min},
+                                             {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+}
+
+TEST_F(OperatorsAggregateTest, DenseDictionaryAggregationMatchesHashAggregation) {
+  // Even chunks have a small dictionary and are aggregated densely by value ID, odd chunks are too large for that
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto chunk_size = ChunkOffset{2'000};
+  const auto create_table = [&]() {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int}},
+                                         TableType::Data, chunk_size);
+    for (auto row = 0; row < 8 * static_cast<int32_t>(chunk_size); ++row) {
+      const auto group_count = (row / chunk_size) % 2 == 0 ? 7 : 1'500;
+      const auto a = row % 11 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row % group_count};
+      table->append({a, row % 13});
+    }
+    return table;
+  };
+
+  auto encoded_table = create_table();
+  ChunkEncoder::encode_all_chunks(encoded_table);
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                                                 {ColumnID{1}, AggregateFunction::Min},
+                                                                 {ColumnID{1}, AggregateFunction::CountDistinct},
+                                                                 {std::nullopt, AggregateFunction::Count}};
+
+  for (const auto& aggregate_definitions : {aggregates, std::vector<AggregateColumnDefinition>{}}) {
+    auto table_wrapper = std::make_shared<TableWrapper>(create_table());
+    table_wrapper->execute();
+    auto expected_aggregate =
+        std::make_shared<Aggregate>(table_wrapper, aggregate_definitions, std::vector<ColumnID>{ColumnID{0}});
+    expected_aggregate->execute();
+
+    auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+    encoded_table_wrapper->execute();
+    auto aggregate =
+        std::make_shared<Aggregate>(encoded_table_wrapper, aggregate_definitions, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+}
+
 /**
  * Tests for empty tables
  */
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -5,13 +8,23 @@
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "operators/export_binary.hpp"
 #include "operators/import_binary.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "utils/mapped_file_memory_resource.hpp"
 
 namespace opossum {
 
-class OperatorsImportBinaryTest : public BaseTest {};
+class OperatorsImportBinaryTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  const std::string filename = test_data_path + "import_test.bin";
+};
 
 TEST_F(OperatorsImportBinaryTest, SingleChunkSingleFloatColumn) {
   auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float}}, TableType::Data, 5);
@@ -279,4 +292,125 @@ TEST_F(OperatorsImportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
 }
 
+TEST_F(OperatorsImportBinaryTest, SimdBp128DictionaryColumn) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String);
+
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 3000);
+  for (auto value = 0; value < 5000; ++value) {
+    expected_table->append({value % 7 == 0 ? NULL_VALUE : AllTypeVariant{value}, std::to_string(value % 300)});
+  }
+  ChunkEncoder::encode_all_chunks(expected_table, {EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(expected_table);
+  table_wrapper->execute();
+  auto exporter = std::make_shared<ExportBinary>(table_wrapper, filename);
+  exporter->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
+}
+
+TEST_F(OperatorsImportBinaryTest, FrontCodedDictionaryColumn) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String, true);
+
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto value = 0; value < 250; ++value) {
+    const auto url = "https://example.com/" + std::to_string(value);
+    expected_table->append({value % 11 == 0 ? NULL_VALUE : AllTypeVariant{url}});
+  }
+  ChunkEncoder::encode_all_chunks(expected_table, EncodingType::FrontCodedDictionary);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(expected_table);
+  table_wrapper->execute();
+  auto exporter = std::make_shared<ExportBinary>(table_wrapper, filename);
+  exporter->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  const auto imported_column = importer->get_output()->get_chunk(ChunkID{1})->get_column(ColumnID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<const FrontCodedDictionaryColumn<std::string>>(imported_column), nullptr);
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
+}
+
+TEST_F(OperatorsImportBinaryTest, TruncatedFile) {
+  std::ifstream original{"src/test/binary/AllTypesDictionaryNullValues.bin", std::ios::binary};
+  auto content = std::string{std::istreambuf_iterator<char>(original), std::istreambuf_iterator<char>()};
+  content.resize(content.size() - 3);
+  std::ofstream{filename, std::ios::binary} << content;
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  EXPECT_THROW(importer->execute(), std::exception);
+}
+
+TEST_F(OperatorsImportBinaryTest, DictionaryColumnsUseFileMapping) {
+  auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto value = 0; value < 250; ++value) {
+    expected_table->append({value % 17});
+  }
+  ChunkEncoder::encode_all_chunks(expected_table,
+                                  {EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(expected_table);
+  table_wrapper->execute();
+  auto exporter = std::make_shared<ExportBinary>(table_wrapper, filename);
+  exporter->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+  const auto imported_table = importer->get_output();
+  importer.reset();
+
+  const auto column = std::dynamic_pointer_cast<const DictionaryColumn<int32_t>>(
+      imported_table->get_chunk(ChunkID{1})->get_column(ColumnID{0}));
+  ASSERT_NE(column, nullptr);
+  EXPECT_NE(dynamic_cast<MappedFileMemoryResource*>(column->dictionary()->get_allocator().resource()), nullptr);
+
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const FixedSizeByteAlignedVector<uint8_t>>(column->attribute_vector());
+  ASSERT_NE(attribute_vector, nullptr);
+  EXPECT_NE(dynamic_cast<MappedFileMemoryResource*>(attribute_vector->data().get_allocator().resource()), nullptr);
+
+  // The mapping must outlive the importer because the columns still point into it
+  EXPECT_TABLE_EQ_ORDERED(imported_table, expected_table);
+}
+
+TEST_F(OperatorsImportBinaryTest, UnversionedFile) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String);
+  column_definitions.emplace_back("b", DataType::Int);
+  column_definitions.emplace_back("c", DataType::Long);
+  column_definitions.emplace_back("d", DataType::Float);
+  column_definitions.emplace_back("e", DataType::Double);
+
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  expected_table->append({"AAAAA", 1, static_cast<int64_t>(100), 1.1f, 11.1});
+  expected_table->append({"BBBBBBBBBB", 2, static_cast<int64_t>(200), 2.2f, 22.2});
+  expected_table->append({"CCCCCCCCCCCCCCC", 3, static_cast<int64_t>(300), 3.3f, 33.3});
+  expected_table->append({"DDDDDDDDDDDDDDDDDDDD", 4, static_cast<int64_t>(400), 4.4f, 44.4});
+
+  ChunkEncoder::encode_all_chunks(expected_table);
+
+  auto importer = std::make_shared<opossum::ImportBinary>("src/test/binary/AllTypesDictionaryColumnVersion0.bin");
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
+}
+
+TEST_F(OperatorsImportBinaryTest, UnsupportedVersion) {
+  std::ofstream file{filename, std::ios::binary};
+  file.write(BINARY_FILE_MAGIC_NUMBER, sizeof(BINARY_FILE_MAGIC_NUMBER));
+  const auto version = uint32_t{BINARY_FILE_VERSION + 1};
+  file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  file.close();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  EXPECT_THROW(importer->execute(), std::exception);
+}
+
 }  // namespace opossum
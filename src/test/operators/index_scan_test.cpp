@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -8,12 +9,14 @@
 #include "gtest/gtest.h"
 
 #include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index/table_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -125,6 +128,31 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnDataTable) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanWithParameters) {
+  const auto right_values = std::vector<AllParameterVariant>{ParameterID{0}};
+  const auto right_values2 = std::vector<AllParameterVariant>{ParameterID{1}};
+  const auto expected = std::vector<AllTypeVariant>{104, 106, 108, 108, 106};
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Between, right_values, right_values2);
+  scan->set_included_chunk_ids({ChunkID{1}});
+
+  // The values need to be set before the execution
+  const auto copied_scan = scan->deep_copy();
+  copied_scan->mutable_input_left()->execute();
+  EXPECT_THROW(copied_scan->execute(), std::logic_error);
+
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{4}}, {ParameterID{1}, AllTypeVariant{9}}});
+  scan->execute();
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, expected);
+
+  // A copy keeps the values and the included chunks
+  const auto copied_scan_with_values = scan->deep_copy();
+  copied_scan_with_values->mutable_input_left()->execute();
+  copied_scan_with_values->execute();
+  this->ASSERT_COLUMN_EQ(copied_scan_with_values->get_output(), ColumnID{1u}, expected);
+}
+
 TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanValueGreaterThanMaxDictionaryValue) {
   const auto all_rows =
       std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 100, 102, 104, 106, 108, 110, 112};
@@ -214,6 +242,68 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnReferenceTable) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 100, 102, 106, 108, 110};
+  tests[PredicateCondition::LessThan] = {100, 102, 100, 102};
+  tests[PredicateCondition::LessThanEquals] = {100, 102, 104, 100, 102, 104};
+  tests[PredicateCondition::GreaterThan] = {106, 108, 110, 106, 108, 110};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 106, 108, 110, 104, 106, 108, 110};
+  tests[PredicateCondition::Between] = {104, 106, 108, 104, 106, 108};
+
+  // The IndexScans probe the indexes of the table referenced by the output of the TableScan
+  auto table_scan = std::make_shared<TableScan>(this->_int_int_small_chunk, ColumnID{1}, PredicateCondition::LessThan,
+                                                112);
+  table_scan->execute();
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(table_scan, this->_index_type, this->_column_ids, test.first,
+                                            right_values, right_values2);
+
+    scan->execute();
+
+    EXPECT_EQ(scan->get_output()->type(), TableType::References);
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+  }
+}
+
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnReferenceTableWithUnindexedChunks) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 100, 102, 106, 108, 110};
+  tests[PredicateCondition::LessThan] = {100, 102, 100, 102};
+  tests[PredicateCondition::LessThanEquals] = {100, 102, 104, 100, 102, 104};
+  tests[PredicateCondition::GreaterThan] = {106, 108, 110, 106, 108, 110};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 106, 108, 110, 104, 106, 108, 110};
+  tests[PredicateCondition::Between] = {104, 106, 108, 104, 106, 108};
+
+  // Only the first chunk is indexed, e.g., because the others were added after the plan was created
+  auto int_int = load_table("src/test/tables/int_int_shuffled_2.tbl", 5);
+  ChunkEncoder::encode_all_chunks(int_int);
+  int_int->get_chunk(ChunkID{0})->template create_index<TypeParam>(this->_column_ids);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(int_int));
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, PredicateCondition::LessThan, 112);
+  table_scan->execute();
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(table_scan, this->_index_type, this->_column_ids, test.first,
+                                            right_values, right_values2);
+
+    scan->execute();
+
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+  }
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
@@ -231,4 +321,85 @@ TYPED_TEST(OperatorsIndexScanTest, InvalidIndexTypeThrows) {
   EXPECT_THROW(scan->execute(), std::logic_error);
 }
 
+class OperatorsIndexScanTableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = load_table("src/test/tables/int_int_shuffled_2.tbl", 5);
+    ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+    table->create_table_index(ColumnID{0});
+
+    _int_int = std::make_shared<TableWrapper>(table);
+    _int_int->execute();
+  }
+
+  std::vector<AllTypeVariant> scan_column_b(const PredicateCondition predicate_condition,
+                                            const std::vector<ChunkID>& included_chunk_ids = {}) {
+    auto scan = std::make_shared<IndexScan>(_int_int, ColumnIndexType::Table, std::vector<ColumnID>{ColumnID{0}},
+                                            predicate_condition, std::vector<AllTypeVariant>{4},
+                                            std::vector<AllTypeVariant>{9});
+    scan->set_included_chunk_ids(included_chunk_ids);
+    scan->execute();
+
+    const auto& output = *scan->get_output();
+    EXPECT_EQ(output.chunk_count(), 1u);
+
+    auto values = std::vector<AllTypeVariant>{};
+    const auto& column = *output.get_chunk(ChunkID{0})->get_column(ColumnID{1});
+    for (ChunkOffset chunk_offset{0}; chunk_offset < column.size(); ++chunk_offset) {
+      values.emplace_back(column[chunk_offset]);
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> _int_int;
+};
+
+TEST_F(OperatorsIndexScanTableIndexTest, SingleColumnScan) {
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 100, 102, 102, 106, 106, 108, 108, 110, 110, 112, 112};
+  tests[PredicateCondition::LessThan] = {100, 100, 102, 102};
+  tests[PredicateCondition::LessThanEquals] = {100, 100, 102, 102, 104, 104};
+  tests[PredicateCondition::GreaterThan] = {106, 106, 108, 108, 110, 110, 112, 112};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 104, 106, 106, 108, 108, 110, 110, 112, 112};
+  tests[PredicateCondition::Between] = {104, 104, 106, 106, 108, 108};
+
+  for (const auto& test : tests) {
+    EXPECT_EQ(scan_column_b(test.first), test.second);
+  }
+}
+
+TEST_F(OperatorsIndexScanTableIndexTest, SingleColumnScanOnlySomeChunks) {
+  EXPECT_EQ(scan_column_b(PredicateCondition::GreaterThan, {ChunkID{0}, ChunkID{2}}),
+            (std::vector<AllTypeVariant>{106, 106, 108, 110, 110, 112, 112}));
+}
+
+TEST_F(OperatorsIndexScanTableIndexTest, SingleColumnScanOnReferenceTable) {
+  auto table_scan = std::make_shared<TableScan>(_int_int, ColumnID{1}, PredicateCondition::LessThan, 112);
+  table_scan->execute();
+
+  auto scan = std::make_shared<IndexScan>(table_scan, ColumnIndexType::Table, std::vector<ColumnID>{ColumnID{0}},
+                                          PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{4});
+  scan->execute();
+
+  const auto& output = *scan->get_output();
+  auto values = std::vector<AllTypeVariant>{};
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& column = *output.get_chunk(chunk_id)->get_column(ColumnID{1});
+    for (ChunkOffset chunk_offset{0}; chunk_offset < column.size(); ++chunk_offset) {
+      values.emplace_back(column[chunk_offset]);
+    }
+  }
+  std::sort(values.begin(), values.end());
+
+  EXPECT_EQ(values, (std::vector<AllTypeVariant>{106, 106, 108, 108, 110, 110}));
+}
+
+TEST_F(OperatorsIndexScanTableIndexTest, MissingTableIndexThrows) {
+  auto scan = std::make_shared<IndexScan>(_int_int, ColumnIndexType::Table, std::vector<ColumnID>{ColumnID{1}},
+                                          PredicateCondition::Equals, std::vector<AllTypeVariant>{104});
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
 }  // namespace opossum
@@ -158,6 +158,32 @@ TEST_F(OperatorsInsertTest, Rollback) {
   EXPECT_EQ(validate->get_output()->row_count(), 3u);
 }
 
+TEST_F(OperatorsInsertTest, CommitUpdatesSummaryOfImmutableChunks) {
+  // 3 Rows, chunk_size = 4
+  auto t = load_table("src/test/tables/int.tbl", 4u);
+  StorageManager::get().add_table("test1", t);
+  StorageManager::get().add_table("test2", load_table("src/test/tables/10_ints.tbl", Chunk::MAX_SIZE));
+
+  auto gt = std::make_shared<GetTable>("test2");
+  gt->execute();
+
+  auto ins = std::make_shared<Insert>("test1", gt);
+  auto context = TransactionManager::get().new_transaction_context();
+  ins->set_transaction_context(context);
+  ins->execute();
+
+  // The summaries are computed while the inserted rows are not committed yet
+  t->get_chunk(ChunkID{0})->mark_immutable();
+  t->get_chunk(ChunkID{1})->mark_immutable();
+  EXPECT_EQ(t->get_chunk(ChunkID{0})->get_scoped_mvcc_columns_lock()->max_begin_cid.load(),
+            MvccColumns::MAX_COMMIT_ID);
+
+  context->commit();
+
+  EXPECT_EQ(t->get_chunk(ChunkID{0})->get_scoped_mvcc_columns_lock()->max_begin_cid.load(), context->commit_id());
+  EXPECT_EQ(t->get_chunk(ChunkID{1})->get_scoped_mvcc_columns_lock()->max_begin_cid.load(), context->commit_id());
+}
+
 TEST_F(OperatorsInsertTest, InsertStringNullValue) {
   auto t_name = "test1";
   auto t_name2 = "test2";
@@ -4,8 +4,12 @@
 #include "gtest/gtest.h"
 
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/bloom_filter.hpp"
 #include "operators/join_hash/hash_traits.hpp"
+#include "operators/join_hash/join_hash_table.hpp"
+#include "operators/join_hash/radix_partitioning_plan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/topology.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -117,6 +121,123 @@ TEST_F(JoinHashTest, MixedStringTraits) {
   EXPECT_LEXICAL_CAST(double, std::string, true);
 }
 
+TEST_F(JoinHashTest, HashTableLookup) {
+  // Use colliding hashes to force linear probing
+  auto hashtable = JoinHashTable<int32_t>{6};
+  hashtable.insert(1, 10, RowID{ChunkID{0}, 0});
+  hashtable.insert(1, 11, RowID{ChunkID{0}, 1});
+  hashtable.insert(2, 20, RowID{ChunkID{1}, 0});
+  hashtable.insert(1, 10, RowID{ChunkID{1}, 1});
+  hashtable.insert(1, 10, RowID{ChunkID{2}, 0});
+  hashtable.insert(1, 11, RowID{ChunkID{2}, 1});
+  hashtable.finalize();
+
+  EXPECT_EQ(hashtable.distinct_key_count(), 3u);
+  EXPECT_EQ(hashtable.row_count(), 6u);
+
+  const auto [begin_10, end_10] = hashtable.find(1, 10);  // NOLINT
+  EXPECT_EQ(PosList(begin_10, end_10),
+            PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 0}}));
+
+  const auto [begin_11, end_11] = hashtable.find(1, 11);  // NOLINT
+  EXPECT_EQ(PosList(begin_11, end_11), PosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{2}, 1}}));
+
+  const auto [begin_20, end_20] = hashtable.find(2, 20);  // NOLINT
+  EXPECT_EQ(PosList(begin_20, end_20), PosList({RowID{ChunkID{1}, 0}}));
+
+  const auto [begin_missing, end_missing] = hashtable.find(1, 12);  // NOLINT
+  EXPECT_EQ(begin_missing, end_missing);
+
+  EXPECT_TRUE(hashtable.contains(2, 20));
+  EXPECT_FALSE(hashtable.contains(1, 20));
+  EXPECT_FALSE(hashtable.contains(3, 30));
+}
+
+TEST_F(JoinHashTest, HashTableStrings) {
+  auto hashtable = JoinHashTable<std::string>{3};
+  hashtable.insert(7, "foo", RowID{ChunkID{0}, 0});
+  hashtable.insert(7, "bar", RowID{ChunkID{0}, 1});
+  hashtable.insert(7, "foo", RowID{ChunkID{0}, 2});
+  hashtable.finalize();
+
+  const auto [begin, end] = hashtable.find(7, "foo");  // NOLINT
+  EXPECT_EQ(PosList(begin, end), PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}}));
+  EXPECT_TRUE(hashtable.contains(7, "bar"));
+  EXPECT_FALSE(hashtable.contains(7, "baz"));
+}
+
+TEST_F(JoinHashTest, BloomFilter) {
+  auto bloom_filter = BloomFilter{1'000};
+  for (auto hash = BloomFilter::Hash{0}; hash < 1'000'000; hash += 1'000) {
+    bloom_filter.insert(hash);
+  }
+
+  // No false negatives
+  for (auto hash = BloomFilter::Hash{0}; hash < 1'000'000; hash += 1'000) {
+    EXPECT_TRUE(bloom_filter.may_contain(hash));
+  }
+
+  // Few false positives
+  auto false_positive_count = size_t{0};
+  for (auto hash = BloomFilter::Hash{1'000'000}; hash < 1'100'000; ++hash) {
+    if (bloom_filter.may_contain(hash)) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 5'000u);
+}
+
+TEST_F(JoinHashTest, RadixPartitioningPlanWithFixedBits) {
+  EXPECT_EQ(RadixPartitioningPlan::with_fixed_bits(0).bits_per_pass, std::vector<size_t>({0}));
+  EXPECT_EQ(RadixPartitioningPlan::with_fixed_bits(9).bits_per_pass, std::vector<size_t>({9}));
+  EXPECT_EQ(RadixPartitioningPlan::with_fixed_bits(9, 2).bits_per_pass, std::vector<size_t>({5, 4}));
+  EXPECT_EQ(RadixPartitioningPlan::with_fixed_bits(12, 3).bits_per_pass, std::vector<size_t>({4, 4, 4}));
+  EXPECT_EQ(RadixPartitioningPlan::with_fixed_bits(12, 3).radix_bits(), 12u);
+  EXPECT_EQ(RadixPartitioningPlan::with_fixed_bits(12, 3).partition_count(), 4096u);
+}
+
+TEST_F(JoinHashTest, RadixPartitioningPlanForBuildRelation) {
+  auto cache_info = TopologyCacheInfo{};
+  cache_info.cache_line_size = 64;
+  cache_info.l1_data_cache_size = 32 * 1024;  // 512 cache lines
+  cache_info.l2_cache_size = 1024 * 1024;
+  cache_info.l2_tlb_entry_count = 1024;
+
+  // Hash table fits into half of the L2 cache
+  EXPECT_EQ(RadixPartitioningPlan::for_build_relation(1'000, 64, cache_info).bits_per_pass, std::vector<size_t>({0}));
+
+  // 2^7 partitions of 1MB each, one pass is sufficient
+  EXPECT_EQ(RadixPartitioningPlan::for_build_relation(1'000'000, 64, cache_info).bits_per_pass,
+            std::vector<size_t>({7}));
+
+  // 2^14 partitions are more than there are L1 cache lines or TLB entries, so two passes are used
+  EXPECT_EQ(RadixPartitioningPlan::for_build_relation(128'000'000, 64, cache_info).bits_per_pass,
+            std::vector<size_t>({7, 7}));
+
+  // A larger L2 cache requires fewer partitions
+  cache_info.l2_cache_size = 2 * 1024 * 1024;
+  EXPECT_EQ(RadixPartitioningPlan::for_build_relation(1'000'000, 64, cache_info).bits_per_pass,
+            std::vector<size_t>({6}));
+}
+
+TEST_F(JoinHashTest, MultiPassRadixPartitioning) {
+  auto table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  auto table_wrapper_right = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float2.tbl", 2));
+  table_wrapper_left->execute();
+  table_wrapper_right->execute();
+
+  const auto expected_result = load_table("src/test/tables/joinoperators/int_inner_join.tbl", 1);
+
+  const auto plans = std::vector<RadixPartitioningPlan>{
+      RadixPartitioningPlan::with_fixed_bits(0), RadixPartitioningPlan::with_fixed_bits(4),
+      RadixPartitioningPlan::with_fixed_bits(4, 2), RadixPartitioningPlan::with_fixed_bits(6, 3)};
+
+  for (const auto& plan : plans) {
+    auto join = std::make_shared<JoinHash>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+                                           ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, plan);
+    join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+  }
+}
+
 TEST_F(JoinHashTest, OperatorName) {
   auto join = std::make_shared<JoinHash>(_table_wrapper_small, _table_wrapper_small, JoinMode::Inner,
                                          ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
@@ -16,6 +16,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index/table_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -541,4 +542,56 @@ TYPED_TEST(JoinIndexTest, LeftJoinEmptyRefColumn) {
                          "src/test/tables/joinoperators/int_join_empty_left.tbl", 1);
 }
 
+class JoinIndexTableIndexTest : public BaseTest {
+ protected:
+  // The right inputs only have a TableIndex, no chunk indexes
+  std::shared_ptr<TableWrapper> load_table_with_table_index(const std::string& filename, const size_t chunk_size) {
+    auto table = load_table(filename, chunk_size);
+    ChunkEncoder::encode_all_chunks(table, ColumnEncodingSpec{EncodingType::Dictionary});
+    table->create_table_index(ColumnID{0});
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  void test_join_output(const std::string& left_file_name, const std::string& right_file_name,
+                        const PredicateCondition predicate_condition, const JoinMode mode,
+                        const std::string& file_name) {
+    auto left = load_table_with_table_index(left_file_name, 2);
+    auto right = load_table_with_table_index(right_file_name, 2);
+
+    auto join = std::make_shared<JoinIndex>(left, right, mode, std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                                            predicate_condition);
+    join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), load_table(file_name, 1));
+  }
+};
+
+TEST_F(JoinIndexTableIndexTest, InnerJoin) {
+  test_join_output("src/test/tables/int_float.tbl", "src/test/tables/int_float2.tbl", PredicateCondition::Equals,
+                   JoinMode::Inner, "src/test/tables/joinoperators/int_inner_join.tbl");
+}
+
+TEST_F(JoinIndexTableIndexTest, LeftJoin) {
+  test_join_output("src/test/tables/int_float.tbl", "src/test/tables/int_float2.tbl", PredicateCondition::Equals,
+                   JoinMode::Left, "src/test/tables/joinoperators/int_left_join.tbl");
+}
+
+TEST_F(JoinIndexTableIndexTest, OuterJoin) {
+  test_join_output("src/test/tables/int_float.tbl", "src/test/tables/int_float2.tbl", PredicateCondition::Equals,
+                   JoinMode::Outer, "src/test/tables/joinoperators/int_outer_join.tbl");
+}
+
+TEST_F(JoinIndexTableIndexTest, SmallerInnerJoin) {
+  test_join_output("src/test/tables/int_float.tbl", "src/test/tables/int_float2.tbl", PredicateCondition::LessThan,
+                   JoinMode::Inner, "src/test/tables/joinoperators/int_smaller_inner_join.tbl");
+}
+
+TEST_F(JoinIndexTableIndexTest, SmallerOuterJoin) {
+  test_join_output("src/test/tables/int4.tbl", "src/test/tables/int.tbl", PredicateCondition::LessThan,
+                   JoinMode::Outer, "src/test/tables/joinoperators/int_smaller_outer_join.tbl");
+}
+
 }  // namespace opossum
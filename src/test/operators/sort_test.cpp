@@ -1,4 +1,5 @@
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -10,6 +11,9 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -142,6 +146,59 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, MultipleColumnSort) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float2_sorted_mixed.tbl", 2);
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortWithStringsNegativesAndNulls) {
+  auto table = load_table("src/test/tables/string_int_null_float.tbl", 3);
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/string_int_null_float_sorted.tbl", 2);
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+      SortColumnDefinition{ColumnID{1}, OrderByMode::DescendingNullsLast},
+      SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortOfReferenceColumns) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/string_int_null_float.tbl", 2));
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::NotEquals, "b");
+  scan->execute();
+
+  std::shared_ptr<Table> expected_result =
+      load_table("src/test/tables/string_int_null_float_filtered_sorted_mixed.tbl", 2);
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{0}, OrderByMode::Descending},
+      SortColumnDefinition{ColumnID{1}, OrderByMode::AscendingNullsLast},
+      SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}};
+  auto sort = std::make_shared<Sort>(scan, sort_definitions, 3u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2);
 
@@ -214,4 +271,39 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneDictColumn) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, ParallelMergeOfMoreRunsThanCPUs) {
+  // Four CPUs, hence the 50 runs are merged in four partitions
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto chunk_size = ChunkOffset{100};
+  const auto row_count = 50 * chunk_size;
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, chunk_size);
+  for (auto row = 0u; row < row_count; ++row) {
+    // Each value occurs in several chunks
+    table->append({static_cast<int32_t>(row * 7919 % 997)});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Ascending, chunk_size);
+  sort->execute();
+
+  const auto& output = *sort->get_output();
+  ASSERT_EQ(output.row_count(), row_count);
+
+  auto previous_value = std::numeric_limits<int32_t>::min();
+  for (ChunkID chunk_id{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto column = output.get_chunk(chunk_id)->get_column(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column->size(); ++chunk_offset) {
+      const auto value = type_cast<int32_t>((*column)[chunk_offset]);
+      EXPECT_LE(previous_value, value);
+      previous_value = value;
+    }
+  }
+}
+
 }  // namespace opossum
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -205,7 +206,7 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
-                                          EncodingType::FrameOfReference),
+                                          EncodingType::FrameOfReference, EncodingType::Delta),
                         formatter);
 
 TEST_P(OperatorsTableScanTest, DoubleScan) {
@@ -494,6 +495,56 @@ TEST_P(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnLargeColumnWithNullValues) {
+  // Covers multiple blocks as well as partial blocks of the block-wise scans of value and dictionary columns
+  auto column_encoding_specs = std::vector<ColumnEncodingSpec>{ColumnEncodingSpec{_encoding_type}};
+  if (_encoding_type == EncodingType::Dictionary) {
+    column_encoding_specs.emplace_back(EncodingType::Dictionary, VectorCompressionType::SimdBp128);
+  }
+
+  const auto row_count = 2500;
+
+  const auto tests = std::vector<std::pair<PredicateCondition, std::function<bool(int)>>>{
+      {PredicateCondition::Equals, [](const int value) { return value == 42; }},
+      {PredicateCondition::NotEquals, [](const int value) { return value != 42; }},
+      {PredicateCondition::LessThan, [](const int value) { return value < 42; }},
+      {PredicateCondition::LessThanEquals, [](const int value) { return value <= 42; }},
+      {PredicateCondition::GreaterThan, [](const int value) { return value > 42; }},
+      {PredicateCondition::GreaterThanEquals, [](const int value) { return value >= 42; }}};
+
+  for (const auto& column_encoding_spec : column_encoding_specs) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+    for (auto row_idx = 0; row_idx < row_count; ++row_idx) {
+      if (row_idx % 7 == 0) {
+        table->append({NULL_VALUE});
+      } else {
+        table->append({row_idx % 100});
+      }
+    }
+
+    ChunkEncoder::encode_all_chunks(table, column_encoding_spec);
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    for (const auto& [predicate_condition, predicate] : tests) {
+      auto expected_row_count = size_t{0};
+      for (auto row_idx = 0; row_idx < row_count; ++row_idx) {
+        if (row_idx % 7 != 0 && predicate(row_idx % 100)) ++expected_row_count;
+      }
+
+      const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, predicate_condition, 42);
+      scan->execute();
+
+      EXPECT_EQ(scan->get_output()->row_count(), expected_row_count);
+    }
+  }
+}
+
 TEST_P(OperatorsTableScanTest, OperatorName) {
   auto scan_1 =
       std::make_shared<opossum::TableScan>(get_table_op(), ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
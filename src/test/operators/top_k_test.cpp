@@ -0,0 +1,113 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest, public ::testing::WithParamInterface<EncodingType> {
+ protected:
+  void SetUp() override {
+    auto table = load_table("src/test/tables/string_int_null_float.tbl", 3);
+    if (GetParam() != EncodingType::Unencoded) ChunkEncoder::encode_all_chunks(table, GetParam());
+
+    _table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    _table_wrapper->execute();
+  }
+
+  // TopK must return the same rows in the same order as a Limit on top of a Sort
+  void test_top_k(const std::shared_ptr<AbstractOperator>& input,
+                  const std::vector<SortColumnDefinition>& sort_definitions, const int64_t k) {
+    auto top_k = std::make_shared<TopK>(input, sort_definitions, to_expression(k), 2u);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, to_expression(k));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+auto top_k_test_formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
+  return std::to_string(static_cast<uint32_t>(info.param));
+};
+
+INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTopKTest,
+                        ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
+                                          EncodingType::RunLength),
+                        top_k_test_formatter);
+
+TEST_P(OperatorsTopKTest, SingleColumn) {
+  for (auto k = int64_t{0}; k <= 9; ++k) {
+    test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, k);
+    test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, k);
+  }
+}
+
+TEST_P(OperatorsTopKTest, SingleColumnWithNulls) {
+  for (auto k = int64_t{0}; k <= 9; ++k) {
+    test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}}, k);
+    test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::AscendingNullsLast}}, k);
+    test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}}, k);
+    test_top_k(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::DescendingNullsLast}}, k);
+  }
+}
+
+TEST_P(OperatorsTopKTest, MultipleColumns) {
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::AscendingNullsLast},
+                                        SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending}};
+
+  for (auto k = int64_t{0}; k <= 9; ++k) {
+    test_top_k(_table_wrapper, sort_definitions, k);
+  }
+}
+
+TEST_P(OperatorsTopKTest, ReferenceColumns) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, PredicateCondition::NotEquals, "ab");
+  scan->execute();
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}};
+
+  for (auto k = int64_t{0}; k <= 6; ++k) {
+    test_top_k(scan, sort_definitions, k);
+  }
+}
+
+TEST_P(OperatorsTopKTest, Expected) {
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::DescendingNullsLast},
+                                        SortColumnDefinition{ColumnID{2}, OrderByMode::Ascending}};
+
+  auto top_k = std::make_shared<TopK>(_table_wrapper, sort_definitions, to_expression(int64_t{3}));
+  top_k->execute();
+
+  const auto& output = top_k->get_output();
+  ASSERT_EQ(output->row_count(), 3u);
+  EXPECT_EQ(output->get_value<std::string>(ColumnID{0}, 0u), "a");
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 1u), 7);
+  EXPECT_EQ(output->get_value<float>(ColumnID{2}, 2u), -0.5f);
+}
+
+}  // namespace opossum
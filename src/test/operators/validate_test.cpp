@@ -12,6 +12,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -80,4 +81,50 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateImmutableChunks) {
+  // Encoding marks the chunks as immutable, which computes the summary of their MVCC columns
+  std::shared_ptr<Table> test_table = load_table("src/test/tables/validate_input.tbl", 2u);
+  set_all_records_visible(*test_table);
+  ChunkEncoder::encode_all_chunks(test_table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(test_table);
+  table_wrapper->execute();
+
+  for (ChunkID chunk_id{0}; chunk_id < test_table->chunk_count(); ++chunk_id) {
+    const auto mvcc_columns = test_table->get_chunk(chunk_id)->get_scoped_mvcc_columns_lock();
+    EXPECT_EQ(mvcc_columns->max_begin_cid.load(), 0u);
+    EXPECT_EQ(mvcc_columns->min_end_cid.load(), MvccColumns::MAX_COMMIT_ID);
+    EXPECT_EQ(mvcc_columns->invalidated_row_count.load(), 0u);
+  }
+
+  auto validate_all = std::make_shared<Validate>(table_wrapper);
+  validate_all->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+  validate_all->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate_all->get_output(), test_table);
+
+  // Invalidate a row like a committed Delete would
+  {
+    auto mvcc_columns = test_table->get_chunk(ChunkID{1})->get_scoped_mvcc_columns_lock();
+    mvcc_columns->end_cids[0] = 2u;
+    mvcc_columns->register_invalidated_row(2u);
+
+    EXPECT_EQ(mvcc_columns->min_end_cid.load(), 2u);
+    EXPECT_EQ(mvcc_columns->invalidated_row_count.load(), 1u);
+  }
+
+  auto validate_before_delete = std::make_shared<Validate>(table_wrapper);
+  validate_before_delete->set_transaction_context(std::make_shared<TransactionContext>(1u, 1u));
+  validate_before_delete->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate_before_delete->get_output(), test_table);
+
+  auto validate_after_delete = std::make_shared<Validate>(table_wrapper);
+  validate_after_delete->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+  validate_after_delete->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate_after_delete->get_output(),
+                            load_table("src/test/tables/validate_output_validated.tbl", 2u));
+}
+
 }  // namespace opossum
@@ -36,6 +36,7 @@
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
@@ -329,22 +330,17 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
-
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
-
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
-
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
+  ASSERT_TRUE(sort);
+  ASSERT_EQ(sort->sort_definitions().size(), 3u);
+  EXPECT_EQ(sort->sort_definitions().at(0).column, ColumnID{1});
+  EXPECT_EQ(sort->sort_definitions().at(0).order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(sort->sort_definitions().at(1).column, ColumnID{0});
+  EXPECT_EQ(sort->sort_definitions().at(1).order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort->sort_definitions().at(2).column, ColumnID{2});
+  EXPECT_EQ(sort->sort_definitions().at(2).order_by_mode, OrderByMode::AscendingNullsLast);
+
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
   ASSERT_TRUE(projection_b);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
@@ -383,6 +379,36 @@ TEST_F(LQPTranslatorTest, JoinNonEqui) {
   EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitAboveSortAsTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC LIMIT 10
+   */
+  // clang-format off
+  const auto limit_node =
+  LimitNode::make(value_(static_cast<int64_t>(10)),
+    SortNode::make(expression_vector(int_float_b), std::vector{OrderByMode::Descending},
+      int_float_node));
+  // clang-format on
+  limit_node->limit_type = LimitType::TopK;
+
+  const auto pqp = LQPTranslator{}.translate_node(limit_node);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  ASSERT_EQ(top_k->sort_definitions().size(), 1u);
+  EXPECT_EQ(top_k->sort_definitions().at(0).column, ColumnID{1});
+  EXPECT_EQ(top_k->sort_definitions().at(0).order_by_mode, OrderByMode::Descending);
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->input_left());
+  ASSERT_TRUE(get_table);
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP
@@ -482,6 +508,38 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScan) {
   EXPECT_EQ(table_scan_op->right_parameter(), AllParameterVariant(42));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanOnParameter) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  std::vector<ColumnID> index_column_ids = {ColumnID{1}};
+  std::vector<ChunkID> index_chunk_ids = {ChunkID{0}, ChunkID{2}};
+  table->get_chunk(index_chunk_ids[0])->create_index<GroupKeyIndex>(index_column_ids);
+  table->get_chunk(index_chunk_ids[1])->create_index<GroupKeyIndex>(index_column_ids);
+
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), parameter_(ParameterID{3})));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP
+   */
+  const auto union_op = std::dynamic_pointer_cast<UnionPositions>(op);
+  ASSERT_TRUE(union_op);
+
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(get_included_chunk_ids(index_scan_op), index_chunk_ids);
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op->input_right());
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(table_scan_op->right_parameter(), AllParameterVariant(ParameterID{3}));
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   /**
    * Build LQP and translate to PQP
@@ -525,6 +583,38 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(table_scan_op2->right_parameter(), AllParameterVariant(42));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanOnReferenceInput) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  // Chunk 1 is not indexed, the IndexScan scans it itself instead of leaving it to a TableScan
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  std::vector<ColumnID> index_column_ids = {ColumnID{1}};
+  table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(index_column_ids);
+  table->get_chunk(ChunkID{2})->create_index<GroupKeyIndex>(index_column_ids);
+
+  auto predicate_node = PredicateNode::make(less_than_(stored_table_node->get_column("a"), 42));
+  predicate_node->set_left_input(stored_table_node);
+  auto predicate_node2 = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42));
+  predicate_node2->set_left_input(predicate_node);
+  predicate_node2->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node2);
+
+  /**
+   * Check PQP
+   */
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_TRUE(get_included_chunk_ids(index_scan_op).empty());
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op->input_left());
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(table_scan_op->left_column_id(), ColumnID{0} /* "a" */);
+  EXPECT_EQ(table_scan_op->predicate_condition(), PredicateCondition::LessThan);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!IS_DEBUG) return;
   /**
@@ -168,4 +168,44 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanOnReferenceInput) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  // Chunks without an index, e.g., the mutable last chunk, are scanned by the IndexScan itself
+  table->append_mutable_chunk();
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(less_than_(b, 15));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_1->set_left_input(predicate_node_0);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoIndexScanOnReferenceInputWithMoreMatchesThanInputRows) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  // Probing the index for all matches in the stored table costs more than scanning the few input rows
+  auto predicate_node_0 = PredicateNode::make(less_than_(b, 1));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(less_than_(a, 1));
+  predicate_node_1->set_left_input(predicate_node_0);
+
+  auto predicate_node_2 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_2->set_left_input(predicate_node_1);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_2);
+  EXPECT_EQ(predicate_node_2->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,69 @@
+#include <memory>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TopKRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}});
+    a = node->get_column("a");
+    b = node->get_column("b");
+
+    rule = std::make_shared<TopKRule>();
+  }
+
+  std::shared_ptr<TopKRule> rule;
+  std::shared_ptr<MockNode> node;
+  LQPColumnReference a, b;
+};
+
+TEST_F(TopKRuleTest, LimitAboveSort) {
+  const auto sort_node =
+      SortNode::make(expression_vector(a, b), std::vector{OrderByMode::Ascending, OrderByMode::Descending});
+  sort_node->set_left_input(node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}));
+  limit_node->set_left_input(sort_node);
+
+  EXPECT_EQ(limit_node->limit_type, LimitType::Limit);
+  StrategyBaseTest::apply_rule(rule, limit_node);
+  EXPECT_EQ(limit_node->limit_type, LimitType::TopK);
+}
+
+TEST_F(TopKRuleTest, LimitWithoutSort) {
+  const auto projection_node = ProjectionNode::make(expression_vector(a));
+  projection_node->set_left_input(node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}));
+  limit_node->set_left_input(projection_node);
+
+  StrategyBaseTest::apply_rule(rule, limit_node);
+  EXPECT_EQ(limit_node->limit_type, LimitType::Limit);
+}
+
+TEST_F(TopKRuleTest, SortWithMultipleOutputs) {
+  // The fully sorted result of the SortNode is also needed by the ProjectionNode
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector{OrderByMode::Ascending});
+  sort_node->set_left_input(node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}));
+  limit_node->set_left_input(sort_node);
+  const auto projection_node = ProjectionNode::make(expression_vector(a));
+  projection_node->set_left_input(sort_node);
+
+  StrategyBaseTest::apply_rule(rule, limit_node);
+  EXPECT_EQ(limit_node->limit_type, LimitType::Limit);
+}
+
+}  // namespace opossum
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -10,7 +15,11 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/resource_group_manager.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/work_stealing_deque.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -185,6 +194,110 @@ TEST_F(SchedulerTest, DiamondDependenciesWithoutScheduler) {
   ASSERT_EQ(counter, 7u);
 }
 
+TEST_F(SchedulerTest, ParkedWorkerIsWokenByPush) {
+  auto queue = std::make_shared<TaskQueue>(NodeID{0});
+
+  const auto start = std::chrono::steady_clock::now();
+  auto pusher = std::thread([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue->push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Default));
+  });
+
+  // Would block for the whole timeout if the push did not wake the parked worker
+  queue->park_worker(std::chrono::seconds(10));
+  pusher.join();
+
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  EXPECT_NE(queue->pull(), nullptr);
+
+  // Parking on a non-empty queue returns immediately
+  queue->push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Default));
+  queue->park_worker(std::chrono::seconds(10));
+  EXPECT_FALSE(queue->empty());
+}
+
+TEST_F(SchedulerTest, WorkStealingDequeOrder) {
+  auto deque = WorkStealingDeque{2};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0; index < 5; ++index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    deque.push(tasks.back());
+  }
+
+  // The deque grew beyond its initial capacity
+  EXPECT_EQ(deque.size(), 5u);
+
+  // The owner takes the most recent task, thieves take the oldest one
+  EXPECT_EQ(deque.pop(), tasks[4]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(SchedulerTest, WorkStealingDequeConcurrentSteal) {
+  constexpr auto num_tasks = 10'000u;
+
+  auto deque = WorkStealingDeque{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0u; index < num_tasks; ++index) tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+
+  // Each task must be taken exactly once, either by the owner or by one of the thieves
+  auto taken = std::vector<std::vector<AbstractTask*>>(4);
+  auto owner_done = std::atomic_bool{false};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_index = size_t{1}; thief_index < taken.size(); ++thief_index) {
+    thieves.emplace_back([&, thief_index]() {
+      while (!owner_done || !deque.empty()) {
+        if (auto task = deque.steal()) taken[thief_index].emplace_back(task.get());
+      }
+    });
+  }
+
+  for (auto index = 0u; index < num_tasks; ++index) {
+    deque.push(tasks[index]);
+    if (index % 3 == 0) {
+      if (auto task = deque.pop()) taken[0].emplace_back(task.get());
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) thief.join();
+
+  auto all_taken = std::vector<AbstractTask*>{};
+  for (const auto& taken_by_thread : taken) {
+    all_taken.insert(all_taken.end(), taken_by_thread.cbegin(), taken_by_thread.cend());
+  }
+  std::sort(all_taken.begin(), all_taken.end());
+
+  auto expected = std::vector<AbstractTask*>{};
+  for (const auto& task : tasks) expected.emplace_back(task.get());
+  std::sort(expected.begin(), expected.end());
+
+  EXPECT_EQ(all_taken, expected);
+}
+
+TEST_F(SchedulerTest, NodesByDistance) {
+  Topology::use_fake_numa_topology(8, 2);
+
+  const auto num_nodes = Topology::get().nodes().size();
+  for (auto node_id = NodeID{0}; node_id < num_nodes; ++node_id) {
+    const auto node_ids = Topology::get().nodes_by_distance(node_id);
+
+    ASSERT_EQ(node_ids.size(), num_nodes - 1);
+    EXPECT_EQ(std::count(node_ids.cbegin(), node_ids.cend(), node_id), 0);
+    if (!node_ids.empty()) {
+      EXPECT_EQ(node_ids.front(), NodeID{static_cast<uint32_t>((node_id + 1) % num_nodes)});
+    }
+  }
+}
+
 TEST_F(SchedulerTest, MultipleOperators) {
   Topology::use_fake_numa_topology(8, 4);
   CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
@@ -208,4 +321,118 @@ TEST_F(SchedulerTest, MultipleOperators) {
   EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
 }
 
+TEST_F(SchedulerTest, ResourceGroupLimitsConcurrentTasks) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto resource_group = std::make_shared<ResourceGroup>("batch", 1, 2);
+  std::atomic_uint max_active_tasks{0};
+  std::atomic_uint num_executed_jobs{0};
+
+  const auto job = [&]() {
+    const auto active_tasks = static_cast<uint32_t>(resource_group->num_active_tasks());
+    auto previous_max = max_active_tasks.load();
+    while (previous_max < active_tasks && !max_active_tasks.compare_exchange_weak(previous_max, active_tasks)) {
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    ++num_executed_jobs;
+  };
+
+  // The JobTasks inherit the ResourceGroup of the task that schedules them. That task has to give up its slot while it
+  // waits for them, otherwise the group would deadlock.
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0; task_index < 4; ++task_index) {
+    auto task = std::make_shared<JobTask>([&]() {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto job_index = 0; job_index < 10; ++job_index) {
+        jobs.emplace_back(std::make_shared<JobTask>(job));
+        jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(jobs);
+    });
+    task->set_resource_group(resource_group);
+    tasks.emplace_back(task);
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(num_executed_jobs, 40u);
+  EXPECT_GE(max_active_tasks, 1u);
+  EXPECT_LE(max_active_tasks, 2u);
+  EXPECT_EQ(resource_group->num_active_tasks(), 0u);
+  EXPECT_EQ(resource_group->num_waiting_tasks(), 0u);
+  EXPECT_EQ(ResourceGroupManager::get().num_active_tasks(), 0u);
+}
+
+TEST_F(SchedulerTest, ResourceGroupsShareWorkersByWeight) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  ResourceGroupManager::get().set_max_active_tasks(1);
+
+  // Occupy the only slot until the tasks of both groups wait
+  std::atomic_bool blocker_released{false};
+  auto blocker = std::make_shared<JobTask>([&]() {
+    while (!blocker_released) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  });
+  blocker->set_resource_group(std::make_shared<ResourceGroup>("blocker"));
+  blocker->schedule();
+
+  std::mutex execution_order_mutex;
+  auto execution_order = std::vector<std::string>{};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  const auto light_group = std::make_shared<ResourceGroup>("light", 1);
+  const auto heavy_group = std::make_shared<ResourceGroup>("heavy", 4);
+  for (const auto& resource_group : {light_group, heavy_group}) {
+    for (auto task_index = 0; task_index < 12; ++task_index) {
+      auto task = std::make_shared<JobTask>([&, resource_group]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard<std::mutex> lock(execution_order_mutex);
+        execution_order.emplace_back(resource_group->name());
+      });
+      task->set_resource_group(resource_group);
+      task->schedule();
+      tasks.emplace_back(task);
+    }
+  }
+
+  EXPECT_EQ(ResourceGroupManager::get().num_active_tasks(), 1u);
+  blocker_released = true;
+  CurrentScheduler::wait_for_tasks(tasks);
+  CurrentScheduler::get()->finish();
+
+  // Although all tasks of the light group became ready first, the heavy group gets about four times the execution time
+  ASSERT_EQ(execution_order.size(), 24u);
+  EXPECT_GE(std::count(execution_order.cbegin(), execution_order.cbegin() + 10, "heavy"), 6);
+}
+
+TEST_F(SchedulerTest, QueryAdmission) {
+  auto& manager = ResourceGroupManager::get();
+
+  // Every process uses more than one byte, so the system is overloaded
+  manager.set_max_memory_usage(1);
+  EXPECT_TRUE(manager.is_overloaded());
+
+  // A query is admitted if no other query is running, no matter the load
+  manager.admit_query();
+  EXPECT_EQ(manager.num_running_queries(), 1u);
+
+  std::atomic_bool second_query_admitted{false};
+  auto second_query = std::thread([&]() {
+    manager.admit_query();
+    second_query_admitted = true;
+    manager.finish_query();
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(second_query_admitted);
+
+  manager.finish_query();
+  second_query.join();
+  EXPECT_TRUE(second_query_admitted);
+  EXPECT_EQ(manager.num_running_queries(), 0u);
+
+  manager.set_max_memory_usage(0);
+  EXPECT_FALSE(manager.is_overloaded());
+}
+
 }  // namespace opossum
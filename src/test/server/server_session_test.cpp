@@ -245,6 +245,52 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionExecutesStatementsInItsResourceGroup) {
+  StorageManager::get().add_table("foo", load_table("src/test/tables/int.tbl", 10));
+
+  InSequence s;
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SELECT * FROM foo;")))));
+
+  // The pipeline is created for real, so that we can check the ResourceGroup of its tasks
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Invoke([&](std::shared_ptr<CreatePipelineTask> task) {
+        task->execute();
+        auto result = task->get_future().get();
+
+        for (const auto& statement_tasks : result->sql_pipeline->get_tasks()) {
+          for (const auto& operator_task : statement_tasks) {
+            EXPECT_EQ(operator_task->resource_group(), _session->resource_group());
+          }
+        }
+
+        return boost::make_ready_future(std::move(result));
+      }));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+
+  // Each session has a group of its own
+  const auto other_session = std::make_shared<TestServerSession>(_connection, _task_runner);
+  ASSERT_NE(_session->resource_group(), nullptr);
+  EXPECT_NE(other_session->resource_group(), _session->resource_group());
+}
+
+TEST_F(ServerSessionTest, SessionResourceGroupIsConfigurable) {
+  const auto session = std::make_shared<TestServerSession>(_connection, _task_runner, SessionResourceGroupConfig{4, 2});
+  EXPECT_EQ(session->resource_group()->weight(), 4u);
+  EXPECT_EQ(session->resource_group()->max_concurrent_tasks(), 2u);
+
+  // By default, sessions are not limited
+  EXPECT_EQ(_session->resource_group()->weight(), 1u);
+  EXPECT_EQ(_session->resource_group()->max_concurrent_tasks(), 0u);
+}
+
 TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   InSequence s;
 
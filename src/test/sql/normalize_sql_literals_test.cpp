@@ -0,0 +1,94 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "SQLParser.h"
+#include "SQLParserResult.h"
+
+#include "sql/normalize_sql_literals.hpp"
+
+namespace opossum {
+
+class NormalizeSQLLiteralsTest : public BaseTest {
+ protected:
+  bool placeholders_are_scan_values(const std::string& sql, const size_t num_placeholders) {
+    hsql::SQLParserResult parser_result;
+    hsql::SQLParser::parseSQLString(sql, &parser_result);
+    EXPECT_TRUE(parser_result.isValid());
+
+    return value_placeholders_are_scan_values(*parser_result.getStatement(0), num_placeholders);
+  }
+};
+
+TEST_F(NormalizeSQLLiteralsTest, ReplacesLiterals) {
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE a = 5 AND b = 'x'");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a = ? AND b = ?");
+  ASSERT_EQ(normalized_sql->literals.size(), 2u);
+  EXPECT_EQ(normalized_sql->literals[0], AllTypeVariant{int32_t{5}});
+  EXPECT_EQ(normalized_sql->literals[1], AllTypeVariant{std::string{"x"}});
+}
+
+TEST_F(NormalizeSQLLiteralsTest, LiteralTypes) {
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE a > 1.5 AND b < 3000000000 AND c = ''");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a > ? AND b < ? AND c = ?");
+  ASSERT_EQ(normalized_sql->literals.size(), 3u);
+  EXPECT_EQ(normalized_sql->literals[0], AllTypeVariant{1.5});
+  EXPECT_EQ(normalized_sql->literals[1], AllTypeVariant{int64_t{3'000'000'000}});
+  EXPECT_EQ(normalized_sql->literals[2], AllTypeVariant{std::string{}});
+}
+
+TEST_F(NormalizeSQLLiteralsTest, KeepsNonLiterals) {
+  const auto normalized_sql = normalize_sql_literals(
+      "SELECT \"col 5\" FROM t1 -- 42\n"
+      "WHERE a = 1e5 AND b = .5 AND c = 'it''s' AND d = 'back\\slash' /* 7 */ AND e = 3");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql,
+            "SELECT \"col 5\" FROM t1 -- 42\n"
+            "WHERE a = 1e5 AND b = .5 AND c = 'it''s' AND d = 'back\\slash' /* 7 */ AND e = ?");
+  ASSERT_EQ(normalized_sql->literals.size(), 1u);
+  EXPECT_EQ(normalized_sql->literals[0], AllTypeVariant{int32_t{3}});
+}
+
+TEST_F(NormalizeSQLLiteralsTest, KeepsNegativeNumbers) {
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE a = -5 AND b > 3 AND c < a - 2.5");
+  ASSERT_TRUE(normalized_sql);
+
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a = -5 AND b > ? AND c < a - 2.5");
+  ASSERT_EQ(normalized_sql->literals.size(), 1u);
+  EXPECT_EQ(normalized_sql->literals[0], AllTypeVariant{int32_t{3}});
+
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = - 5"));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, NothingToNormalize) {
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t1 WHERE a = b"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = ? AND b = 5"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = 99999999999999999999"));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, ScanValues) {
+  EXPECT_TRUE(placeholders_are_scan_values("SELECT * FROM t WHERE a = ? AND ? < b", 2));
+  EXPECT_TRUE(placeholders_are_scan_values("SELECT * FROM t WHERE a BETWEEN ? AND ? OR b LIKE ?", 3));
+  EXPECT_TRUE(placeholders_are_scan_values("SELECT * FROM (SELECT * FROM t WHERE a = ?) AS s WHERE b > ?", 2));
+  EXPECT_TRUE(placeholders_are_scan_values("SELECT * FROM t WHERE a IN (SELECT b FROM u WHERE c <> ?)", 1));
+  EXPECT_TRUE(placeholders_are_scan_values("DELETE FROM t WHERE a = ?", 1));
+  EXPECT_TRUE(placeholders_are_scan_values("UPDATE t SET a = b WHERE b >= ?", 1));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, NoScanValues) {
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT a + ? FROM t WHERE a = ?", 2));
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT * FROM t WHERE a + ? > b", 1));
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT * FROM t WHERE a IN (?, ?)", 2));
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT * FROM t WHERE ? = ?", 2));
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT * FROM t JOIN u ON t.a = ? AND t.b = u.b", 1));
+  EXPECT_FALSE(placeholders_are_scan_values("INSERT INTO t VALUES (?, ?)", 2));
+  EXPECT_FALSE(placeholders_are_scan_values("UPDATE t SET a = ? WHERE b = ?", 2));
+}
+
+}  // namespace opossum
@@ -14,6 +14,7 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -411,6 +412,23 @@ TEST_F(SQLPipelineTest, DisabledCleanupWithScheduler) {
   }
 }
 
+TEST_F(SQLPipelineTest, GetResultTableWithResourceGroup) {
+  const auto resource_group = std::make_shared<ResourceGroup>("dashboard", 8, 2);
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_resource_group(resource_group).create_pipeline();
+
+  for (const auto& task : sql_pipeline.get_tasks()[0]) {
+    EXPECT_EQ(task->resource_group(), resource_group);
+  }
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto& table = sql_pipeline.get_result_table();
+
+  EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+  EXPECT_EQ(resource_group->num_active_tasks(), 0u);
+  EXPECT_EQ(resource_group->num_waiting_tasks(), 0u);
+}
+
 TEST_F(SQLPipelineTest, GetResultTableBadQuery) {
   auto sql = "SELECT a + not_a_column FROM table_a";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
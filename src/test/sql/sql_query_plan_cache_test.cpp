@@ -1,9 +1,11 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
+#include "operators/abstract_operator.hpp"
 #include "sql/gdfs_cache.hpp"
 #include "sql/lru_cache.hpp"
 #include "sql/lru_k_cache.hpp"
@@ -11,6 +13,8 @@
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -38,10 +42,24 @@ class SQLQueryPlanCacheTest : public BaseTest {
     }
   }
 
+  size_t result_row_count(const std::string& query) {
+    auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+    const auto row_count = pipeline_statement.get_result_table()->row_count();
+
+    if (pipeline_statement.metrics()->query_plan_cache_hit) {
+      _query_plan_cache_hits++;
+    }
+
+    return row_count;
+  }
+
   const std::string Q1 = "SELECT * FROM table_a;";
   const std::string Q2 = "SELECT * FROM table_b;";
   const std::string Q3 = "SELECT * FROM table_a WHERE a > 1;";
 
+  // Q3 shares its plan with all statements that only differ in its literal
+  const std::string Q3_PLAN_KEY = "SELECT * FROM table_a WHERE a > ?;";
+
   size_t _query_plan_cache_hits;
 };
 
@@ -90,7 +108,7 @@ TEST_F(SQLQueryPlanCacheTest, AutomaticQueryOperatorCacheLRU) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(Q3_PLAN_KEY));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
@@ -120,7 +138,7 @@ TEST_F(SQLQueryPlanCacheTest, AutomaticQueryOperatorCacheGDFS) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(Q3_PLAN_KEY));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
@@ -147,11 +165,118 @@ TEST_F(SQLQueryPlanCacheTest, AutomaticQueryOperatorCacheLRUK2) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(Q3_PLAN_KEY));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
   EXPECT_EQ(5u, _query_plan_cache_hits);
 }
 
+// Statements that only differ in the values they scan for share a plan.
+TEST_F(SQLQueryPlanCacheTest, ParameterizedPlan) {
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+
+  EXPECT_EQ(result_row_count(Q3), 3u);                                       // Miss.
+  EXPECT_EQ(result_row_count("SELECT * FROM table_a WHERE a > 200;"), 2u);   // Hit.
+  EXPECT_EQ(result_row_count("SELECT * FROM table_a WHERE a > 1300;"), 1u);  // Hit.
+  EXPECT_EQ(result_row_count(Q3), 3u);                                       // Hit.
+
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_TRUE(cache.has(Q3_PLAN_KEY));
+  EXPECT_FALSE(cache.has(Q3));
+
+  EXPECT_EQ(3u, _query_plan_cache_hits);
+}
+
+// Literals that are not scanned for can change the plan, so statements with them are cached by their SQL string.
+TEST_F(SQLQueryPlanCacheTest, NotParameterizedPlan) {
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+
+  const auto query_a = std::string{"SELECT a + 1 FROM table_a WHERE a > 1;"};
+  const auto query_b = std::string{"SELECT a + 2 FROM table_a WHERE a > 1;"};
+  const auto query_c = std::string{"SELECT * FROM table_a WHERE a > 1 LIMIT 1;"};
+
+  EXPECT_EQ(result_row_count(query_a), 3u);  // Miss.
+  EXPECT_EQ(result_row_count(query_b), 3u);  // Miss.
+  EXPECT_EQ(result_row_count(query_c), 1u);  // Miss.
+  EXPECT_EQ(result_row_count(query_a), 3u);  // Hit.
+
+  // Empty plans remember that the normalized SQL strings cannot be parameterized
+  EXPECT_EQ(cache.size(), 5u);
+  EXPECT_TRUE(cache.has(query_a));
+  EXPECT_TRUE(cache.has(query_b));
+  EXPECT_TRUE(cache.has(query_c));
+  EXPECT_TRUE(cache.get("SELECT a + ? FROM table_a WHERE a > ?;").tree_roots().empty());
+  EXPECT_TRUE(cache.get("SELECT * FROM table_a WHERE a > ? LIMIT ?;").tree_roots().empty());
+
+  EXPECT_EQ(1u, _query_plan_cache_hits);
+}
+
+// Statements whose values are far more selective than the optimizer assumed for the shared plan get their own plan.
+TEST_F(SQLQueryPlanCacheTest, ParameterSniffing) {
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  auto table_c = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    table_c->append({value});
+  }
+  StorageManager::get().add_table("table_c", table_c);
+
+  const auto selective_query = std::string{"SELECT * FROM table_c WHERE a < 1;"};
+
+  EXPECT_EQ(result_row_count("SELECT * FROM table_c WHERE a < 5000;"), 5'000u);  // Miss.
+  EXPECT_EQ(result_row_count("SELECT * FROM table_c WHERE a < 7000;"), 7'000u);  // Hit.
+  EXPECT_EQ(result_row_count(selective_query), 1u);                              // Miss.
+  EXPECT_EQ(result_row_count(selective_query), 1u);                              // Hit.
+
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_TRUE(cache.has("SELECT * FROM table_c WHERE a < ?;"));
+  EXPECT_TRUE(cache.has(selective_query));
+
+  EXPECT_EQ(2u, _query_plan_cache_hits);
+}
+
+// Point lookups on an indexed column share a plan in which the IndexScan is bound to the literal of each statement
+TEST_F(SQLQueryPlanCacheTest, ParameterizedIndexScan) {
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  auto table_d = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    table_d->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table_d);
+
+  // The last chunk is not indexed and is scanned by a TableScan instead
+  for (ChunkID chunk_id{0}; chunk_id + 1u < table_d->chunk_count(); ++chunk_id) {
+    table_d->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  StorageManager::get().add_table("table_d", table_d);
+
+  EXPECT_EQ(result_row_count("SELECT * FROM table_d WHERE a = 42;"), 1u);     // Miss.
+  EXPECT_EQ(result_row_count("SELECT * FROM table_d WHERE a = 9999;"), 1u);   // Hit.
+  EXPECT_EQ(result_row_count("SELECT * FROM table_d WHERE a = 10000;"), 0u);  // Hit.
+  EXPECT_EQ(result_row_count("SELECT * FROM table_d WHERE a = 42;"), 1u);     // Hit.
+
+  EXPECT_EQ(cache.size(), 1u);
+  ASSERT_TRUE(cache.has("SELECT * FROM table_d WHERE a = ?;"));
+  EXPECT_EQ(3u, _query_plan_cache_hits);
+
+  auto has_index_scan = false;
+  auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{
+      cache.get("SELECT * FROM table_d WHERE a = ?;").tree_roots().front()};
+  while (!operators.empty()) {
+    const auto op = operators.back();
+    operators.pop_back();
+
+    has_index_scan |= op->type() == OperatorType::IndexScan;
+    if (op->input_left()) operators.emplace_back(op->input_left());
+    if (op->input_right()) operators.emplace_back(op->input_right());
+  }
+  EXPECT_TRUE(has_index_scan);
+}
+
 }  // namespace opossum
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <random>
 #include <set>
@@ -13,6 +14,8 @@
 
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_nodes.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
 
 namespace opossum {
 
@@ -143,4 +146,97 @@ TEST_F(AdaptiveRadixTreeIndexTest, VectorOfRandomInts) {
   EXPECT_EQ(index->upper_bound({99999}), index->cend());
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, BinaryComparableOrder) {
+  const auto expect_ordered = [](const auto& sorted_values) {
+    for (auto value_id = size_t{1}; value_id < sorted_values.size(); ++value_id) {
+      const auto smaller = AdaptiveRadixTreeIndex::BinaryComparable(sorted_values[value_id - 1]);
+      const auto larger = AdaptiveRadixTreeIndex::BinaryComparable(sorted_values[value_id]);
+      EXPECT_TRUE(smaller < larger) << value_id;
+      EXPECT_FALSE(larger < smaller) << value_id;
+    }
+  };
+
+  expect_ordered(std::vector<int32_t>{std::numeric_limits<int32_t>::min(), -256, -1, 0, 1, 255, 256,
+                                      std::numeric_limits<int32_t>::max()});
+  expect_ordered(std::vector<int64_t>{std::numeric_limits<int64_t>::min(), -(int64_t{1} << 40), -1, 0, 1,
+                                      int64_t{1} << 40, std::numeric_limits<int64_t>::max()});
+  expect_ordered(std::vector<float>{-std::numeric_limits<float>::infinity(), -3.5f, -1.0f, -0.25f, 0.0f, 0.25f, 1.0f,
+                                    3.5f, std::numeric_limits<float>::infinity()});
+  expect_ordered(std::vector<double>{std::numeric_limits<double>::lowest(), -1e100, -1.0, -1e-100, 0.0, 1e-100, 1.0,
+                                     1e100, std::numeric_limits<double>::max()});
+  expect_ordered(std::vector<std::string>{"", std::string(1, '\0'), std::string("a\0", 2), "a", "a\x01", "ab", "b",
+                                          "\xff"});
+
+  EXPECT_EQ(AdaptiveRadixTreeIndex::BinaryComparable(-0.0f), AdaptiveRadixTreeIndex::BinaryComparable(0.0f));
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, ValueColumnWithNulls) {
+  auto values = std::vector<int32_t>{30, -5, 0, 30, 7, -300, 1000};
+  auto null_values = std::vector<bool>{false, false, true, false, false, false, true};
+  auto column = std::make_shared<ValueColumn<int32_t>>(values, null_values);
+  auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseColumn>>({column}));
+
+  // NULLs are not indexed, all other rows are ordered by their values
+  EXPECT_EQ(std::vector<ChunkOffset>(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{5, 1, 4, 0, 3}));
+
+  // Search values do not need to be contained in the column
+  EXPECT_EQ(index->lower_bound({-300}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({-301}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({-4}), index->cbegin() + 2);
+  EXPECT_EQ(index->upper_bound({-5}), index->cbegin() + 2);
+  EXPECT_EQ(index->lower_bound({8}), index->cbegin() + 3);
+  EXPECT_EQ(index->upper_bound({30}), index->cend());
+  EXPECT_EQ(index->lower_bound({31}), index->cend());
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, VectorOfRandomDoubles) {
+  std::vector<double> doubles(10001);
+  for (auto i = 0u; i < doubles.size(); ++i) {
+    doubles[i] = (static_cast<double>(i) - 5000.0) * 0.5;
+  }
+
+  std::random_device rd;
+  std::mt19937 random_generator(rd());
+  std::shuffle(doubles.begin(), doubles.end(), random_generator);
+
+  auto column = std::make_shared<ValueColumn<double>>(doubles);
+  auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseColumn>>({column}));
+
+  for (auto value : {-2500.0, -1000.0, -0.5, 0.0, 0.5, 1.0, 512.0, 2499.5}) {
+    EXPECT_EQ((*column)[*index->lower_bound({value})], AllTypeVariant{value});
+    EXPECT_EQ((*column)[*index->lower_bound({value + 0.25})], AllTypeVariant{value + 0.5});
+    EXPECT_EQ((*column)[*index->upper_bound({value - 0.25})], AllTypeVariant{value});
+    EXPECT_EQ(std::distance(index->lower_bound({value}), index->upper_bound({value})), 1);
+  }
+  EXPECT_EQ(std::distance(index->lower_bound({-10.0}), index->upper_bound({10.0})), 41);
+  EXPECT_EQ(index->upper_bound({2500.0}), index->cend());
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, PrefixRange) {
+  const auto strings =
+      std::vector<std::string>{"apple", "banana", "bandana", "ban", "band", "bank", "ba\xff", "ba\xff\xff", "bb", "c"};
+
+  auto value_column = std::make_shared<ValueColumn<std::string>>(tbb::concurrent_vector<std::string>{
+      strings.begin(), strings.end()});
+  auto dictionary_column = create_dict_column_by_type<std::string>(DataType::String, strings);
+
+  for (const auto& column : std::vector<std::shared_ptr<const BaseColumn>>{value_column, dictionary_column}) {
+    auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseColumn>>({column}));
+
+    const auto matches = [&](const std::string& prefix) {
+      const auto range = index->prefix_range(prefix);
+      auto result = std::vector<std::string>{};
+      for (auto it = range.first; it != range.second; ++it) result.emplace_back(type_cast<std::string>((*column)[*it]));
+      return result;
+    };
+
+    EXPECT_EQ(matches("ban"), (std::vector<std::string>{"ban", "banana", "band", "bandana", "bank"}));
+    EXPECT_EQ(matches("band"), (std::vector<std::string>{"band", "bandana"}));
+    EXPECT_EQ(matches("bx"), std::vector<std::string>{});
+    EXPECT_EQ(matches("ba\xff"), (std::vector<std::string>{"ba\xff", "ba\xff\xff"}));
+    EXPECT_EQ(matches("c"), std::vector<std::string>{"c"});
+    EXPECT_EQ(matches("").size(), strings.size());
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,68 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/background_chunk_encoder.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class BackgroundChunkEncoderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/25_ints_sorted.tbl", 10);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  bool _is_encoded(const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<const BaseEncodedColumn>(_table->get_chunk(chunk_id)->get_column(ColumnID{0})) !=
+           nullptr;
+  }
+
+  std::shared_ptr<Table> _table;
+  BackgroundChunkEncoder _encoder;
+};
+
+TEST_F(BackgroundChunkEncoderTest, EncodesCompletedChunks) {
+  const auto expected = load_table("src/test/tables/25_ints_sorted.tbl", 10);
+
+  EXPECT_EQ(_encoder.encode_completed_chunks(), 2u);
+  EXPECT_TRUE(_is_encoded(ChunkID{0}));
+  EXPECT_TRUE(_is_encoded(ChunkID{1}));
+  EXPECT_FALSE(_is_encoded(ChunkID{2}));
+  EXPECT_TABLE_EQ_ORDERED(_table, expected);
+
+  // Encoded chunks are not encoded again
+  EXPECT_EQ(_encoder.encode_completed_chunks(), 0u);
+}
+
+TEST_F(BackgroundChunkEncoderTest, WaitsForUncommittedRows) {
+  auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  for (auto value = 26; value <= 30; ++value) values->append({value});
+  auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  // The last chunk is full, but its new rows are not committed yet
+  EXPECT_EQ(_encoder.encode_completed_chunks(), 2u);
+  EXPECT_FALSE(_is_encoded(ChunkID{2}));
+
+  context->commit();
+  EXPECT_EQ(_encoder.encode_completed_chunks(), 1u);
+  EXPECT_TRUE(_is_encoded(ChunkID{2}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/column_encoding_utils.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/delta_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageDeltaColumnTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::shared_ptr<DeltaColumn<T>> _encode(const std::shared_ptr<ValueColumn<T>>& value_column) {
+    const auto data_type = std::is_same_v<T, int32_t> ? DataType::Int : DataType::Long;
+    return std::dynamic_pointer_cast<DeltaColumn<T>>(encode_column(EncodingType::Delta, data_type, value_column));
+  }
+
+  template <typename T>
+  void _expect_equal_values(const ValueColumn<T>& value_column, const DeltaColumn<T>& delta_column) {
+    ASSERT_EQ(value_column.size(), delta_column.size());
+
+    auto iterable = create_iterable_from_column(delta_column);
+    iterable.for_each([&](const auto& column_value) {
+      const auto chunk_offset = column_value.chunk_offset();
+      ASSERT_EQ(value_column.is_null(chunk_offset), column_value.is_null());
+      if (!column_value.is_null()) {
+        EXPECT_EQ(value_column.values()[chunk_offset], column_value.value());
+      }
+    });
+  }
+};
+
+TEST_F(StorageDeltaColumnTest, ConstantStrideNeedsNoBits) {
+  auto values = pmr_concurrent_vector<int64_t>{};
+  for (auto index = int64_t{0}; index < 1'000; ++index) values.push_back(1'500'000'000'000 + index * 1'000);
+
+  auto value_column = std::make_shared<ValueColumn<int64_t>>(std::move(values));
+  auto delta_column = _encode(value_column);
+
+  ASSERT_NE(delta_column, nullptr);
+  EXPECT_EQ(delta_column->block_bit_sizes().size(), 8u);
+  EXPECT_TRUE(delta_column->packed_deltas().empty());
+  EXPECT_EQ(delta_column->block_min_deltas()[0], 1'000);
+
+  _expect_equal_values(*value_column, *delta_column);
+  EXPECT_EQ((*delta_column)[999], AllTypeVariant{int64_t{1'500'000'999'000}});
+}
+
+TEST_F(StorageDeltaColumnTest, DecreasingAndExtremeValues) {
+  auto values = pmr_concurrent_vector<int32_t>{};
+  for (auto index = 0; index < 300; ++index) {
+    values.push_back(index % 2 ? std::numeric_limits<int32_t>::max() : std::numeric_limits<int32_t>::min());
+  }
+  values[150] = 0;
+
+  auto value_column = std::make_shared<ValueColumn<int32_t>>(std::move(values));
+  auto delta_column = _encode(value_column);
+
+  ASSERT_NE(delta_column, nullptr);
+  _expect_equal_values(*value_column, *delta_column);
+}
+
+TEST_F(StorageDeltaColumnTest, NullValues) {
+  auto values = pmr_concurrent_vector<int64_t>{};
+  auto null_values = pmr_concurrent_vector<bool>{};
+  for (auto index = int64_t{0}; index < 500; ++index) {
+    values.push_back(std::numeric_limits<int64_t>::max() - 500 + index);
+    // Leading null values must not produce a delta to zero that does not fit into 32 bits
+    null_values.push_back(index < 3 || index % 7 == 0);
+  }
+
+  auto value_column = std::make_shared<ValueColumn<int64_t>>(std::move(values), std::move(null_values));
+  auto delta_column = _encode(value_column);
+
+  ASSERT_NE(delta_column, nullptr);
+  _expect_equal_values(*value_column, *delta_column);
+  EXPECT_TRUE(variant_is_null((*delta_column)[0]));
+}
+
+TEST_F(StorageDeltaColumnTest, PointAccess) {
+  auto values = pmr_concurrent_vector<int32_t>{};
+  for (auto index = 0; index < 1'000; ++index) values.push_back(index * index);
+
+  auto value_column = std::make_shared<ValueColumn<int32_t>>(std::move(values));
+  auto delta_column = _encode(value_column);
+  ASSERT_NE(delta_column, nullptr);
+
+  auto chunk_offsets = ChunkOffsetsList{};
+  for (auto index = 0u; index < 100u; ++index) {
+    chunk_offsets.push_back({index, static_cast<ChunkOffset>((index * 389u) % 1'000u)});
+  }
+
+  auto iterable = create_iterable_from_column(*delta_column);
+  iterable.with_iterators(&chunk_offsets, [&](auto it, auto end) {
+    for (auto index = 0u; it != end; ++it, ++index) {
+      const auto into_referenced = static_cast<int32_t>(chunk_offsets[index].into_referenced);
+      EXPECT_EQ((*it).value(), into_referenced * into_referenced);
+    }
+  });
+}
+
+}  // namespace opossum
@@ -35,6 +35,9 @@ class EncodedColumnTest : public BaseTestWithParam<ColumnEncodingSpec> {
       case EncodingType::FrameOfReference:
         // fill three blocks and a bit more
         return FrameOfReferenceColumn<int32_t>::block_size * (3.3);
+      case EncodingType::Delta:
+        // fill three blocks and a bit more
+        return DeltaColumn<int32_t>::block_size * (3.3);
       default:
         return default_row_count;
     }
@@ -124,7 +127,7 @@ INSTANTIATE_TEST_CASE_P(
                       ColumnEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
                       ColumnEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
                       ColumnEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedSizeByteAligned},
-                      ColumnEncodingSpec{EncodingType::RunLength}),
+                      ColumnEncodingSpec{EncodingType::RunLength}, ColumnEncodingSpec{EncodingType::Delta}),
     formatter);
 
 TEST_P(EncodedColumnTest, SequentiallyReadNotNullableIntColumn) {
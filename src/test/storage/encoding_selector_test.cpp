@@ -0,0 +1,104 @@
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_selector.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class EncodingSelectorTest : public BaseTest {
+ protected:
+  template <typename T>
+  ColumnEncodingSpec _select(std::vector<T> values, const bool is_frequently_accessed = true) {
+    const auto data_type = data_type_from_type<T>();
+    const auto column = ValueColumn<T>{values};
+    return EncodingSelector::select_column_encoding(data_type, column, is_frequently_accessed);
+  }
+};
+
+TEST_F(EncodingSelectorTest, LongRunsUseRunLength) {
+  auto values = std::vector<int32_t>{};
+  for (auto index = 0; index < 100; ++index) values.push_back(index / 20);
+
+  const auto spec = _select(values);
+  EXPECT_EQ(spec.encoding_type, EncodingType::RunLength);
+  EXPECT_FALSE(spec.vector_compression_type);
+}
+
+TEST_F(EncodingSelectorTest, SortedIntegersUseDelta) {
+  auto values = std::vector<int64_t>{};
+  for (auto index = int64_t{0}; index < 100; ++index) values.push_back(1'500'000'000'000 + index * 1'000);
+  values[50] -= 5'000;
+
+  const auto spec = _select(values);
+  EXPECT_EQ(spec.encoding_type, EncodingType::Delta);
+  EXPECT_FALSE(spec.vector_compression_type);
+}
+
+TEST_F(EncodingSelectorTest, DistinctIntegersUseFrameOfReference) {
+  auto values = std::vector<int64_t>{};
+  for (auto index = int64_t{0}; index < 100; ++index) values.push_back(index * 37 % 100);
+
+  EXPECT_EQ(_select(values).encoding_type, EncodingType::FrameOfReference);
+}
+
+TEST_F(EncodingSelectorTest, WideValueRangesUseDictionary) {
+  auto values = std::vector<int64_t>{};
+  for (auto index = int64_t{0}; index < 100; ++index) {
+    values.push_back(index % 2 ? std::numeric_limits<int64_t>::max() - index : index);
+  }
+
+  EXPECT_EQ(_select(values).encoding_type, EncodingType::Dictionary);
+}
+
+TEST_F(EncodingSelectorTest, RepeatedValuesUseDictionary) {
+  auto values = std::vector<int32_t>{};
+  for (auto index = 0; index < 100; ++index) values.push_back(index % 3);
+
+  EXPECT_EQ(_select(values).encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(_select(std::vector<float>{1.0f, 2.0f, 1.0f, 2.0f}).encoding_type, EncodingType::Dictionary);
+}
+
+TEST_F(EncodingSelectorTest, SimilarStringLengthsUseFixedStringDictionary) {
+  EXPECT_EQ(_select(std::vector<std::string>{"DE", "FR", "US", "DE", "GB"}).encoding_type,
+            EncodingType::FixedStringDictionary);
+  EXPECT_EQ(_select(std::vector<std::string>{"a", "b", "a very long string", "c", "d"}).encoding_type,
+            EncodingType::Dictionary);
+}
+
+TEST_F(EncodingSelectorTest, LongStringsUseFrontCodedDictionary) {
+  auto values = std::vector<std::string>{};
+  for (auto index = 0; index < 100; ++index) {
+    values.push_back("https://example.com/" + std::string(index % 50, 'x') + std::to_string(index));
+  }
+  EXPECT_EQ(_select(values).encoding_type, EncodingType::FrontCodedDictionary);
+}
+
+TEST_F(EncodingSelectorTest, VectorCompressionDependsOnAccesses) {
+  const auto values = std::vector<int32_t>{1, 2, 1, 2, 1, 2};
+
+  EXPECT_EQ(_select(values, true).vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+  EXPECT_EQ(_select(values, false).vector_compression_type, VectorCompressionType::SimdBp128);
+}
+
+TEST_F(EncodingSelectorTest, SelectChunkEncoding) {
+  auto int_column = std::make_shared<ValueColumn<int32_t>>(pmr_concurrent_vector<int32_t>{1, 2, 3, 4});
+  auto string_column =
+      std::make_shared<ValueColumn<std::string>>(pmr_concurrent_vector<std::string>{"a", "a", "b", "b"});
+  const Chunk chunk{ChunkColumns{int_column, string_column}};
+
+  const auto spec = EncodingSelector::select_chunk_encoding(chunk, {DataType::Int, DataType::String}, true);
+  ASSERT_EQ(spec.size(), 2u);
+  EXPECT_EQ(spec[0].encoding_type, EncodingType::Delta);
+  EXPECT_EQ(spec[1].encoding_type, EncodingType::FixedStringDictionary);
+}
+
+}  // namespace opossum
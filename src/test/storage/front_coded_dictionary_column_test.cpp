@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/column_encoding_utils.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/front_coded_dictionary_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryColumnTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>(true);
+
+  // Sorted URLs sharing long prefixes, spanning several blocks, including an empty string and strings whose lengths
+  // need more than one byte
+  pmr_vector<std::string> _create_urls() {
+    auto urls = pmr_vector<std::string>{""};
+    for (auto index = 0; index < 100; ++index) {
+      urls.push_back("https://example.com/" + std::string(index * 3, 'p') + "/" + std::to_string(index));
+    }
+    std::sort(urls.begin(), urls.end());
+    return urls;
+  }
+};
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, FrontCodedStringVector) {
+  const auto urls = _create_urls();
+  const auto vector = FrontCodedStringVector{urls, PolymorphicAllocator<char>{}};
+
+  EXPECT_EQ(vector.size(), urls.size());
+  EXPECT_EQ(vector.block_offsets().size(), 7u);
+  EXPECT_EQ(*vector.dictionary(), urls);
+
+  for (auto index = size_t{0u}; index < urls.size(); ++index) {
+    EXPECT_EQ(vector.get_string_at(index), urls[index]);
+
+    // Search for each string and for values in between
+    for (const auto& value : {urls[index], urls[index] + "0", urls[index].substr(0, urls[index].size() / 2)}) {
+      const auto expected_lower_bound = std::lower_bound(urls.cbegin(), urls.cend(), value) - urls.cbegin();
+      const auto expected_upper_bound = std::upper_bound(urls.cbegin(), urls.cend(), value) - urls.cbegin();
+      EXPECT_EQ(vector.lower_bound(value), static_cast<size_t>(expected_lower_bound));
+      EXPECT_EQ(vector.upper_bound(value), static_cast<size_t>(expected_upper_bound));
+    }
+  }
+
+  EXPECT_EQ(vector.upper_bound("z"), urls.size());
+
+  // Shared prefixes are only stored once
+  auto total_length = size_t{0u};
+  for (const auto& url : urls) total_length += url.size();
+  EXPECT_LT(vector.chars().size(), total_length / 2);
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, EmptyFrontCodedStringVector) {
+  const auto vector = FrontCodedStringVector{pmr_vector<std::string>{}, PolymorphicAllocator<char>{}};
+
+  EXPECT_EQ(vector.size(), 0u);
+  EXPECT_EQ(vector.lower_bound("a"), 0u);
+  EXPECT_EQ(vector.upper_bound("a"), 0u);
+  EXPECT_TRUE(vector.dictionary()->empty());
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, CompressColumnString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append(NULL_VALUE);
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+  ASSERT_NE(dict_col, nullptr);
+
+  EXPECT_EQ(dict_col->encoding_type(), EncodingType::FrontCodedDictionary);
+  EXPECT_EQ(dict_col->size(), 7u);
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+  EXPECT_EQ(dict_col->null_value_id(), ValueID{4u});
+
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+
+  EXPECT_EQ((*dict_col)[0], AllTypeVariant("Bill"));
+  EXPECT_TRUE(variant_is_null((*dict_col)[2]));
+  EXPECT_EQ((*dict_col)[5], AllTypeVariant("Hasso"));
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, LowerUpperBound) {
+  for (const auto& url : _create_urls()) vc_str->append(url);
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+  auto reference_col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(
+      encode_column(EncodingType::Dictionary, DataType::String, vc_str));
+
+  for (const auto& value : {"", "a", "https://example.com/", "https://example.com/ppp/1", "https://example.com/q"}) {
+    EXPECT_EQ(dict_col->lower_bound(value), reference_col->lower_bound(value));
+    EXPECT_EQ(dict_col->upper_bound(value), reference_col->upper_bound(value));
+  }
+
+  EXPECT_EQ(dict_col->lower_bound("z"), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound("z"), INVALID_VALUE_ID);
+
+  // The front-coded dictionary needs less memory than a vector of std::strings
+  EXPECT_LT(dict_col->estimate_memory_usage(), reference_col->estimate_memory_usage());
+}
+
+TEST_F(StorageFrontCodedDictionaryColumnTest, CopyUsingAllocator) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Bill");
+
+  auto col = encode_column(EncodingType::FrontCodedDictionary, DataType::String, vc_str);
+  auto dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(col);
+
+  const auto alloc = PolymorphicAllocator<size_t>{};
+  auto copied_ptr = dict_col->copy_using_allocator(alloc);
+  auto copied_dict_col = std::dynamic_pointer_cast<FrontCodedDictionaryColumn<std::string>>(copied_ptr);
+
+  ASSERT_NE(copied_dict_col, nullptr);
+  EXPECT_EQ(*copied_dict_col->dictionary(), *dict_col->dictionary());
+  EXPECT_EQ((*copied_dict_col)[1], AllTypeVariant("Steve"));
+}
+
+}  // namespace opossum
@@ -5,6 +5,7 @@
 #include <bitset>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -62,7 +63,7 @@ class SimdBp128Test : public BaseTest, public ::testing::WithParamInterface<uint
     return encoded_vector;
   }
 
- private:
+ protected:
   uint8_t _bit_size;
   uint32_t _min;
   uint32_t _max;
@@ -103,4 +104,30 @@ TEST_P(SimdBp128Test, DecodeSequenceUsingDecoder) {
   }
 }
 
+TEST_P(SimdBp128Test, ScanBlocks) {
+  const auto sequence = generate_sequence(4'200);
+  const auto encoded_sequence_base = encode(sequence);
+
+  const auto& encoded_sequence = dynamic_cast<const SimdBp128Vector&>(*encoded_sequence_base);
+
+  const auto lower = _min + (_max - _min) / 4u;
+  const auto upper = _max - (_max - _min) / 4u;
+  const auto excluded = _min + (_max - _min) / 2u;
+
+  auto matching_indices = std::vector<size_t>{};
+  encoded_sequence.scan_blocks(lower, upper, excluded, [&](const size_t first_index, const auto& matches) {
+    for (auto index = size_t{0u}; index < SimdBp128Packing::block_size; ++index) {
+      if ((matches[index / 64u] >> (index % 64u)) & 1u) matching_indices.push_back(first_index + index);
+    }
+  });
+
+  auto expected_indices = std::vector<size_t>{};
+  for (auto index = size_t{0u}; index < sequence.size(); ++index) {
+    const auto value = sequence[index];
+    if (lower <= value && value < upper && value != excluded) expected_indices.push_back(index);
+  }
+
+  EXPECT_EQ(matching_indices, expected_indices);
+}
+
 }  // namespace opossum
@@ -0,0 +1,125 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String);
+
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    _table->append({5, "five"});
+    _table->append({3, "three"});
+    _table->append({NullValue{}, "null"});
+    _table->append({5, "five"});
+    _table->append({1, "one"});
+
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableIndexTest, CreateAndRegister) {
+  const auto table_index = _table->create_table_index(ColumnID{0}, "a_index");
+
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}), table_index);
+  EXPECT_EQ(_table->get_table_index(ColumnID{1}), nullptr);
+  EXPECT_EQ(table_index->column_id(), ColumnID{0});
+
+  // NULLs are not indexed
+  EXPECT_EQ(table_index->size(), 4u);
+
+  const auto index_infos = _table->get_indexes();
+  ASSERT_EQ(index_infos.size(), 1u);
+  EXPECT_EQ(index_infos[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(index_infos[0].name, "a_index");
+  EXPECT_EQ(index_infos[0].type, ColumnIndexType::Table);
+
+  EXPECT_THROW(_table->create_table_index(ColumnID{0}), std::logic_error);
+}
+
+TEST_F(TableIndexTest, Lookup) {
+  const auto table_index = _table->create_table_index(ColumnID{0});
+
+  const auto row_5_0 = RowID{ChunkID{0}, ChunkOffset{0}};
+  const auto row_3 = RowID{ChunkID{0}, ChunkOffset{1}};
+  const auto row_5_1 = RowID{ChunkID{1}, ChunkOffset{0}};
+  const auto row_1 = RowID{ChunkID{1}, ChunkOffset{1}};
+
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Equals, 5), (PosList{row_5_0, row_5_1}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Equals, 4), PosList{});
+  EXPECT_EQ(table_index->lookup(PredicateCondition::NotEquals, 3), (PosList{row_1, row_5_0, row_5_1}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::LessThan, 5), (PosList{row_1, row_3}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::LessThanEquals, 3), (PosList{row_1, row_3}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::GreaterThan, 3), (PosList{row_5_0, row_5_1}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::GreaterThanEquals, 3), (PosList{row_3, row_5_0, row_5_1}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Between, 2, AllTypeVariant{5}), (PosList{row_3, row_5_0, row_5_1}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Between, 5, AllTypeVariant{2}), PosList{});
+
+  EXPECT_THROW(table_index->lookup(PredicateCondition::Like, 5), std::logic_error);
+}
+
+TEST_F(TableIndexTest, MaintainedByAppend) {
+  const auto table_index = _table->create_table_index(ColumnID{0});
+
+  _table->append({3, "three"});
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Equals, 3),
+            (PosList{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{1}, ChunkOffset{2}}}));
+
+  auto chunk_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data, 3, UseMvcc::Yes);
+  chunk_table->append({7, "seven"});
+  _table->append_chunk(chunk_table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(table_index->lookup(PredicateCondition::GreaterThan, 5), (PosList{RowID{ChunkID{2}, ChunkOffset{0}}}));
+}
+
+TEST_F(TableIndexTest, MaintainedByInsert) {
+  const auto table_index = _table->create_table_index(ColumnID{0});
+  StorageManager::get().add_table("table_a", _table);
+
+  auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values_to_insert->append({4, "four"});
+  values_to_insert->append({NullValue{}, "null"});
+  values_to_insert->append({4, "four"});
+  auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  // The last chunk had one free row, so the inserted rows span two chunks
+  EXPECT_EQ(table_index->size(), 6u);
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Equals, 4),
+            (PosList{RowID{ChunkID{1}, ChunkOffset{2}}, RowID{ChunkID{2}, ChunkOffset{1}}}));
+
+  // Rows of rolled back transactions stay in the index, they are filtered by the Validate following a lookup
+  auto rollback_context = TransactionManager::get().new_transaction_context();
+  auto rolled_back_insert = std::make_shared<Insert>("table_a", table_wrapper);
+  rolled_back_insert->set_transaction_context(rollback_context);
+  rolled_back_insert->execute();
+  rollback_context->rollback();
+
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Equals, 4).size(), 4u);
+}
+
+}  // namespace opossum
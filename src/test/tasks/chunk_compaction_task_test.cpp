@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/index/table_index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "tasks/chunk_compaction_task.hpp"
+
+namespace opossum {
+
+class ChunkCompactionTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/25_ints_sorted.tbl", 5);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void _delete(const PredicateCondition predicate_condition, const int32_t value) {
+    auto context = TransactionManager::get().new_transaction_context();
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, predicate_condition, value);
+    auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+    for (const auto& op : std::vector<std::shared_ptr<AbstractOperator>>{get_table, validate, table_scan, delete_op}) {
+      op->set_transaction_context(context);
+      op->execute();
+    }
+    context->commit();
+  }
+
+  // The values are copied, as the compaction replaces the chunks that a Validate output would reference
+  std::vector<int32_t> _visible_values(const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    get_table->execute();
+    validate->execute();
+
+    auto values = std::vector<int32_t>{};
+    const auto& output = validate->get_output();
+    for (auto row = size_t{0}; row < output->row_count(); ++row) {
+      values.emplace_back(output->get_value<int32_t>(ColumnID{0}, row));
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  std::vector<int32_t> _visible_values() {
+    return _visible_values(TransactionManager::get().new_transaction_context());
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkCompactionTaskTest, CompactsChunksAboveThreshold) {
+  _delete(PredicateCondition::LessThan, 10);  // 4 of the 5 rows of chunk 0
+  _delete(PredicateCondition::Equals, 15);    // 1 of the 5 rows of chunk 1
+  const auto expected_values = _visible_values();
+  const auto chunk_0 = _table->get_chunk(ChunkID{0});
+  const auto chunk_1 = _table->get_chunk(ChunkID{1});
+
+  ChunkCompactionTask{"table_a"}.execute();
+
+  // Chunk 0 has been replaced by a placeholder of the same size
+  EXPECT_NE(_table->get_chunk(ChunkID{0}), chunk_0);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 5u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1}), chunk_1);
+
+  // The remaining row of chunk 0 has been moved to a new chunk at the end of the table
+  ASSERT_EQ(_table->chunk_count(), 6u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{5})->size(), 1u);
+  EXPECT_EQ(_visible_values(), expected_values);
+
+  // Nothing is left to compact
+  const auto placeholder_chunk = _table->get_chunk(ChunkID{0});
+  ChunkCompactionTask{"table_a"}.execute();
+  EXPECT_EQ(_table->chunk_count(), 6u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}), placeholder_chunk);
+  EXPECT_EQ(_visible_values(), expected_values);
+}
+
+TEST_F(ChunkCompactionTaskTest, OlderTransactionsDelayRemoval) {
+  _delete(PredicateCondition::LessThan, 10);
+  auto old_context = TransactionManager::get().new_transaction_context();
+  const auto expected_values = _visible_values(old_context);
+  const auto chunk_0 = _table->get_chunk(ChunkID{0});
+
+  ChunkCompactionTask{"table_a"}.execute();
+
+  // The remaining row has been moved, but old_context must still be able to read it in chunk 0
+  ASSERT_EQ(_table->chunk_count(), 6u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}), chunk_0);
+  EXPECT_EQ(_visible_values(old_context), expected_values);
+  EXPECT_EQ(_visible_values(), expected_values);
+
+  old_context.reset();
+  ChunkCompactionTask{"table_a"}.execute();
+
+  EXPECT_NE(_table->get_chunk(ChunkID{0}), chunk_0);
+  EXPECT_EQ(_visible_values(), expected_values);
+}
+
+TEST_F(ChunkCompactionTaskTest, UpdatesTableIndex) {
+  const auto table_index = _table->create_table_index(ColumnID{0});
+  _delete(PredicateCondition::LessThan, 10);
+
+  ChunkCompactionTask{"table_a"}.execute();
+
+  EXPECT_TRUE(table_index->lookup(PredicateCondition::Equals, 1).empty());
+  EXPECT_EQ(table_index->lookup(PredicateCondition::Equals, 10), (PosList{RowID{ChunkID{5}, 0u}}));
+  EXPECT_EQ(table_index->size(), 21u);
+}
+
+TEST_F(ChunkCompactionTaskTest, CompactsRolledBackChunks) {
+  auto rows = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  for (auto value = 100; value < 110; ++value) rows->append({value});
+  auto table_wrapper = std::make_shared<TableWrapper>(rows);
+  table_wrapper->execute();
+
+  // The rows fill chunks 5 and 6, but are never committed
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->rollback();
+
+  ASSERT_EQ(_table->chunk_count(), 7u);
+  const auto chunk_5 = _table->get_chunk(ChunkID{5});
+
+  ChunkCompactionTask{"table_a"}.execute();
+
+  EXPECT_NE(_table->get_chunk(ChunkID{5}), chunk_5);
+  EXPECT_EQ(_table->get_chunk(ChunkID{5})->size(), 5u);
+}
+
+TEST_F(ChunkCompactionTaskTest, ValidatesReferencesCreatedBeforeCompaction) {
+  // The scan output references the rows of chunk 0 that are deleted and compacted afterwards
+  auto get_table = std::make_shared<GetTable>("table_a");
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::LessThan, 10);
+  get_table->execute();
+  table_scan->execute();
+  ASSERT_EQ(table_scan->get_output()->row_count(), 4u);
+
+  _delete(PredicateCondition::LessThan, 10);
+  ChunkCompactionTask{"table_a"}.execute();
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table_scan->get_output());
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  const auto context = TransactionManager::get().new_transaction_context();
+  validate->set_transaction_context(context);
+  table_wrapper->execute();
+  validate->execute();
+
+  EXPECT_EQ(validate->get_output()->row_count(), 0u);
+}
+
+}  // namespace opossum
@@ -117,4 +117,34 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, PipelineOfChunkwiseOperators) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(gt, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::LessThan, 458.0f);
+
+  // The scans are executed morsel-wise by a single task
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_b, CleanupTemporaries::Yes);
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt);
+  EXPECT_EQ(tasks[1]->get_operator(), scan_b);
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  auto expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+  EXPECT_TABLE_EQ_UNORDERED(expected_result, scan_b->get_output());
+
+  // The intermediate result of the first scan is never materialized
+  EXPECT_EQ(gt->get_output(), nullptr);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+
+  // Without cleaning up temporaries, the intermediate results remain available
+  auto gt_2 = std::make_shared<GetTable>("table_a");
+  auto scan_a_2 = std::make_shared<TableScan>(gt_2, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b_2 = std::make_shared<TableScan>(scan_a_2, ColumnID{1}, PredicateCondition::LessThan, 458.0f);
+  EXPECT_EQ(OperatorTask::make_tasks_from_operator(scan_b_2, CleanupTemporaries::No).size(), 3u);
+}
 }  // namespace opossum